@@ -3151,6 +3151,14 @@ SOURCE=.\src\misc\util\utilNam.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\misc\util\utilPth.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\misc\util\utilPth.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\misc\util\utilSignal.c
 # End Source File
 # Begin Source File
@@ -3159,6 +3167,14 @@ SOURCE=.\src\misc\util\utilSignal.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\misc\util\utilSimd.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\misc\util\utilSimd.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\misc\util\utilSort.c
 # End Source File
 # Begin Source File
@@ -3827,6 +3843,10 @@ SOURCE=.\src\aig\saig\saigSimSeq.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\saig\saigSimTer.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\saig\saigStrSim.c
 # End Source File
 # Begin Source File
@@ -3907,6 +3927,10 @@ SOURCE=.\src\aig\gia\giaClp.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaCnf.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaCof.c
 # End Source File
 # Begin Source File
@@ -4451,6 +4475,10 @@ SOURCE=.\src\proof\cec\cecPat.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\cec\cecResim.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\cec\cecSeq.c
 # End Source File
 # Begin Source File
@@ -4587,6 +4615,10 @@ SOURCE=.\src\proof\fra\fraPart.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\fra\fraPort.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\fra\fraSat.c
 # End Source File
 # Begin Source File
@@ -4899,6 +4931,10 @@ SOURCE=.\src\proof\pdr\pdrMan.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\pdr\pdrPth.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\pdr\pdrSat.c
 # End Source File
 # Begin Source File
@@ -110,6 +110,8 @@ struct Gia_Man_t_
     int *          pHTable;       // hash table
     int            nHTable;       // hash table size 
     int            fAddStrash;    // performs additional structural hashing
+    int *          pHTablePar;    // concurrent hash table (open addressing)
+    int            nHTablePar;    // concurrent hash table size (power of 2)
     int            fSweeper;      // sweeper is running
     int *          pRefs;         // the reference count
     Vec_Int_t *    vLevels;       // levels of the nodes
@@ -246,6 +248,7 @@ struct Gia_ParSim_t_
     int            nIters;        // the number of timeframes
     int            RandSeed;      // seed to generate random numbers
     int            TimeLimit;     // time limit in seconds
+    int            nProcs;        // the number of simulation threads
     int            fCheckMiter;   // check if miter outputs are non-zero
     int            fVerbose;      // enables verbose output
     int            iOutFail;      // index of the failed output
@@ -1053,9 +1056,13 @@ static inline int         Gia_ObjCellId( Gia_Man_t * p, int iLit )          { re
 
 /*=== giaAiger.c ===========================================================*/
 extern int                 Gia_FileSize( char * pFileName );
+extern int                 Gia_FileIsGzip( char * pFileName );
 extern Gia_Man_t *         Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fSkipStrash, int fCheck );
+extern Gia_Man_t *         Gia_AigerReadFromMemoryPar( char * pContents, size_t nFileSize, int fSkipStrash, int fCheck, int nProcs, int fVerbose );
 extern Gia_Man_t *         Gia_AigerRead( char * pFileName, int fSkipStrash, int fCheck );
+extern Gia_Man_t *         Gia_AigerReadPar( char * pFileName, int fSkipStrash, int fCheck, int nProcs, int fVerbose );
 extern void                Gia_AigerWrite( Gia_Man_t * p, char * pFileName, int fWriteSymbols, int fCompact );
+extern void                Gia_AigerWritePar( Gia_Man_t * p, char * pFileName, int fWriteSymbols, int fCompact, int nProcs, int fPrintStats );
 extern void                Gia_DumpAiger( Gia_Man_t * p, char * pFilePrefix, int iFileNum, int nFileNumDigits );
 extern Vec_Str_t *         Gia_AigerWriteIntoMemoryStr( Gia_Man_t * p );
 extern Vec_Str_t *         Gia_AigerWriteIntoMemoryStrPart( Gia_Man_t * p, Vec_Int_t * vCis, Vec_Int_t * vAnds, Vec_Int_t * vCos, int nRegs );
@@ -1082,6 +1089,8 @@ extern Abc_Cex_t *         Gia_ManCexExtendToIncludeAllObjects( Gia_Man_t * p, A
 extern Vec_Int_t *         Cbs_ManSolveMiter( Gia_Man_t * pGia, int nConfs, Vec_Str_t ** pvStatus, int fVerbose );
 /*=== giaCsat.c ============================================================*/
 extern Vec_Int_t *         Cbs_ManSolveMiterNc( Gia_Man_t * pGia, int nConfs, Vec_Str_t ** pvStatus, int fVerbose );
+extern Vec_Int_t *         Cbs_ManSolveMiterStop( Gia_Man_t * pGia, int nConfs, int fLearn, volatile int * pStop, Vec_Str_t ** pvStatus, int fVerbose );
+extern Vec_Int_t *         Cbs_ManSolveMiterPar( Gia_Man_t * pGia, int nConfs, int nProcs, int fLearn, Vec_Str_t ** pvStatus, int fVerbose );
 /*=== giaCTas.c ============================================================*/
 extern Vec_Int_t *         Tas_ManSolveMiterNc( Gia_Man_t * pGia, int nConfs, Vec_Str_t ** pvStatus, int fVerbose );
 /*=== giaCof.c =============================================================*/
@@ -1089,6 +1098,9 @@ extern void                Gia_ManPrintFanio( Gia_Man_t * pGia, int nNodes );
 extern Gia_Man_t *         Gia_ManDupCof( Gia_Man_t * p, int iVar );
 extern Gia_Man_t *         Gia_ManDupCofAllInt( Gia_Man_t * p, Vec_Int_t * vSigs, int fVerbose );
 extern Gia_Man_t *         Gia_ManDupCofAll( Gia_Man_t * p, int nFanLim, int fVerbose );
+/*=== giaCnf.c ============================================================*/
+extern struct Cnf_Dat_t_ * Gia_ManDeriveCnfFast( Gia_Man_t * p, int nOutputs, int nProcs, int fVerbose );
+extern void                Gia_ManDumpCnfFast( Gia_Man_t * p, char * pFileName, int nProcs, int fVerbose );
 /*=== giaDfs.c ============================================================*/
 extern void                Gia_ManCollectCis( Gia_Man_t * p, int * pNodes, int nNodes, Vec_Int_t * vSupp );
 extern void                Gia_ManCollectAnds( Gia_Man_t * p, int * pNodes, int nNodes, Vec_Int_t * vNodes );
@@ -1218,6 +1230,10 @@ extern Gia_Man_t *         Gia_ManRehash( Gia_Man_t * p, int fAddStrash );
 extern void                Gia_ManHashProfile( Gia_Man_t * p );
 extern int                 Gia_ManHashLookup( Gia_Man_t * p, Gia_Obj_t * p0, Gia_Obj_t * p1 );
 extern int                 Gia_ManHashAndMulti( Gia_Man_t * p, Vec_Int_t * vLits );
+extern void                Gia_ManHashParStart( Gia_Man_t * p, int nObjsMax );
+extern void                Gia_ManHashParStop( Gia_Man_t * p );
+extern int                 Gia_ManHashParAnd( Gia_Man_t * p, int iLit0, int iLit1 );
+extern Gia_Man_t *         Gia_ManRehashPar( Gia_Man_t * p, int nProcs, int fVerbose );
 /*=== giaIf.c ===========================================================*/
 extern void                Gia_ManPrintMappingStats( Gia_Man_t * p, char * pDumpFile );
 extern void                Gia_ManPrintPackingStats( Gia_Man_t * p );
@@ -1323,6 +1339,7 @@ extern unsigned *          Gia_SimDataCoExt( Gia_ManSim_t * p, int i );
 extern void                Gia_ManSimInfoInit( Gia_ManSim_t * p );
 extern void                Gia_ManSimInfoTransfer( Gia_ManSim_t * p );
 extern void                Gia_ManSimulateRound( Gia_ManSim_t * p );
+extern void                Gia_ManSimulateRoundRange( Gia_ManSim_t * p, int iWord, int nWords );
 /*=== giaSpeedup.c ============================================================*/
 extern float               Gia_ManDelayTraceLut( Gia_Man_t * p );
 extern float               Gia_ManDelayTraceLutPrint( Gia_Man_t * p, int fVerbose );
@@ -21,7 +21,16 @@
 
 #include "gia.h"
 #include "misc/tim/tim.h"
+#include "misc/util/utilPth.h"
+#include "misc/zlib/zlib.h"
 #include "base/main/main.h"
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 ABC_NAMESPACE_IMPL_START
 
@@ -30,6 +39,39 @@ ABC_NAMESPACE_IMPL_START
 ////////////////////////////////////////////////////////////////////////
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
+
+#define GIA_AIGER_CHUNK (1 << 18)   // the number of bytes decoded by one task
+
+typedef struct Gia_AigerChunks_t_
+{
+    unsigned char ** pStarts;     // the first byte of each chunk (nChunks + 1 entries)
+    word *         pFirsts;       // the index of the first number of each chunk
+    int *          pLits;         // decoded fanin data (two entries per AND node)
+    unsigned char * pStop;        // the byte following the AND section
+    int            nChunks;       // the number of chunks
+    int            nCis;          // the number of CIs
+    int            nAnds;         // the number of AND nodes
+    int            nThreads;      // the number of threads
+} Gia_AigerChunks_t;
+
+#define GIA_AIGER_FLUSH (1 << 20)   // the size of the output buffer
+
+typedef struct Gia_AigerOut_t_
+{
+    FILE *         pFile;         // the output file
+    Vec_Str_t *    vBuffer;       // the pending output
+    int            fGzip;         // compress the output
+    int            nBytes;        // the number of bytes written
+} Gia_AigerOut_t;
+
+typedef struct Gia_AigerEnc_t_
+{
+    Gia_Man_t *    pGia;          // the AIG being written
+    Vec_Ptr_t *    vChunks;       // encoded chunks of one wave
+    int            iChunkStart;   // the first chunk of the wave
+    int            fGzip;         // compress the chunks
+    int            nThreads;      // the number of threads
+} Gia_AigerEnc_t;
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -162,6 +204,107 @@ Vec_Str_t * Gia_AigerWriteLiterals( Vec_Int_t * vLits )
     return vBinary;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Decodes the binary AND section using several threads.]
+
+  Description [The delta-encoded fanins are variable-length, but the last
+  byte of each number is the only one with the high bit clear. The bytes 
+  starting at the AND section are split into chunks beginning at number 
+  boundaries. The threads first count the numbers ending in each chunk, 
+  which gives the index of the first number of each chunk, and then decode 
+  the chunks. For each AND node, the array contains the larger fanin literal 
+  (entry 2*i+1) and the difference of the two literals (entry 2*i+0), so 
+  that chunks do not depend on each other. The numbering of the file is 
+  used and structural hashing is performed later. Returns NULL if the 
+  section is truncated.]
+  
+  SideEffects [Advances the position to the end of the AND section.]
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_AigerCountChunk( void * pUser, int iThread )
+{
+    Gia_AigerChunks_t * p = (Gia_AigerChunks_t *)pUser;
+    unsigned char * pCur;
+    word Counter;
+    int c;
+    for ( c = iThread; c < p->nChunks; c += p->nThreads )
+    {
+        Counter = 0;
+        for ( pCur = p->pStarts[c]; pCur < p->pStarts[c+1]; pCur++ )
+            Counter += !(*pCur & 0x80);
+        p->pFirsts[c+1] = Counter;
+    }
+}
+static void Gia_AigerDecodeChunk( void * pUser, int iThread )
+{
+    Gia_AigerChunks_t * p = (Gia_AigerChunks_t *)pUser;
+    unsigned char * pCur;
+    word k, kStop = 2 * (word)p->nAnds;
+    int c;
+    for ( c = iThread; c < p->nChunks; c += p->nThreads )
+    {
+        pCur = p->pStarts[c];
+        for ( k = p->pFirsts[c]; k < Abc_MinWord(kStop, p->pFirsts[c+1]); k++ )
+        {
+            if ( k & 1 )
+                p->pLits[k-1] = Gia_AigerReadUnsigned( &pCur );
+            else
+                p->pLits[k+1] = ((k/2 + 1 + p->nCis) << 1) - Gia_AigerReadUnsigned( &pCur );
+        }
+        if ( k == kStop && p->pFirsts[c] < kStop )
+            p->pStop = pCur;
+    }
+}
+static Vec_Int_t * Gia_AigerReadAndsPar( unsigned char ** ppPos, unsigned char * pEnd, int nCis, int nAnds, int nProcs )
+{
+    Gia_AigerChunks_t Data, * p = &Data;
+    Vec_Int_t * vLits;
+    Util_Pool_t * pPool;
+    unsigned char * pCur = *ppPos, * pLimit;
+    int c;
+    // each number takes at most five bytes
+    pLimit = (size_t)(pEnd - pCur) / 10 > (size_t)nAnds ? pCur + (size_t)10 * nAnds : pEnd;
+    // split the bytes into chunks starting after the last byte of a number
+    p->nChunks  = (int)((size_t)(pLimit - pCur) / GIA_AIGER_CHUNK) + 1;
+    p->pStarts  = ABC_ALLOC( unsigned char *, p->nChunks + 1 );
+    p->pFirsts  = ABC_CALLOC( word, p->nChunks + 1 );
+    p->pStop    = NULL;
+    p->nCis     = nCis;
+    p->nAnds    = nAnds;
+    p->nThreads = nProcs;
+    p->pStarts[0] = pCur;
+    p->pStarts[p->nChunks] = pLimit;
+    for ( c = 1; c < p->nChunks; c++ )
+    {
+        pCur = p->pStarts[0] + (size_t)c * GIA_AIGER_CHUNK;
+        while ( pCur < pLimit && (*pCur & 0x80) )
+            pCur++;
+        p->pStarts[c] = pCur < pLimit ? pCur + 1 : pLimit;
+    }
+    pPool = Util_PoolStart( nProcs );
+    // count the numbers in each chunk and find the first number of each chunk
+    Util_PoolRun( pPool, Gia_AigerCountChunk, p );
+    for ( c = 0; c < p->nChunks; c++ )
+        p->pFirsts[c+1] += p->pFirsts[c];
+    // decode the chunks
+    vLits = NULL;
+    if ( p->pFirsts[p->nChunks] >= 2 * (word)nAnds )
+    {
+        vLits = Vec_IntStart( 2 * nAnds );
+        p->pLits = Vec_IntArray( vLits );
+        Util_PoolRun( pPool, Gia_AigerDecodeChunk, p );
+        assert( p->pStop != NULL );
+        *ppPos = p->pStop;
+    }
+    Util_PoolStop( pPool );
+    ABC_FREE( p->pStarts );
+    ABC_FREE( p->pFirsts );
+    return vLits;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Reads the AIG in the binary AIGER format.]
@@ -174,15 +317,20 @@ Vec_Str_t * Gia_AigerWriteLiterals( Vec_Int_t * vLits )
 
 ***********************************************************************/
 Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fSkipStrash, int fCheck )
+{
+    return Gia_AigerReadFromMemoryPar( pContents, (size_t)nFileSize, fSkipStrash, fCheck, 1, 0 );
+}
+Gia_Man_t * Gia_AigerReadFromMemoryPar( char * pContents, size_t nFileSize, int fSkipStrash, int fCheck, int nProcs, int fVerbose )
 {
     Gia_Man_t * pNew, * pTemp;
-    Vec_Int_t * vLits = NULL, * vPoTypes = NULL;
+    Vec_Int_t * vLits = NULL, * vPoTypes = NULL, * vFanins = NULL;
     Vec_Int_t * vNodes, * vDrivers, * vInits = NULL;
     int iObj, iNode0, iNode1, fHieOnly = 0;
     int nTotal, nInputs, nOutputs, nLatches, nAnds, i;
     int nBad = 0, nConstr = 0, nJust = 0, nFair = 0;
     unsigned char * pDrivers, * pSymbols, * pCur;
     unsigned uLit0, uLit1, uLit;
+    abctime clk;
 
     // read the parameters (M I L O A + B C J F)
     pCur = (unsigned char *)pContents;         while ( *pCur != ' ' ) pCur++; pCur++;
@@ -281,14 +429,32 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fSkipS
         vLits = Gia_AigerReadLiterals( &pCur, nLatches + nOutputs );
     }
 
+    // decode the AND gates in parallel
+    if ( nProcs > 1 && nAnds > 0 )
+    {
+        clk = Util_WallClock();
+        vFanins = Gia_AigerReadAndsPar( &pCur, (unsigned char *)pContents + nFileSize, nInputs + nLatches, nAnds, nProcs );
+        if ( fVerbose )
+            Abc_PrintTime( 1, "Decoding AND nodes", Util_WallClock() - clk );
+    }
+
     // create the AND gates
+    clk = Util_WallClock();
     if ( !fSkipStrash )
         Gia_ManHashAlloc( pNew );
     for ( i = 0; i < nAnds; i++ )
     {
-        uLit = ((i + 1 + nInputs + nLatches) << 1);
-        uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
-        uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
+        if ( vFanins )
+        {
+            uLit1 = Vec_IntEntry( vFanins, 2*i+1 );
+            uLit0 = uLit1 - Vec_IntEntry( vFanins, 2*i+0 );
+        }
+        else
+        {
+            uLit = ((i + 1 + nInputs + nLatches) << 1);
+            uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
+            uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
+        }
 //        assert( uLit1 > uLit0 );
         iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), uLit0 & 1 );
         iNode1 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit1 >> 1), uLit1 & 1 );
@@ -305,6 +471,9 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fSkipS
     }
     if ( !fSkipStrash )
         Gia_ManHashStop( pNew );
+    Vec_IntFreeP( &vFanins );
+    if ( fVerbose )
+        Abc_PrintTime( 1, fSkipStrash ? "Creating AND nodes" : "Hashing AND nodes", Util_WallClock() - clk );
 
     // remember the place where symbols begin
     pSymbols = pCur;
@@ -836,23 +1005,154 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fSkipS
 
 ***********************************************************************/
 Gia_Man_t * Gia_AigerRead( char * pFileName, int fSkipStrash, int fCheck )
+{
+    return Gia_AigerReadPar( pFileName, fSkipStrash, fCheck, 1, 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Maps the file into memory.]
+
+  Description [The pages are mapped privately and copy-on-write, because 
+  the reader may modify the buffer while parsing the symbol table. 
+  Returns NULL if the file cannot be mapped.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char * Gia_AigerMapFile( char * pFileName, size_t * pnFileSize )
+{
+#ifndef _WIN32
+    struct stat Stat;
+    void * pContents;
+    int fd = open( pFileName, O_RDONLY );
+    if ( fd == -1 )
+        return NULL;
+    if ( fstat( fd, &Stat ) == -1 || Stat.st_size == 0 )
+    {
+        close( fd );
+        return NULL;
+    }
+    pContents = mmap( NULL, (size_t)Stat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0 );
+    close( fd );
+    if ( pContents == MAP_FAILED )
+        return NULL;
+    madvise( pContents, (size_t)Stat.st_size, MADV_SEQUENTIAL );
+    *pnFileSize = (size_t)Stat.st_size;
+    return (char *)pContents;
+#else
+    return NULL;
+#endif
+}
+static void Gia_AigerUnmapFile( char * pContents, size_t nFileSize )
+{
+#ifndef _WIN32
+    munmap( pContents, nFileSize );
+#endif
+}
+static char * Gia_AigerReadGzFile( char * pFileName, size_t * pnFileSize )
+{
+    gzFile pFile;
+    char * pContents;
+    size_t nFileSize = 0, nCap = GIA_AIGER_FLUSH;
+    int nRead;
+    pFile = gzopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return NULL;
+    pContents = ABC_ALLOC( char, nCap );
+    while ( (nRead = gzread( pFile, pContents + nFileSize, (unsigned)Abc_MinWord(nCap - nFileSize, 1 << 30) )) > 0 )
+    {
+        nFileSize += nRead;
+        if ( nFileSize == nCap )
+            pContents = ABC_REALLOC( char, pContents, (nCap *= 2) );
+    }
+    gzclose( pFile );
+    if ( nRead < 0 || nFileSize == 0 )
+    {
+        ABC_FREE( pContents );
+        return NULL;
+    }
+    *pnFileSize = nFileSize;
+    return pContents;
+}
+static char * Gia_AigerReadFile( char * pFileName, size_t * pnFileSize )
 {
     FILE * pFile;
-    Gia_Man_t * pNew;
-    char * pName, * pContents;
-    int nFileSize;
+    char * pContents;
+    size_t nFileSize;
     int RetValue;
-
-    // read the file into the buffer
-    Gia_FileFixName( pFileName );
-    nFileSize = Gia_FileSize( pFileName );
     pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return NULL;
+#ifdef _WIN32
+    _fseeki64( pFile, 0, SEEK_END );
+    nFileSize = (size_t)_ftelli64( pFile );
+#else
+    fseeko( pFile, 0, SEEK_END );
+    nFileSize = (size_t)ftello( pFile );
+#endif
+    rewind( pFile );
     pContents = ABC_ALLOC( char, nFileSize );
     RetValue = fread( pContents, nFileSize, 1, pFile );
     fclose( pFile );
+    *pnFileSize = nFileSize;
+    return pContents;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the AIG in the binary AIGER format.]
+
+  Description [Files ending with ".gz" are decompressed. Otherwise, the 
+  file is read into a buffer. If nProcs > 1, the file is mapped into 
+  memory rather than copied, and the AND section is decoded using several
+  threads before structural hashing.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_AigerReadPar( char * pFileName, int fSkipStrash, int fCheck, int nProcs, int fVerbose )
+{
+    Gia_Man_t * pNew;
+    char * pName, * pContents = NULL;
+    size_t nFileSize = 0;
+    int fMapped = 0;
+    abctime clk = Util_WallClock();
+
+    // read the file into the buffer or map it
+    Gia_FileFixName( pFileName );
+    if ( Gia_FileIsGzip(pFileName) )
+    {
+        pContents = Gia_AigerReadGzFile( pFileName, &nFileSize );
+        if ( pContents == NULL )
+        {
+            printf( "Gia_AigerRead(): Cannot read the compressed file \"%s\".\n", pFileName );
+            return NULL;
+        }
+    }
+    else if ( nProcs > 1 )
+        fMapped = ((pContents = Gia_AigerMapFile( pFileName, &nFileSize )) != NULL);
+    if ( pContents == NULL )
+        pContents = Gia_AigerReadFile( pFileName, &nFileSize );
+    if ( pContents == NULL )
+    {
+        printf( "Gia_AigerRead(): Cannot open the file \"%s\".\n", pFileName );
+        return NULL;
+    }
+    if ( fVerbose )
+        Abc_PrintTime( 1, fMapped ? "Mapping the file" : "Reading the file", Util_WallClock() - clk );
 
-    pNew = Gia_AigerReadFromMemory( pContents, nFileSize, fSkipStrash, fCheck );
-    ABC_FREE( pContents );
+    pNew = Gia_AigerReadFromMemoryPar( pContents, nFileSize, fSkipStrash, fCheck, nProcs, fVerbose );
+    if ( fMapped )
+        Gia_AigerUnmapFile( pContents, nFileSize );
+    else
+        ABC_FREE( pContents );
+    if ( fVerbose )
+        Abc_PrintTime( 1, "Total reading time", Util_WallClock() - clk );
     if ( pNew )
     {
         ABC_FREE( pNew->pName );
@@ -1027,6 +1327,200 @@ Vec_Str_t * Gia_AigerWriteIntoMemoryStrPart( Gia_Man_t * p, Vec_Int_t * vCis, Ve
     return vBuffer;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Compresses the buffer into one gzip member.]
+
+  Description [A sequence of gzip members is a valid gzip file, which
+  allows for compressing the chunks independently.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Vec_Str_t * Gia_AigerDeflate( char * pBuffer, int nSize )
+{
+    Vec_Str_t * vRes;
+    z_stream Stream;
+    int RetValue;
+    memset( &Stream, 0, sizeof(z_stream) );
+    RetValue = deflateInit2( &Stream, Z_BEST_SPEED, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY );
+    assert( RetValue == Z_OK );
+    vRes = Vec_StrAlloc( (int)deflateBound(&Stream, nSize) + 32 );
+    Stream.next_in   = (Bytef *)pBuffer;
+    Stream.avail_in  = nSize;
+    Stream.next_out  = (Bytef *)Vec_StrArray(vRes);
+    Stream.avail_out = Vec_StrCap(vRes);
+    RetValue = deflate( &Stream, Z_FINISH );
+    assert( RetValue == Z_STREAM_END );
+    vRes->nSize = (int)Stream.total_out;
+    deflateEnd( &Stream );
+    return vRes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Output stream used by the AIGER writer.]
+
+  Description [The output is accumulated in the buffer, which is flushed
+  into the file (compressed, if needed) when it becomes large.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_FileIsGzip( char * pFileName )
+{
+    int nLength = strlen(pFileName);
+    return nLength > 3 && !strcmp(pFileName + nLength - 3, ".gz");
+}
+static Gia_AigerOut_t * Gia_AigerOutStart( FILE * pFile, int fGzip )
+{
+    Gia_AigerOut_t * p = ABC_CALLOC( Gia_AigerOut_t, 1 );
+    p->pFile   = pFile;
+    p->fGzip   = fGzip;
+    p->vBuffer = Vec_StrAlloc( GIA_AIGER_FLUSH + 1000 );
+    return p;
+}
+static void Gia_AigerOutPut( Gia_AigerOut_t * p, char * pBuffer, int nSize )
+{
+    if ( p->fGzip )
+    {
+        Vec_Str_t * vZip = Gia_AigerDeflate( pBuffer, nSize );
+        fwrite( Vec_StrArray(vZip), 1, Vec_StrSize(vZip), p->pFile );
+        p->nBytes += Vec_StrSize(vZip);
+        Vec_StrFree( vZip );
+    }
+    else
+    {
+        fwrite( pBuffer, 1, nSize, p->pFile );
+        p->nBytes += nSize;
+    }
+}
+static void Gia_AigerOutFlush( Gia_AigerOut_t * p )
+{
+    if ( Vec_StrSize(p->vBuffer) == 0 )
+        return;
+    Gia_AigerOutPut( p, Vec_StrArray(p->vBuffer), Vec_StrSize(p->vBuffer) );
+    Vec_StrClear( p->vBuffer );
+}
+static void Gia_AigerOutStop( Gia_AigerOut_t * p )
+{
+    Gia_AigerOutFlush( p );
+    Vec_StrFree( p->vBuffer );
+    ABC_FREE( p );
+}
+static void Gia_AigerOutWrite( Gia_AigerOut_t * p, void * pBuffer, int nSize )
+{
+    Vec_StrPushBuffer( p->vBuffer, (char *)pBuffer, nSize );
+    if ( Vec_StrSize(p->vBuffer) >= GIA_AIGER_FLUSH )
+        Gia_AigerOutFlush( p );
+}
+static void Gia_AigerOutWriteSize( Gia_AigerOut_t * p, int nSize )
+{
+    unsigned char Buffer[5];
+    Gia_AigerWriteInt( Buffer, nSize );
+    Gia_AigerOutWrite( p, Buffer, 4 );
+}
+static void Gia_AigerOutPrintf( Gia_AigerOut_t * p, const char * pFormat, ... )
+{
+    char Buffer[1000], * pBuffer = Buffer;
+    va_list args;
+    int nSize;
+    va_start( args, pFormat );
+    nSize = vsnprintf( Buffer, sizeof(Buffer), pFormat, args );
+    va_end( args );
+    assert( nSize >= 0 );
+    if ( nSize >= (int)sizeof(Buffer) )
+    {
+        pBuffer = ABC_ALLOC( char, nSize + 1 );
+        va_start( args, pFormat );
+        vsnprintf( pBuffer, nSize + 1, pFormat, args );
+        va_end( args );
+    }
+    Gia_AigerOutWrite( p, pBuffer, nSize );
+    if ( pBuffer != Buffer )
+        ABC_FREE( pBuffer );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the binary AND section using several threads.]
+
+  Description [The AND nodes are split into chunks of GIA_AIGER_CHUNK 
+  nodes, which are encoded (and compressed, if needed) independently. 
+  To keep the memory bounded, the chunks are processed in waves of a 
+  few chunks per thread, and each wave is written in order.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_AigerEncodeChunk( void * pUser, int iThread )
+{
+    Gia_AigerEnc_t * p = (Gia_AigerEnc_t *)pUser;
+    Gia_Man_t * pGia = p->pGia;
+    Gia_Obj_t * pObj;
+    unsigned char * pBuffer;
+    unsigned uLit0, uLit1, uLit;
+    int c, i, iStart, iStop, Pos;
+    for ( c = iThread; c < Vec_PtrSize(p->vChunks); c += p->nThreads )
+    {
+        iStart = 1 + Gia_ManCiNum(pGia) + (p->iChunkStart + c) * GIA_AIGER_CHUNK;
+        iStop  = Abc_MinInt( 1 + Gia_ManCiNum(pGia) + Gia_ManAndNum(pGia), iStart + GIA_AIGER_CHUNK );
+        pBuffer = ABC_ALLOC( unsigned char, 10 * (iStop - iStart) + 10 );
+        for ( Pos = 0, i = iStart; i < iStop; i++ )
+        {
+            pObj  = Gia_ManObj( pGia, i );
+            assert( Gia_ObjIsAnd(pObj) );
+            uLit  = Abc_Var2Lit( i, 0 );
+            uLit0 = Gia_ObjFaninLit0( pObj, i );
+            uLit1 = Gia_ObjFaninLit1( pObj, i );
+            assert( Gia_ManBufNum(pGia) || uLit0 < uLit1 );
+            Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit  - uLit1 );
+            Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit1 - uLit0 );
+        }
+        if ( p->fGzip )
+        {
+            Vec_PtrWriteEntry( p->vChunks, c, Gia_AigerDeflate( (char *)pBuffer, Pos ) );
+            ABC_FREE( pBuffer );
+        }
+        else
+            Vec_PtrWriteEntry( p->vChunks, c, Vec_StrAllocArray( (char *)pBuffer, Pos ) );
+    }
+}
+static void Gia_AigerOutWriteAnds( Gia_AigerOut_t * pOut, Gia_Man_t * p, int nProcs )
+{
+    Gia_AigerEnc_t Data, * pEnc = &Data;
+    Util_Pool_t * pPool;
+    Vec_Str_t * vChunk;
+    int nChunks = (Gia_ManAndNum(p) + GIA_AIGER_CHUNK - 1) / GIA_AIGER_CHUNK;
+    int nWave = 4 * nProcs, i;
+    pEnc->pGia     = p;
+    pEnc->vChunks  = Vec_PtrAlloc( nWave );
+    pEnc->fGzip    = pOut->fGzip;
+    pEnc->nThreads = nProcs;
+    // the chunks are written directly, which requires an empty buffer
+    Gia_AigerOutFlush( pOut );
+    pPool = Util_PoolStart( nProcs );
+    for ( pEnc->iChunkStart = 0; pEnc->iChunkStart < nChunks; pEnc->iChunkStart += nWave )
+    {
+        Vec_PtrFill( pEnc->vChunks, Abc_MinInt(nWave, nChunks - pEnc->iChunkStart), NULL );
+        Util_PoolRun( pPool, Gia_AigerEncodeChunk, pEnc );
+        Vec_PtrForEachEntry( Vec_Str_t *, pEnc->vChunks, vChunk, i )
+        {
+            fwrite( Vec_StrArray(vChunk), 1, Vec_StrSize(vChunk), pOut->pFile );
+            pOut->nBytes += Vec_StrSize(vChunk);
+            Vec_StrFree( vChunk );
+        }
+    }
+    Util_PoolStop( pPool );
+    Vec_PtrFree( pEnc->vChunks );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Writes the AIG in the binary AIGER format.]
@@ -1039,15 +1533,35 @@ Vec_Str_t * Gia_AigerWriteIntoMemoryStrPart( Gia_Man_t * p, Vec_Int_t * vCis, Ve
 
 ***********************************************************************/
 void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int fCompact )
+{
+    Gia_AigerWritePar( pInit, pFileName, fWriteSymbols, fCompact, 1, 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the AIG in the binary AIGER format.]
+
+  Description [The file is written as a stream, without creating the 
+  complete image in memory. The AND nodes are encoded in chunks using 
+  nProcs threads and the chunks are written in order. If the file name 
+  ends with ".gz", the output is compressed. If fPrintStats is set, 
+  prints the runtime and the size of the written file.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_AigerWritePar( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int fCompact, int nProcs, int fPrintStats )
 {
     int fVerbose = XAIG_VERBOSE;
     FILE * pFile;
+    Gia_AigerOut_t * pOut;
     Gia_Man_t * p;
     Gia_Obj_t * pObj;
     Vec_Str_t * vStrExt;
-    int i, nBufferSize, Pos;
-    unsigned char * pBuffer;
-    unsigned uLit0, uLit1, uLit;
+    int i;
+    abctime clk = Abc_Clock();
     assert( pInit->nXors == 0 && pInit->nMuxes == 0 );
 
     if ( Gia_ManCoNum(pInit) == 0 )
@@ -1063,6 +1577,7 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         fprintf( stdout, "Gia_AigerWrite(): Cannot open the output file \"%s\".\n", pFileName );
         return;
     }
+    pOut = Gia_AigerOutStart( pFile, Gia_FileIsGzip(pFileName) );
 
     // create normalized AIG
     if ( !Gia_ManIsNormalized(pInit) )
@@ -1080,7 +1595,7 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         p = pInit;
 
     // write the header "M I L O A" where M = I + L + A
-    fprintf( pFile, "aig%s %u %u %u %u %u", 
+    Gia_AigerOutPrintf( pOut, "aig%s %u %u %u %u %u", 
         fCompact? "2" : "",
         Gia_ManCiNum(p) + Gia_ManAndNum(p), 
         Gia_ManPiNum(p),
@@ -1089,55 +1604,33 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         Gia_ManAndNum(p) );
     // write the extended header "B C J F"
     if ( Gia_ManConstrNum(p) )
-        fprintf( pFile, " %u %u", Gia_ManPoNum(p) - Gia_ManConstrNum(p), Gia_ManConstrNum(p) );
-    fprintf( pFile, "\n" ); 
+        Gia_AigerOutPrintf( pOut, " %u %u", Gia_ManPoNum(p) - Gia_ManConstrNum(p), Gia_ManConstrNum(p) );
+    Gia_AigerOutPrintf( pOut, "\n" ); 
 
     Gia_ManInvertConstraints( p );
     if ( !fCompact ) 
     {
         // write latch drivers
         Gia_ManForEachRi( p, pObj, i )
-            fprintf( pFile, "%u\n", Gia_ObjFaninLit0p(p, pObj) );
+            Gia_AigerOutPrintf( pOut, "%u\n", Gia_ObjFaninLit0p(p, pObj) );
         // write PO drivers
         Gia_ManForEachPo( p, pObj, i )
-            fprintf( pFile, "%u\n", Gia_ObjFaninLit0p(p, pObj) );
+            Gia_AigerOutPrintf( pOut, "%u\n", Gia_ObjFaninLit0p(p, pObj) );
     }
     else
     {
         Vec_Int_t * vLits = Gia_AigerCollectLiterals( p );
         Vec_Str_t * vBinary = Gia_AigerWriteLiterals( vLits );
-        fwrite( Vec_StrArray(vBinary), 1, Vec_StrSize(vBinary), pFile );
+        Gia_AigerOutWrite( pOut, Vec_StrArray(vBinary), Vec_StrSize(vBinary) );
         Vec_StrFree( vBinary );
         Vec_IntFree( vLits );
     }
     Gia_ManInvertConstraints( p );
 
-    // write the nodes into the buffer
-    Pos = 0;
-    nBufferSize = 8 * Gia_ManAndNum(p) + 100; // skeptically assuming 3 chars per one AIG edge
-    pBuffer = ABC_ALLOC( unsigned char, nBufferSize );
-    Gia_ManForEachAnd( p, pObj, i )
-    {
-        uLit  = Abc_Var2Lit( i, 0 );
-        uLit0 = Gia_ObjFaninLit0( pObj, i );
-        uLit1 = Gia_ObjFaninLit1( pObj, i );
-        assert( Gia_ManBufNum(p) || uLit0 < uLit1 );
-        Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit  - uLit1 );
-        Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit1 - uLit0 );
-        if ( Pos > nBufferSize - 10 )
-        {
-            printf( "Gia_AigerWrite(): AIGER generation has failed because the allocated buffer is too small.\n" );
-	        fclose( pFile );
-            if ( p != pInit )
-                Gia_ManStop( p );
-            return;
-        }
-    }
-    assert( Pos < nBufferSize );
-
-    // write the buffer
-    fwrite( pBuffer, 1, Pos, pFile );
-    ABC_FREE( pBuffer );
+    // write the nodes
+    Gia_AigerOutWriteAnds( pOut, p, nProcs );
+    if ( fPrintStats )
+        Abc_PrintTime( 1, "Writing AND nodes", Abc_Clock() - clk );
 
     // write the symbol table
     if ( p->vNamesIn && p->vNamesOut )
@@ -1146,42 +1639,42 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         assert( Vec_PtrSize(p->vNamesOut) == Gia_ManCoNum(p) );
         // write PIs
         Gia_ManForEachPi( p, pObj, i )
-            fprintf( pFile, "i%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesIn, i) );
+            Gia_AigerOutPrintf( pOut, "i%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesIn, i) );
         // write latches
         Gia_ManForEachRo( p, pObj, i )
-            fprintf( pFile, "l%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesIn, Gia_ManPiNum(p) + i) );
+            Gia_AigerOutPrintf( pOut, "l%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesIn, Gia_ManPiNum(p) + i) );
         // write POs
         Gia_ManForEachPo( p, pObj, i )
-            fprintf( pFile, "o%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesOut, i) );
+            Gia_AigerOutPrintf( pOut, "o%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesOut, i) );
     }
 
     // write the comment
 //    fprintf( pFile, "c\n" );
-    fprintf( pFile, "c" );
+    Gia_AigerOutPrintf( pOut, "c" );
 
     // write additional AIG
     if ( p->pAigExtra )
     {
-        fprintf( pFile, "a" );
+        Gia_AigerOutPrintf( pOut, "a" );
         vStrExt = Gia_AigerWriteIntoMemoryStr( p->pAigExtra );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutWriteSize( pOut, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pOut, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
         if ( fVerbose ) printf( "Finished writing extension \"a\".\n" );
     }
     // write constraints
     if ( p->nConstrs )
     {
-        fprintf( pFile, "c" );
-        Gia_FileWriteBufferSize( pFile, 4 );
-        Gia_FileWriteBufferSize( pFile, p->nConstrs );
+        Gia_AigerOutPrintf( pOut, "c" );
+        Gia_AigerOutWriteSize( pOut, 4 );
+        Gia_AigerOutWriteSize( pOut, p->nConstrs );
     }
     // write timing information
     if ( p->nAnd2Delay )
     {
-        fprintf( pFile, "d" );
-        Gia_FileWriteBufferSize( pFile, 4 );
-        Gia_FileWriteBufferSize( pFile, p->nAnd2Delay );
+        Gia_AigerOutPrintf( pOut, "d" );
+        Gia_AigerOutWriteSize( pOut, 4 );
+        Gia_AigerOutWriteSize( pOut, p->nAnd2Delay );
     }
     if ( p->pManTime )
     {
@@ -1189,18 +1682,18 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         pTimes = Tim_ManGetArrTimes( (Tim_Man_t *)p->pManTime );
         if ( pTimes )
         {
-            fprintf( pFile, "i" );
-            Gia_FileWriteBufferSize( pFile, 4*Tim_ManPiNum((Tim_Man_t *)p->pManTime) );
-            fwrite( pTimes, 1, 4*Tim_ManPiNum((Tim_Man_t *)p->pManTime), pFile );
+            Gia_AigerOutPrintf( pOut, "i" );
+            Gia_AigerOutWriteSize( pOut, 4*Tim_ManPiNum((Tim_Man_t *)p->pManTime) );
+            Gia_AigerOutWrite( pOut, pTimes, 4*Tim_ManPiNum((Tim_Man_t *)p->pManTime) );
             ABC_FREE( pTimes );
             if ( fVerbose ) printf( "Finished writing extension \"i\".\n" );
         }
         pTimes = Tim_ManGetReqTimes( (Tim_Man_t *)p->pManTime );
         if ( pTimes )
         {
-            fprintf( pFile, "o" );
-            Gia_FileWriteBufferSize( pFile, 4*Tim_ManPoNum((Tim_Man_t *)p->pManTime) );
-            fwrite( pTimes, 1, 4*Tim_ManPoNum((Tim_Man_t *)p->pManTime), pFile );
+            Gia_AigerOutPrintf( pOut, "o" );
+            Gia_AigerOutWriteSize( pOut, 4*Tim_ManPoNum((Tim_Man_t *)p->pManTime) );
+            Gia_AigerOutWrite( pOut, pTimes, 4*Tim_ManPoNum((Tim_Man_t *)p->pManTime) );
             ABC_FREE( pTimes );
             if ( fVerbose ) printf( "Finished writing extension \"o\".\n" );
         }
@@ -1209,35 +1702,35 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
     if ( p->pReprs && p->pNexts )
     {
         extern Vec_Str_t * Gia_WriteEquivClasses( Gia_Man_t * p );
-        fprintf( pFile, "e" );
+        Gia_AigerOutPrintf( pOut, "e" );
         vStrExt = Gia_WriteEquivClasses( p );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutWriteSize( pOut, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pOut, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
     }
     // write flop classes
     if ( p->vFlopClasses )
     {
-        fprintf( pFile, "f" );
-        Gia_FileWriteBufferSize( pFile, 4*Gia_ManRegNum(p) );
+        Gia_AigerOutPrintf( pOut, "f" );
+        Gia_AigerOutWriteSize( pOut, 4*Gia_ManRegNum(p) );
         assert( Vec_IntSize(p->vFlopClasses) == Gia_ManRegNum(p) );
-        fwrite( Vec_IntArray(p->vFlopClasses), 1, 4*Gia_ManRegNum(p), pFile );
+        Gia_AigerOutWrite( pOut, Vec_IntArray(p->vFlopClasses), 4*Gia_ManRegNum(p) );
     }
     // write gate classes
     if ( p->vGateClasses )
     {
-        fprintf( pFile, "g" );
-        Gia_FileWriteBufferSize( pFile, 4*Gia_ManObjNum(p) );
+        Gia_AigerOutPrintf( pOut, "g" );
+        Gia_AigerOutWriteSize( pOut, 4*Gia_ManObjNum(p) );
         assert( Vec_IntSize(p->vGateClasses) == Gia_ManObjNum(p) );
-        fwrite( Vec_IntArray(p->vGateClasses), 1, 4*Gia_ManObjNum(p), pFile );
+        Gia_AigerOutWrite( pOut, Vec_IntArray(p->vGateClasses), 4*Gia_ManObjNum(p) );
     }
     // write hierarchy info
     if ( p->pManTime )
     {
-        fprintf( pFile, "h" );
+        Gia_AigerOutPrintf( pOut, "h" );
         vStrExt = Tim_ManSave( (Tim_Man_t *)p->pManTime, 1 );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutWriteSize( pOut, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pOut, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
         if ( fVerbose ) printf( "Finished writing extension \"h\".\n" );
     }
@@ -1245,10 +1738,10 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
     if ( p->vPacking )
     {
         extern Vec_Str_t * Gia_WritePacking( Vec_Int_t * vPacking );
-        fprintf( pFile, "k" );
+        Gia_AigerOutPrintf( pOut, "k" );
         vStrExt = Gia_WritePacking( p->vPacking );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutWriteSize( pOut, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pOut, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
         if ( fVerbose ) printf( "Finished writing extension \"k\".\n" );
     }
@@ -1258,94 +1751,100 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         extern Vec_Str_t * Gia_AigerWriteMapping( Gia_Man_t * p );
         extern Vec_Str_t * Gia_AigerWriteMappingSimple( Gia_Man_t * p );
         extern Vec_Str_t * Gia_AigerWriteMappingDoc( Gia_Man_t * p );
-        fprintf( pFile, "m" );
+        Gia_AigerOutPrintf( pOut, "m" );
         vStrExt = Gia_AigerWriteMappingDoc( p );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutWriteSize( pOut, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pOut, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
         if ( fVerbose ) printf( "Finished writing extension \"m\".\n" );
     }
     // write placement
     if ( p->pPlacement )
     {
-        fprintf( pFile, "p" );
-        Gia_FileWriteBufferSize( pFile, 4*Gia_ManObjNum(p) );
-        fwrite( p->pPlacement, 1, 4*Gia_ManObjNum(p), pFile );
+        Gia_AigerOutPrintf( pOut, "p" );
+        Gia_AigerOutWriteSize( pOut, 4*Gia_ManObjNum(p) );
+        Gia_AigerOutWrite( pOut, p->pPlacement, 4*Gia_ManObjNum(p) );
     }
     // write register classes
     if ( p->vRegClasses )
     {
         int i;
-        fprintf( pFile, "r" );
-        Gia_FileWriteBufferSize( pFile, 4*(Vec_IntSize(p->vRegClasses)+1) );
-        Gia_FileWriteBufferSize( pFile, Vec_IntSize(p->vRegClasses) );
+        Gia_AigerOutPrintf( pOut, "r" );
+        Gia_AigerOutWriteSize( pOut, 4*(Vec_IntSize(p->vRegClasses)+1) );
+        Gia_AigerOutWriteSize( pOut, Vec_IntSize(p->vRegClasses) );
         for ( i = 0; i < Vec_IntSize(p->vRegClasses); i++ )
-            Gia_FileWriteBufferSize( pFile, Vec_IntEntry(p->vRegClasses, i) );
+            Gia_AigerOutWriteSize( pOut, Vec_IntEntry(p->vRegClasses, i) );
     }
     // write configuration data
     if ( p->vConfigs )
     {
-        fprintf( pFile, "b" );
+        Gia_AigerOutPrintf( pOut, "b" );
         assert( p->pCellStr != NULL );
-        Gia_FileWriteBufferSize( pFile, 4*Vec_IntSize(p->vConfigs) + strlen(p->pCellStr) + 1 );
-        fwrite( p->pCellStr, 1, strlen(p->pCellStr) + 1, pFile );
-        fwrite( Vec_IntArray(p->vConfigs), 1, 4*Vec_IntSize(p->vConfigs), pFile );
+        Gia_AigerOutWriteSize( pOut, 4*Vec_IntSize(p->vConfigs) + strlen(p->pCellStr) + 1 );
+        Gia_AigerOutWrite( pOut, p->pCellStr, strlen(p->pCellStr) + 1 );
+        Gia_AigerOutWrite( pOut, Vec_IntArray(p->vConfigs), 4*Vec_IntSize(p->vConfigs) );
     }
     // write choices
     if ( Gia_ManHasChoices(p) )
     {
         int i, nPairs = 0;
-        fprintf( pFile, "q" );
+        Gia_AigerOutPrintf( pOut, "q" );
         for ( i = 0; i < Gia_ManObjNum(p); i++ )
             nPairs += (Gia_ObjSibl(p, i) > 0);
-        Gia_FileWriteBufferSize( pFile, 4*(nPairs * 2 + 1) );
-        Gia_FileWriteBufferSize( pFile, nPairs );
+        Gia_AigerOutWriteSize( pOut, 4*(nPairs * 2 + 1) );
+        Gia_AigerOutWriteSize( pOut, nPairs );
         for ( i = 0; i < Gia_ManObjNum(p); i++ )
             if ( Gia_ObjSibl(p, i) )
             {
                 assert( i > Gia_ObjSibl(p, i) );
-                Gia_FileWriteBufferSize( pFile, i );
-                Gia_FileWriteBufferSize( pFile, Gia_ObjSibl(p, i) );
+                Gia_AigerOutWriteSize( pOut, i );
+                Gia_AigerOutWriteSize( pOut, Gia_ObjSibl(p, i) );
             }
         if ( fVerbose ) printf( "Finished writing extension \"q\".\n" );
     }
     // write switching activity
     if ( p->pSwitching )
     {
-        fprintf( pFile, "u" );
-        Gia_FileWriteBufferSize( pFile, Gia_ManObjNum(p) );
-        fwrite( p->pSwitching, 1, Gia_ManObjNum(p), pFile );
+        Gia_AigerOutPrintf( pOut, "u" );
+        Gia_AigerOutWriteSize( pOut, Gia_ManObjNum(p) );
+        Gia_AigerOutWrite( pOut, p->pSwitching, Gia_ManObjNum(p) );
     }
 /*
     // write timing information
     if ( p->pManTime )
     {
-        fprintf( pFile, "t" );
+        Gia_AigerOutPrintf( pOut, "t" );
         vStrExt = Tim_ManSave( (Tim_Man_t *)p->pManTime, 0 );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutWriteSize( pOut, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pOut, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
     }
 */
     // write object classes
     if ( p->vObjClasses )
     {
-        fprintf( pFile, "v" );
-        Gia_FileWriteBufferSize( pFile, 4*Gia_ManObjNum(p) );
+        Gia_AigerOutPrintf( pOut, "v" );
+        Gia_AigerOutWriteSize( pOut, 4*Gia_ManObjNum(p) );
         assert( Vec_IntSize(p->vObjClasses) == Gia_ManObjNum(p) );
-        fwrite( Vec_IntArray(p->vObjClasses), 1, 4*Gia_ManObjNum(p), pFile );
+        Gia_AigerOutWrite( pOut, Vec_IntArray(p->vObjClasses), 4*Gia_ManObjNum(p) );
     }
     // write name
     if ( p->pName )
     {
-        fprintf( pFile, "n" );
-        Gia_FileWriteBufferSize( pFile, strlen(p->pName)+1 );
-        fwrite( p->pName, 1, strlen(p->pName), pFile );
-        fprintf( pFile, "%c", '\0' );
+        Gia_AigerOutPrintf( pOut, "n" );
+        Gia_AigerOutWriteSize( pOut, strlen(p->pName)+1 );
+        Gia_AigerOutWrite( pOut, p->pName, strlen(p->pName) );
+        Gia_AigerOutPrintf( pOut, "%c", '\0' );
     }
     // write comments
-    fprintf( pFile, "\nThis file was produced by the GIA package in ABC on %s\n", Gia_TimeStamp() );
-    fprintf( pFile, "For information about AIGER format, refer to %s\n", "http://fmv.jku.at/aiger" );
+    Gia_AigerOutPrintf( pOut, "\nThis file was produced by the GIA package in ABC on %s\n", Gia_TimeStamp() );
+    Gia_AigerOutPrintf( pOut, "For information about AIGER format, refer to %s\n", "http://fmv.jku.at/aiger" );
+    if ( fPrintStats )
+    {
+        printf( "Written %.2f MB%s.  ", 1.0 * pOut->nBytes / (1 << 20), pOut->fGzip ? " (compressed)" : "" );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    Gia_AigerOutStop( pOut );
 	fclose( pFile );
     if ( p != pInit )
     {
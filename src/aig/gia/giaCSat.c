@@ -19,6 +19,8 @@
 ***********************************************************************/
 
 #include "gia.h"
+#include "misc/vec/vecWec.h"
+#include "misc/util/utilPth.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -46,7 +48,12 @@ struct Cbs_Par_t_
     int           fUseHighest;  // use node with the highest ID
     int           fUseLowest;   // use node with the highest ID
     int           fUseMaxFF;    // use node with the largest fanin fanout
+    // clause learning
+    int           fLearn;       // record conflict clauses and propagate them
+    int           nLearnSizeMax;// the max number of literals in a learned clause
+    int           nLearnMemMax; // the max number of integers used by learned clauses
     // other
+    volatile int * pStop;       // external stop flag raised by another thread
     int           fVerbose;
 };
 
@@ -71,6 +78,12 @@ struct Cbs_Man_t_
     Vec_Int_t *   vLevReas;     // levels and decisions
     Vec_Int_t *   vModel;       // satisfying assignment
     Vec_Ptr_t *   vTemp;        // temporary storage
+    // learned clauses
+    Vec_Int_t *   vLearned;     // learned clauses: (size, literals) with literal (ObjId, conflicting value)
+    Vec_Wec_t *   vWatches;     // learned clauses watching each literal
+    int           nLearned;     // the number of learned clauses
+    int           nLearnedProps;// the number of implications by learned clauses
+    int           nLearnedConfs;// the number of conflicts in learned clauses
     // SAT calls statistics
     int           nSatUnsat;    // the number of proofs
     int           nSatSat;      // the number of failure
@@ -99,8 +112,14 @@ static inline int   Cbs_VarFanin1Value( Gia_Obj_t * pVar )     { return !Cbs_Var
 static inline int         Cbs_VarDecLevel( Cbs_Man_t * p, Gia_Obj_t * pVar )  { assert( pVar->Value != ~0 ); return Vec_IntEntry(p->vLevReas, 3*pVar->Value);          }
 static inline Gia_Obj_t * Cbs_VarReason0( Cbs_Man_t * p, Gia_Obj_t * pVar )   { assert( pVar->Value != ~0 ); return pVar + Vec_IntEntry(p->vLevReas, 3*pVar->Value+1); }
 static inline Gia_Obj_t * Cbs_VarReason1( Cbs_Man_t * p, Gia_Obj_t * pVar )   { assert( pVar->Value != ~0 ); return pVar + Vec_IntEntry(p->vLevReas, 3*pVar->Value+2); }
+static inline int         Cbs_VarReasonCla( Cbs_Man_t * p, Gia_Obj_t * pVar ) { assert( pVar->Value != ~0 ); return Vec_IntEntry(p->vLevReas, 3*pVar->Value+1) ? 0 : Vec_IntEntry(p->vLevReas, 3*pVar->Value+2); }
 static inline int         Cbs_ClauseDecLevel( Cbs_Man_t * p, int hClause )    { return Cbs_VarDecLevel( p, p->pClauses.pData[hClause] );                               }
 
+static inline int *       Cbs_LearnedLits( Cbs_Man_t * p, int hLearn )        { return Vec_IntEntryP( p->vLearned, hLearn + 1 );                                     }
+static inline int         Cbs_LearnedSize( Cbs_Man_t * p, int hLearn )        { return Vec_IntEntry( p->vLearned, hLearn );                                          }
+static inline Gia_Obj_t * Cbs_LitVar( Cbs_Man_t * p, int Lit )                { return Gia_ManObj( p->pAig, Abc_Lit2Var(Lit) );                                      }
+static inline int         Cbs_LitValue( Cbs_Man_t * p, int Lit )              { Gia_Obj_t * pVar = Cbs_LitVar(p, Lit); return !Cbs_VarIsAssigned(pVar) ? 2 : Cbs_VarValue(pVar) != Abc_LitIsCompl(Lit); }
+
 #define Cbs_QueForEachEntry( Que, pObj, i )                         \
     for ( i = (Que).iHead; (i < (Que).iTail) && ((pObj) = (Que).pData[i]); i++ )
 
@@ -132,6 +151,9 @@ void Cbs_SetDefaultParams( Cbs_Par_t * pPars )
     pPars->fUseHighest =     1;   // use node with the highest ID
     pPars->fUseLowest  =     0;   // use node with the highest ID
     pPars->fUseMaxFF   =     0;   // use node with the largest fanin fanout
+    pPars->fLearn      =     0;   // record conflict clauses and propagate them
+    pPars->nLearnSizeMax =  50;   // the max number of literals in a learned clause
+    pPars->nLearnMemMax = 1000000; // the max number of integers used by learned clauses
     pPars->fVerbose    =     1;   // print detailed statistics
 }
 
@@ -158,6 +180,9 @@ Cbs_Man_t * Cbs_ManAlloc()
     p->vModel   = Vec_IntAlloc( 1000 );
     p->vLevReas = Vec_IntAlloc( 1000 );
     p->vTemp    = Vec_PtrAlloc( 1000 );
+    p->vLearned = Vec_IntAlloc( 1000 );
+    p->vWatches = Vec_WecAlloc( 0 );
+    Vec_IntPush( p->vLearned, 0 ); // clause handles are positive
     Cbs_SetDefaultParams( &p->Pars );
     return p;
 }
@@ -178,6 +203,8 @@ void Cbs_ManStop( Cbs_Man_t * p )
     Vec_IntFree( p->vLevReas );
     Vec_IntFree( p->vModel );
     Vec_PtrFree( p->vTemp );
+    Vec_IntFree( p->vLearned );
+    Vec_WecFree( p->vWatches );
     ABC_FREE( p->pClauses.pData );
     ABC_FREE( p->pProp.pData );
     ABC_FREE( p->pJust.pData );
@@ -216,7 +243,7 @@ Vec_Int_t * Cbs_ReadModel( Cbs_Man_t * p )
 ***********************************************************************/
 static inline int Cbs_ManCheckLimits( Cbs_Man_t * p )
 {
-    return p->Pars.nJustThis > p->Pars.nJustLimit || p->Pars.nBTThis > p->Pars.nBTLimit;
+    return p->Pars.nJustThis > p->Pars.nJustLimit || p->Pars.nBTThis > p->Pars.nBTLimit || (p->Pars.pStop && *p->Pars.pStop);
 }
 
 /**Function*************************************************************
@@ -507,6 +534,34 @@ static inline void Cbs_ManAssign( Cbs_Man_t * p, Gia_Obj_t * pObj, int Level, Gi
 //    s_Counter = Abc_MaxIntInt( s_Counter, Vec_IntSize(p->vLevReas)/3 );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Assigns the variables a value implied by a learned clause.]
+
+  Description [The first reason is zero, the second one is the clause.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Cbs_ManAssignLearned( Cbs_Man_t * p, Gia_Obj_t * pObj, int Level, int hLearn )
+{
+    Gia_Obj_t * pObjR = Gia_Regular(pObj);
+    assert( Gia_ObjIsCand(pObjR) );
+    assert( !Cbs_VarIsAssigned(pObjR) );
+    assert( hLearn > 0 );
+    Cbs_VarAssign( pObjR );
+    Cbs_VarSetValue( pObjR, !Gia_IsComplement(pObj) );
+    assert( pObjR->Value == ~0 );
+    pObjR->Value = p->pProp.iTail;
+    Cbs_QuePush( &p->pProp, pObjR );
+    Vec_IntPush( p->vLevReas, Level );
+    Vec_IntPush( p->vLevReas, 0 );
+    Vec_IntPush( p->vLevReas, hLearn );
+    assert( Vec_IntSize(p->vLevReas) == 3 * p->pProp.iTail );
+}
+
 
 /**Function*************************************************************
 
@@ -588,7 +643,7 @@ static inline void Cbs_ManDeriveReason( Cbs_Man_t * p, int Level )
 {
     Cbs_Que_t * pQue = &(p->pClauses);
     Gia_Obj_t * pObj, * pReason;
-    int i, k, iLitLevel;
+    int i, k, n, iLitLevel, hLearn;
     assert( pQue->pData[pQue->iHead] == NULL );
     assert( pQue->iHead + 1 < pQue->iTail );
 /*
@@ -616,6 +671,14 @@ static inline void Cbs_ManDeriveReason( Cbs_Man_t * p, int Level )
             continue;
         }
         assert( iLitLevel == Level );
+        if ( (hLearn = Cbs_VarReasonCla( p, pObj )) ) // learned clause
+        {
+            int * pLits = Cbs_LearnedLits( p, hLearn );
+            for ( n = 0; n < Cbs_LearnedSize( p, hLearn ); n++ )
+                if ( Cbs_LitVar(p, pLits[n]) != pObj )
+                    Cbs_QuePush( pQue, Cbs_LitVar(p, pLits[n]) );
+            continue;
+        }
         pReason = Cbs_VarReason0( p, pObj );
         if ( pReason == pObj ) // no reason
         {
@@ -635,6 +698,40 @@ static inline void Cbs_ManDeriveReason( Cbs_Man_t * p, int Level )
         pObj->fMark0 = 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Returns conflict clause.]
+
+  Description [Performs conflict analysis.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Cbs_ManLearnClause( Cbs_Man_t * p, int hClause )
+{
+    Gia_Obj_t * pObj;
+    int i, * pLits, hLearn, iMax = 1, LevelMax = -1;
+    int nLits = Cbs_ManClauseSize( p, hClause );
+    if ( !p->Pars.fLearn || nLits < 2 || nLits > p->Pars.nLearnSizeMax )
+        return;
+    hLearn = Vec_IntSize( p->vLearned );
+    Vec_IntPush( p->vLearned, nLits );
+    for ( i = 0; (pObj = p->pClauses.pData[hClause + i]); i++ )
+    {
+        Vec_IntPush( p->vLearned, Abc_Var2Lit(Gia_ObjId(p->pAig, pObj), Cbs_VarValue(pObj)) );
+        if ( i > 0 && LevelMax < Cbs_VarDecLevel(p, pObj) )
+            LevelMax = Cbs_VarDecLevel(p, pObj), iMax = i;
+    }
+    // watch the decision variable and the literal assigned last among the remaining ones
+    pLits = Cbs_LearnedLits( p, hLearn );
+    ABC_SWAP( int, pLits[1], pLits[iMax] );
+    Vec_WecPush( p->vWatches, pLits[0], hLearn );
+    Vec_WecPush( p->vWatches, pLits[1], hLearn );
+    p->nLearned++;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Returns conflict clause.]
@@ -649,6 +746,7 @@ static inline void Cbs_ManDeriveReason( Cbs_Man_t * p, int Level )
 static inline int Cbs_ManAnalyze( Cbs_Man_t * p, int Level, Gia_Obj_t * pVar, Gia_Obj_t * pFan0, Gia_Obj_t * pFan1 )
 {
     Cbs_Que_t * pQue = &(p->pClauses);
+    int hClause;
     assert( Cbs_VarIsAssigned(pVar) );
     assert( Cbs_VarIsAssigned(pFan0) );
     assert( pFan1 == NULL || Cbs_VarIsAssigned(pFan1) );
@@ -659,7 +757,39 @@ static inline int Cbs_ManAnalyze( Cbs_Man_t * p, int Level, Gia_Obj_t * pVar, Gi
     if ( pFan1 )
         Cbs_QuePush( pQue, pFan1 );
     Cbs_ManDeriveReason( p, Level );
-    return Cbs_QueFinish( pQue );
+    hClause = Cbs_QueFinish( pQue );
+    Cbs_ManLearnClause( p, hClause );
+    return hClause;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns conflict clause for the falsified learned clause.]
+
+  Description [Performs conflict analysis.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Cbs_ManAnalyzeLearned( Cbs_Man_t * p, int Level, int hLearn )
+{
+    Cbs_Que_t * pQue = &(p->pClauses);
+    int * pLits = Cbs_LearnedLits( p, hLearn );
+    int i, hClause;
+    assert( Cbs_QueIsEmpty( pQue ) );
+    Cbs_QuePush( pQue, NULL );
+    for ( i = 0; i < Cbs_LearnedSize( p, hLearn ); i++ )
+    {
+        assert( Cbs_LitValue(p, pLits[i]) == 0 );
+        Cbs_QuePush( pQue, Cbs_LitVar(p, pLits[i]) );
+    }
+    Cbs_ManDeriveReason( p, Level );
+    hClause = Cbs_QueFinish( pQue );
+    Cbs_ManLearnClause( p, hClause );
+    p->nLearnedConfs++;
+    return hClause;
 }
 
 
@@ -714,7 +844,9 @@ static inline int Cbs_ManResolve( Cbs_Man_t * p, int Level, int hClause0, int hC
     for ( i = pQue->iHead + 1; i < pQue->iTail; i++ )
         pQue->pData[i]->fMark0 = 1;
     Cbs_ManDeriveReason( p, LevelMax );
-    return Cbs_QueFinish( pQue );
+    i = Cbs_QueFinish( pQue );
+    Cbs_ManLearnClause( p, i );
+    return i;
 }
 
 /**Function*************************************************************
@@ -807,6 +939,66 @@ static inline int Cbs_ManPropagateTwo( Cbs_Man_t * p, Gia_Obj_t * pVar, int Leve
     return 0;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Propagates the learned clauses watching the variable.]
+
+  Description [Returns clause handle if conflict; 0 if no conflict.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Cbs_ManPropagateLearned( Cbs_Man_t * p, Gia_Obj_t * pVar, int Level )
+{
+    int iLit = Abc_Var2Lit( Gia_ObjId(p->pAig, pVar), Cbs_VarValue(pVar) );
+    Vec_Int_t * vWatch = Vec_WecEntry( p->vWatches, iLit );
+    int * pLits, i, j, k, hLearn, nLits;
+    for ( i = j = 0; i < Vec_IntSize(vWatch); i++ )
+    {
+        hLearn = Vec_IntEntry( vWatch, i );
+        pLits  = Cbs_LearnedLits( p, hLearn );
+        nLits  = Cbs_LearnedSize( p, hLearn );
+        // make sure the false literal is the second one
+        if ( pLits[0] == iLit )
+            pLits[0] = pLits[1], pLits[1] = iLit;
+        assert( pLits[1] == iLit );
+        // the clause is satisfied
+        if ( Cbs_LitValue(p, pLits[0]) == 1 )
+        {
+            Vec_IntWriteEntry( vWatch, j++, hLearn );
+            continue;
+        }
+        // look for a new literal to watch
+        for ( k = 2; k < nLits; k++ )
+            if ( Cbs_LitValue(p, pLits[k]) != 0 )
+                break;
+        if ( k < nLits )
+        {
+            pLits[1] = pLits[k];
+            pLits[k] = iLit;
+            Vec_WecPush( p->vWatches, pLits[1], hLearn );
+            continue;
+        }
+        Vec_IntWriteEntry( vWatch, j++, hLearn );
+        // the clause is unit
+        if ( Cbs_LitValue(p, pLits[0]) == 2 )
+        {
+            Cbs_ManAssignLearned( p, Gia_NotCond(Cbs_LitVar(p, pLits[0]), Abc_LitIsCompl(pLits[0])), Level, hLearn );
+            p->nLearnedProps++;
+            continue;
+        }
+        // the clause is in conflict
+        for ( i++; i < Vec_IntSize(vWatch); i++ )
+            Vec_IntWriteEntry( vWatch, j++, Vec_IntEntry(vWatch, i) );
+        Vec_IntShrink( vWatch, j );
+        return Cbs_ManAnalyzeLearned( p, Level, hLearn );
+    }
+    Vec_IntShrink( vWatch, j );
+    return 0;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Propagates all variables.]
@@ -829,6 +1021,8 @@ int Cbs_ManPropagate( Cbs_Man_t * p, int Level )
         {
             if ( (hClause = Cbs_ManPropagateOne( p, pVar, Level )) )
                 return hClause;
+            if ( p->nLearned && (hClause = Cbs_ManPropagateLearned( p, pVar, Level )) )
+                return hClause;
         }
         p->pProp.iHead = p->pProp.iTail;
         k = p->pJust.iHead;
@@ -916,6 +1110,43 @@ int Cbs_ManSolve_rec( Cbs_Man_t * p, int Level )
     return hClause;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Prepares the learned clauses for the next call.]
+
+  Description [Makes sure there is a watch list for each literal. 
+  If the learned clauses take too much memory, keeps the newer half.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cbs_ManReduceLearned( Cbs_Man_t * p )
+{
+    int * pLits, hLearn, hStart, nSize;
+    if ( Vec_WecSize(p->vWatches) < 2 * Gia_ManObjNum(p->pAig) )
+        Vec_WecInit( p->vWatches, 2 * Gia_ManObjNum(p->pAig) );
+    if ( Vec_IntSize(p->vLearned) < p->Pars.nLearnMemMax )
+        return;
+    // skip the older half
+    nSize = Vec_IntSize(p->vLearned);
+    for ( hStart = 1; hStart < nSize / 2; hStart += 1 + Cbs_LearnedSize(p, hStart) );
+    // move the newer half to the beginning and watch the first two literals
+    memmove( Vec_IntArray(p->vLearned) + 1, Vec_IntArray(p->vLearned) + hStart, sizeof(int) * (nSize - hStart) );
+    Vec_IntShrink( p->vLearned, 1 + nSize - hStart );
+    Vec_WecClear( p->vWatches );
+    Vec_WecInit( p->vWatches, 2 * Gia_ManObjNum(p->pAig) );
+    p->nLearned = 0;
+    for ( hLearn = 1; hLearn < Vec_IntSize(p->vLearned); hLearn += 1 + Cbs_LearnedSize(p, hLearn) )
+    {
+        pLits = Cbs_LearnedLits( p, hLearn );
+        Vec_WecPush( p->vWatches, pLits[0], hLearn );
+        Vec_WecPush( p->vWatches, pLits[1], hLearn );
+        p->nLearned++;
+    }
+}
+
 /**Function*************************************************************
 
   Synopsis    [Looking for a satisfying assignment of the node.]
@@ -937,6 +1168,8 @@ int Cbs_ManSolve( Cbs_Man_t * p, Gia_Obj_t * pObj )
     assert( !p->pJust.iHead && !p->pJust.iTail );
     assert( p->pClauses.iHead == 1 && p->pClauses.iTail == 1 );
     p->Pars.nBTThis = p->Pars.nJustThis = p->Pars.nBTThisNc = 0;
+    if ( p->Pars.fLearn )
+        Cbs_ManReduceLearned( p );
     Cbs_ManAssign( p, pObj, 0, NULL, NULL );
     if ( !Cbs_ManSolve_rec(p, 0) && !Cbs_ManCheckLimits(p) )
         Cbs_ManSaveModel( p, p->vModel );
@@ -972,6 +1205,8 @@ void Cbs_ManSatPrintStats( Cbs_Man_t * p )
     printf( "Conf = %6d  ", p->Pars.nBTLimit );
     printf( "JustMax = %5d  ", p->Pars.nJustLimit );
     printf( "\n" );
+    if ( p->Pars.fLearn )
+        printf( "Learned clauses = %8d  Implications = %8d  Conflicts = %8d\n", p->nLearned, p->nLearnedProps, p->nLearnedConfs );
     printf( "Unsat calls %6d  (%6.2f %%)   Ave conf = %8.1f   ", 
         p->nSatUnsat, p->nSatTotal? 100.0*p->nSatUnsat/p->nSatTotal :0.0, p->nSatUnsat? 1.0*p->nConfUnsat/p->nSatUnsat :0.0 );
     ABC_PRTP( "Time", p->timeSatUnsat, p->timeTotal );
@@ -986,27 +1221,20 @@ void Cbs_ManSatPrintStats( Cbs_Man_t * p )
 
 /**Function*************************************************************
 
-  Synopsis    [Procedure to test the new SAT solver.]
+  Synopsis    [Prepares the AIG and starts the solver for it.]
 
-  Description []
+  Description [The solver keeps its state in the marks and values of 
+  the AIG objects, so each solver needs a separate copy of the AIG.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-Vec_Int_t * Cbs_ManSolveMiterNc( Gia_Man_t * pAig, int nConfs, Vec_Str_t ** pvStatus, int fVerbose )
+Cbs_Man_t * Cbs_ManStart( Gia_Man_t * pAig, int nConfs, volatile int * pStop )
 {
-    extern void Gia_ManCollectTest( Gia_Man_t * pAig );
-    extern void Cec_ManSatAddToStore( Vec_Int_t * vCexStore, Vec_Int_t * vCex, int Out );
     Cbs_Man_t * p; 
-    Vec_Int_t * vCex, * vVisit, * vCexStore;
-    Vec_Str_t * vStatus;
-    Gia_Obj_t * pRoot; 
-    int i, status;
-    abctime clk, clkTotal = Abc_Clock();
     assert( Gia_ManRegNum(pAig) == 0 );
-//    Gia_ManCollectTest( pAig );
     // prepare AIG
     Gia_ManCreateRefs( pAig );
     Gia_ManCleanMark0( pAig );
@@ -1016,69 +1244,104 @@ Vec_Int_t * Cbs_ManSolveMiterNc( Gia_Man_t * pAig, int nConfs, Vec_Str_t ** pvSt
     // create logic network
     p = Cbs_ManAlloc();
     p->Pars.nBTLimit = nConfs;
+    p->Pars.pStop    = pStop;
     p->pAig   = pAig;
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves one output of the miter.]
+
+  Description [Returns 1 if the output is constant 0, 0 if it is satisfiable
+  (the counter-example is in p->vModel), and -1 if undecided.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cbs_ManSolveOutput( Cbs_Man_t * p, Gia_Obj_t * pRoot )
+{
+    int status;
+    abctime clk;
+    Vec_IntClear( p->vModel );
+    if ( Gia_ObjIsConst0(Gia_ObjFanin0(pRoot)) )
+    {
+//        printf( "Constant %d output of SRM!!!\n", Gia_ObjFaninC0(pRoot) );
+        return !Gia_ObjFaninC0(pRoot); // the trivial counter-example is empty
+    }
+    clk = Abc_Clock();
+    p->Pars.fUseHighest = 1;
+    p->Pars.fUseLowest  = 0;
+    status = Cbs_ManSolve( p, Gia_ObjChild0(pRoot) );
+/*
+    if ( status == -1 )
+    {
+        p->Pars.fUseHighest = 0;
+        p->Pars.fUseLowest  = 1;
+        status = Cbs_ManSolve( p, Gia_ObjChild0(pRoot) );
+    }
+*/
+    if ( status == -1 )
+    {
+        p->nSatUndec++;
+        p->nConfUndec += p->Pars.nBTThis;
+        p->timeSatUndec += Abc_Clock() - clk;
+    }
+    else if ( status == 1 )
+    {
+        p->nSatUnsat++;
+        p->nConfUnsat += p->Pars.nBTThis;
+        p->timeSatUnsat += Abc_Clock() - clk;
+    }
+    else
+    {
+        p->nSatSat++;
+        p->nConfSat += p->Pars.nBTThis;
+//        Gia_SatVerifyPattern( p->pAig, pRoot, p->vModel, vVisit );
+        p->timeSatSat += Abc_Clock() - clk;
+    }
+    return status;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Procedure to test the new SAT solver.]
+
+  Description [The solver gives up when the flag pStop (if given) is raised.
+  If fLearn is set, conflict clauses are recorded and propagated.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Cbs_ManSolveMiterStop( Gia_Man_t * pAig, int nConfs, int fLearn, volatile int * pStop, Vec_Str_t ** pvStatus, int fVerbose )
+{
+    extern void Cec_ManSatAddToStore( Vec_Int_t * vCexStore, Vec_Int_t * vCex, int Out );
+    Cbs_Man_t * p; 
+    Vec_Int_t * vCex, * vCexStore;
+    Vec_Str_t * vStatus;
+    Gia_Obj_t * pRoot; 
+    int i, status;
+    abctime clkTotal = Abc_Clock();
+    p = Cbs_ManStart( pAig, nConfs, pStop );
+    p->Pars.fLearn = fLearn;
     // create resulting data-structures
     vStatus   = Vec_StrAlloc( Gia_ManPoNum(pAig) );
     vCexStore = Vec_IntAlloc( 10000 );
-    vVisit    = Vec_IntAlloc( 100 );
     vCex      = Cbs_ReadModel( p );
     // solve for each output
     Gia_ManForEachCo( pAig, pRoot, i )
     {
-//        printf( "\n" );
-
-        Vec_IntClear( vCex );
-        if ( Gia_ObjIsConst0(Gia_ObjFanin0(pRoot)) )
-        {
-            if ( Gia_ObjFaninC0(pRoot) )
-            {
-//                printf( "Constant 1 output of SRM!!!\n" );
-                Cec_ManSatAddToStore( vCexStore, vCex, i ); // trivial counter-example
-                Vec_StrPush( vStatus, 0 );
-            }
-            else
-            {
-//                printf( "Constant 0 output of SRM!!!\n" );
-                Vec_StrPush( vStatus, 1 );
-            }
-            continue;
-        }
-        clk = Abc_Clock();
-        p->Pars.fUseHighest = 1;
-        p->Pars.fUseLowest  = 0;
-        status = Cbs_ManSolve( p, Gia_ObjChild0(pRoot) );
-//        printf( "\n" );
-/*
-        if ( status == -1 )
-        {
-            p->Pars.fUseHighest = 0;
-            p->Pars.fUseLowest  = 1;
-            status = Cbs_ManSolve( p, Gia_ObjChild0(pRoot) );
-        }
-*/
+        status = Cbs_ManSolveOutput( p, pRoot );
         Vec_StrPush( vStatus, (char)status );
-        if ( status == -1 )
-        {
-            p->nSatUndec++;
-            p->nConfUndec += p->Pars.nBTThis;
+        if ( status == 0 )
+            Cec_ManSatAddToStore( vCexStore, vCex, i );
+        else if ( status == -1 )
             Cec_ManSatAddToStore( vCexStore, NULL, i ); // timeout
-            p->timeSatUndec += Abc_Clock() - clk;
-            continue;
-        }
-        if ( status == 1 )
-        {
-            p->nSatUnsat++;
-            p->nConfUnsat += p->Pars.nBTThis;
-            p->timeSatUnsat += Abc_Clock() - clk;
-            continue;
-        }
-        p->nSatSat++;
-        p->nConfSat += p->Pars.nBTThis;
-//        Gia_SatVerifyPattern( pAig, pRoot, vCex, vVisit );
-        Cec_ManSatAddToStore( vCexStore, vCex, i );
-        p->timeSatSat += Abc_Clock() - clk;
     }
-    Vec_IntFree( vVisit );
     p->nSatTotal = Gia_ManPoNum(pAig);
     p->timeTotal = Abc_Clock() - clkTotal;
     if ( fVerbose )
@@ -1093,6 +1356,166 @@ Vec_Int_t * Cbs_ManSolveMiterNc( Gia_Man_t * pAig, int nConfs, Vec_Str_t ** pvSt
     return vCexStore;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Procedure to test the new SAT solver.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Cbs_ManSolveMiterNc( Gia_Man_t * pAig, int nConfs, Vec_Str_t ** pvStatus, int fVerbose )
+{
+    return Cbs_ManSolveMiterStop( pAig, nConfs, 0, NULL, pvStatus, fVerbose );
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///                    MULTI-THREADED SOLVING                        ///
+////////////////////////////////////////////////////////////////////////
+
+typedef struct Cbs_ParMan_t_ Cbs_ParMan_t;
+struct Cbs_ParMan_t_
+{
+    Gia_Man_t *   pAig;         // the miter
+    int           nChunk;       // the number of outputs taken by a thread at a time
+    volatile int  iNext;        // the next output to be taken
+    char *        pStatus;      // the status of each output
+    Vec_Int_t **  pCexes;       // the counter-example of each satisfiable output
+    Cbs_Man_t *   pSolvers[UTIL_PROC_MAX]; // the solvers working on copies of the miter
+};
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the outputs taken from the shared queue.]
+
+  Description [Each thread grabs the next chunk of outputs until none 
+  are left, so faster threads take over the work of slower ones.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cbs_ManSolveMiterThread( void * pUser, int iThread )
+{
+    Cbs_ParMan_t * p = (Cbs_ParMan_t *)pUser;
+    Cbs_Man_t * pSolver = p->pSolvers[iThread];
+    int nOuts = Gia_ManCoNum(p->pAig);
+    int i, iStart, iStop, status;
+    abctime clkTotal = Abc_Clock();
+    while ( (iStart = Util_AtomicAdd(&p->iNext, p->nChunk)) < nOuts )
+    {
+        iStop = Abc_MinInt( iStart + p->nChunk, nOuts );
+        for ( i = iStart; i < iStop; i++ )
+        {
+            status = Cbs_ManSolveOutput( pSolver, Gia_ManCo(pSolver->pAig, i) );
+            p->pStatus[i] = (char)status;
+            if ( status == 0 )
+                p->pCexes[i] = Vec_IntDup( pSolver->vModel );
+            pSolver->nSatTotal++;
+        }
+    }
+    pSolver->timeTotal = Abc_Clock() - clkTotal;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the outputs of the miter using several threads.]
+
+  Description [Each thread runs its own solver on its own copy of the miter.
+  The results are merged in the order of outputs, so the status vector and 
+  the counter-example store have the same layout as in the single-threaded 
+  version. If learning is enabled, each solver accumulates learned clauses 
+  from the outputs it happened to take, so undecided outputs may differ 
+  from run to run.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Cbs_ManSolveMiterPar( Gia_Man_t * pAig, int nConfs, int nProcs, int fLearn, Vec_Str_t ** pvStatus, int fVerbose )
+{
+    extern void Cec_ManSatAddToStore( Vec_Int_t * vCexStore, Vec_Int_t * vCex, int Out );
+    Cbs_ParMan_t * p;
+    Cbs_Man_t * pSolver;
+    Util_Pool_t * pPool;
+    Vec_Int_t * vCexStore;
+    Vec_Str_t * vStatus;
+    int i, k, nOuts = Gia_ManCoNum(pAig);
+    abctime clkTotal = Abc_Clock();
+    assert( Gia_ManRegNum(pAig) == 0 );
+    nProcs = Abc_MinInt( nProcs, UTIL_PROC_MAX );
+    if ( nProcs <= 1 || nOuts < 2 * nProcs || !Util_PoolIsParallel() )
+        return Cbs_ManSolveMiterStop( pAig, nConfs, fLearn, NULL, pvStatus, fVerbose );
+    // start the threads on the copies of the miter
+    p = ABC_CALLOC( Cbs_ParMan_t, 1 );
+    p->pAig    = pAig;
+    p->nChunk  = Abc_MaxInt( 1, Abc_MinInt( 16, nOuts / (8 * nProcs) ) );
+    p->pStatus = ABC_ALLOC( char, nOuts );
+    p->pCexes  = ABC_CALLOC( Vec_Int_t *, nOuts );
+    for ( k = 0; k < nProcs; k++ )
+    {
+        p->pSolvers[k] = Cbs_ManStart( Gia_ManDup(pAig), nConfs, NULL );
+        p->pSolvers[k]->Pars.fLearn = fLearn;
+    }
+    pPool = Util_PoolStart( nProcs );
+    Util_PoolRun( pPool, Cbs_ManSolveMiterThread, p );
+    Util_PoolStop( pPool );
+    // merge the results in the order of outputs
+    vStatus   = Vec_StrAlloc( nOuts );
+    vCexStore = Vec_IntAlloc( 10000 );
+    for ( i = 0; i < nOuts; i++ )
+    {
+        Vec_StrPush( vStatus, p->pStatus[i] );
+        if ( p->pStatus[i] == 0 )
+            Cec_ManSatAddToStore( vCexStore, p->pCexes[i], i );
+        else if ( p->pStatus[i] == -1 )
+            Cec_ManSatAddToStore( vCexStore, NULL, i ); // timeout
+        Vec_IntFreeP( &p->pCexes[i] );
+    }
+    // collect the statistics in the first solver
+    pSolver = p->pSolvers[0];
+    for ( k = 1; k < nProcs; k++ )
+    {
+        Cbs_Man_t * pThis = p->pSolvers[k];
+        pSolver->nLearned      += pThis->nLearned;
+        pSolver->nLearnedProps += pThis->nLearnedProps;
+        pSolver->nLearnedConfs += pThis->nLearnedConfs;
+        pSolver->nSatUnsat     += pThis->nSatUnsat;
+        pSolver->nSatSat       += pThis->nSatSat;
+        pSolver->nSatUndec     += pThis->nSatUndec;
+        pSolver->nSatTotal     += pThis->nSatTotal;
+        pSolver->nConfUnsat    += pThis->nConfUnsat;
+        pSolver->nConfSat      += pThis->nConfSat;
+        pSolver->nConfUndec    += pThis->nConfUndec;
+        pSolver->timeSatUnsat  += pThis->timeSatUnsat;
+        pSolver->timeSatSat    += pThis->timeSatSat;
+        pSolver->timeSatUndec  += pThis->timeSatUndec;
+        pSolver->timeTotal     += pThis->timeTotal;
+    }
+    if ( fVerbose )
+    {
+        printf( "Solved %d outputs using %d threads (%d outputs at a time).  ", nOuts, nProcs, p->nChunk );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clkTotal );
+        Cbs_ManSatPrintStats( pSolver );
+    }
+    for ( k = 0; k < nProcs; k++ )
+    {
+        Gia_ManStop( p->pSolvers[k]->pAig );
+        Cbs_ManStop( p->pSolvers[k] );
+    }
+    ABC_FREE( p->pStatus );
+    ABC_FREE( p->pCexes );
+    ABC_FREE( p );
+    *pvStatus = vStatus;
+    return vCexStore;
+}
+
 
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
@@ -0,0 +1,656 @@
+/**CFile****************************************************************
+
+  FileName    [giaCnf.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Fast structural CNF generation without conversion to AIG.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: giaCnf.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+#include "sat/cnf/cnf.h"
+#include "bool/kit/kit.h"
+#include "misc/util/utilPth.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// This is a port of Cnf_DeriveFast() from "sat/cnf/cnfFast.c" to GIA.
+// The nodes are marked as in Cnf_DeriveFastMark() (fMark0 plays the role
+// of fMarkA and fMark1 that of fMarkB), after which each unmarked node
+// belongs to the cone of exactly one marked node. The cones are processed
+// independently, which allows for deriving their clauses on several threads.
+// The field Value of a node inside a cone is only touched by the thread
+// processing this cone, while the marked leaves are never written.
+
+typedef struct Gia_CnfPar_t_ Gia_CnfPar_t;
+struct Gia_CnfPar_t_
+{
+    Gia_Man_t *   p;            // the AIG
+    Vec_Int_t *   vMap;         // mapping of objects into CNF variables
+    Vec_Int_t *   vRoots;       // marked nodes in the order of clause generation
+    int           nChunk;       // the number of roots in one chunk
+    int           nChunks;      // the number of chunks
+    volatile int  iNext;        // the next chunk to be taken
+    Vec_Int_t **  pvLits;       // literals of each chunk
+    Vec_Int_t **  pvClas;       // clause beginnings of each chunk
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Detects multi-input gate rooted at this node.]
+
+  Description [If fStopCompl is set, stops at complemented edges and
+  collects literals; otherwise, collects object IDs.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_CnfCollectLeaves_rec( Gia_Man_t * p, int iRoot, int iLit, Vec_Int_t * vSuper, int fStopCompl )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p, Abc_Lit2Var(iLit) );
+    if ( Abc_Lit2Var(iLit) != iRoot && (pObj->fMark0 || (fStopCompl && Abc_LitIsCompl(iLit))) )
+    {
+        Vec_IntPushUnique( vSuper, fStopCompl ? iLit : Abc_Lit2Var(iLit) );
+        return;
+    }
+    assert( Gia_ObjIsAnd(pObj) );
+    if ( fStopCompl )
+    {
+        Gia_CnfCollectLeaves_rec( p, iRoot, Gia_ObjFaninLit0(pObj, Abc_Lit2Var(iLit)), vSuper, 1 );
+        Gia_CnfCollectLeaves_rec( p, iRoot, Gia_ObjFaninLit1(pObj, Abc_Lit2Var(iLit)), vSuper, 1 );
+    }
+    else
+    {
+        Gia_CnfCollectLeaves_rec( p, iRoot, Abc_Var2Lit(Gia_ObjFaninId0(pObj, Abc_Lit2Var(iLit)), 0), vSuper, 0 );
+        Gia_CnfCollectLeaves_rec( p, iRoot, Abc_Var2Lit(Gia_ObjFaninId1(pObj, Abc_Lit2Var(iLit)), 0), vSuper, 0 );
+    }
+}
+void Gia_CnfCollectLeaves( Gia_Man_t * p, int iRoot, Vec_Int_t * vSuper, int fStopCompl )
+{
+    Vec_IntClear( vSuper );
+    Gia_CnfCollectLeaves_rec( p, iRoot, Abc_Var2Lit(iRoot, 0), vSuper, fStopCompl );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects nodes inside the cone.]
+
+  Description [The leaves are the marked nodes other than the root.
+  The visited nodes are labeled by writing the root ID into their Value.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_CnfCollectVolume_rec( Gia_Man_t * p, int iRoot, int iObj, Vec_Int_t * vNodes )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p, iObj );
+    if ( iObj != iRoot && pObj->fMark0 )
+        return;
+    if ( pObj->Value == (unsigned)iRoot )
+        return;
+    pObj->Value = iRoot;
+    assert( Gia_ObjIsAnd(pObj) );
+    Gia_CnfCollectVolume_rec( p, iRoot, Gia_ObjFaninId0(pObj, iObj), vNodes );
+    Gia_CnfCollectVolume_rec( p, iRoot, Gia_ObjFaninId1(pObj, iObj), vNodes );
+    Vec_IntPush( vNodes, iObj );
+}
+void Gia_CnfCollectVolume( Gia_Man_t * p, int iRoot, Vec_Int_t * vNodes )
+{
+    Vec_IntClear( vNodes );
+    Gia_CnfCollectVolume_rec( p, iRoot, iRoot, vNodes );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derive truth table.]
+
+  Description [Uses the caller's simulation storage instead of static data.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline word Gia_CnfObjTruth( Gia_Man_t * p, int iObj, Vec_Int_t * vLeaves, Vec_Wrd_t * vSims )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p, iObj );
+    return Vec_WrdEntry( vSims, pObj->fMark0 ? Vec_IntFind(vLeaves, iObj) : (int)pObj->Value );
+}
+word Gia_CnfCutDeriveTruth( Gia_Man_t * p, Vec_Int_t * vLeaves, Vec_Int_t * vNodes, Vec_Wrd_t * vSims )
+{
+    static word Truth6[6] = {
+        ABC_CONST(0xAAAAAAAAAAAAAAAA),
+        ABC_CONST(0xCCCCCCCCCCCCCCCC),
+        ABC_CONST(0xF0F0F0F0F0F0F0F0),
+        ABC_CONST(0xFF00FF00FF00FF00),
+        ABC_CONST(0xFFFF0000FFFF0000),
+        ABC_CONST(0xFFFFFFFF00000000)
+    };
+    static word C[2] = { 0, ~(word)0 };
+    Gia_Obj_t * pObj;
+    int i, iObj;
+    assert( Vec_IntSize(vLeaves) <= 6 && Vec_IntSize(vNodes) > 0 );
+    Vec_WrdClear( vSims );
+    for ( i = 0; i < Vec_IntSize(vLeaves); i++ )
+        Vec_WrdPush( vSims, Truth6[i] );
+    Vec_IntForEachEntry( vNodes, iObj, i )
+    {
+        pObj = Gia_ManObj( p, iObj );
+        pObj->Value = Vec_WrdSize( vSims );
+        Vec_WrdPush( vSims, (Gia_CnfObjTruth(p, Gia_ObjFaninId0(pObj, iObj), vLeaves, vSims) ^ C[Gia_ObjFaninC0(pObj)]) &
+                            (Gia_CnfObjTruth(p, Gia_ObjFaninId1(pObj, iObj), vLeaves, vSims) ^ C[Gia_ObjFaninC1(pObj)]) );
+    }
+    return Vec_WrdEntryLast( vSims );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds clauses of the cone rooted at the node.]
+
+  Description [Appends the literals to vLits and the clause beginnings
+  (offsets into vLits) to vClas.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Gia_CnfAddCubes( Vec_Int_t * vCover, Vec_Int_t * vLeaves, Vec_Int_t * vMap, int OutLit, Vec_Int_t * vLits, Vec_Int_t * vClas )
+{
+    int c, k, Cube;
+    Vec_IntForEachEntry( vCover, Cube, c )
+    {
+        Vec_IntPush( vClas, Vec_IntSize(vLits) );
+        Vec_IntPush( vLits, OutLit );
+        for ( k = 0; k < Vec_IntSize(vLeaves); k++, Cube >>= 2 )
+        {
+            if ( (Cube & 3) == 0 )
+                continue;
+            assert( (Cube & 3) != 3 );
+            Vec_IntPush( vLits, Abc_Var2Lit(Vec_IntEntry(vMap, Vec_IntEntry(vLeaves, k)), (Cube&3)!=1) );
+        }
+    }
+}
+void Gia_CnfComputeClauses( Gia_Man_t * p, int iRoot, Vec_Int_t * vLeaves, Vec_Int_t * vNodes, Vec_Int_t * vMap,
+                            Vec_Int_t * vCover, Vec_Wrd_t * vSims, Vec_Int_t * vLits, Vec_Int_t * vClas )
+{
+    Gia_Obj_t * pObj;
+    int k, iObj, iLit, OutLit, RetValue;
+    word Truth;
+    assert( Gia_ManObj(p, iRoot)->fMark0 );
+    OutLit = Abc_Var2Lit( Vec_IntEntry(vMap, iRoot), 0 );
+    // detect cone
+    Gia_CnfCollectLeaves( p, iRoot, vLeaves, 0 );
+    Gia_CnfCollectVolume( p, iRoot, vNodes );
+    assert( iRoot == Vec_IntEntryLast(vNodes) );
+    // check if this is an AND-gate
+    Vec_IntForEachEntry( vNodes, iObj, k )
+    {
+        pObj = Gia_ManObj( p, iObj );
+        if ( Gia_ObjFaninC0(pObj) && !Gia_ObjFanin0(pObj)->fMark0 )
+            break;
+        if ( Gia_ObjFaninC1(pObj) && !Gia_ObjFanin1(pObj)->fMark0 )
+            break;
+    }
+    if ( k == Vec_IntSize(vNodes) )
+    {
+        Gia_CnfCollectLeaves( p, iRoot, vLeaves, 1 );
+        // write big clause
+        Vec_IntPush( vClas, Vec_IntSize(vLits) );
+        Vec_IntPush( vLits, OutLit );
+        Vec_IntForEachEntry( vLeaves, iLit, k )
+            Vec_IntPush( vLits, Abc_Var2Lit(Vec_IntEntry(vMap, Abc_Lit2Var(iLit)), !Abc_LitIsCompl(iLit)) );
+        // write small clauses
+        Vec_IntForEachEntry( vLeaves, iLit, k )
+        {
+            Vec_IntPush( vClas, Vec_IntSize(vLits) );
+            Vec_IntPush( vLits, Abc_LitNot(OutLit) );
+            Vec_IntPush( vLits, Abc_Var2Lit(Vec_IntEntry(vMap, Abc_Lit2Var(iLit)), Abc_LitIsCompl(iLit)) );
+        }
+        return;
+    }
+    if ( Vec_IntSize(vLeaves) > 6 )
+        printf( "FastCnfGeneration:  Internal error!!!\n" );
+    assert( Vec_IntSize(vLeaves) <= 6 );
+
+    Truth = Gia_CnfCutDeriveTruth( p, vLeaves, vNodes, vSims );
+    if ( Truth == 0 || Truth == ~(word)0 )
+    {
+        Vec_IntPush( vClas, Vec_IntSize(vLits) );
+        Vec_IntPush( vLits, (Truth == 0) ? Abc_LitNot(OutLit) : OutLit );
+        return;
+    }
+
+    RetValue = Kit_TruthIsop( (unsigned *)&Truth, Vec_IntSize(vLeaves), vCover, 0 );
+    assert( RetValue >= 0 );
+    Gia_CnfAddCubes( vCover, vLeaves, vMap, OutLit, vLits, vClas );
+
+    Truth = ~Truth;
+
+    RetValue = Kit_TruthIsop( (unsigned *)&Truth, Vec_IntSize(vLeaves), vCover, 0 );
+    assert( RetValue >= 0 );
+    Gia_CnfAddCubes( vCover, vLeaves, vMap, Abc_LitNot(OutLit), vLits, vClas );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Marks AIG for CNF computation.]
+
+  Description [Follows Cnf_DeriveFastMark(). The constant node is marked
+  too, to serve as a leaf if the AIG is not structurally hashed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_CnfDeriveFastMark( Gia_Man_t * p )
+{
+    Vec_Int_t * vSupps, * vRefs;
+    Vec_Int_t * vLeaves, * vNodes;
+    Gia_Obj_t * pObj, * pObjC, * pObj0, * pObj1;
+    int i, k, iLit, iTemp, nFans, Counter;
+
+    vLeaves = Vec_IntAlloc( 100 );
+    vNodes  = Vec_IntAlloc( 100 );
+    vSupps  = Vec_IntStart( Gia_ManObjNum(p) );
+
+    // count references as done by the AIG manager
+    vRefs   = Vec_IntStart( Gia_ManObjNum(p) );
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        Vec_IntAddToEntry( vRefs, Gia_ObjFaninId0(pObj, i), 1 );
+        Vec_IntAddToEntry( vRefs, Gia_ObjFaninId1(pObj, i), 1 );
+    }
+    Gia_ManForEachCo( p, pObj, i )
+        Vec_IntAddToEntry( vRefs, Gia_ObjFaninId0p(p, pObj), 1 );
+
+    // mark CIs and the constant
+    Gia_ManConst0(p)->fMark0 = 1;
+    Gia_ManForEachCi( p, pObj, i )
+        pObj->fMark0 = 1;
+
+    // mark CO drivers
+    Gia_ManForEachCo( p, pObj, i )
+        Gia_ObjFanin0(pObj)->fMark0 = 1;
+
+    // mark MUX/XOR nodes
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        assert( !pObj->fMark1 );
+        if ( !Gia_ObjIsMuxType(pObj) )
+            continue;
+        pObj0 = Gia_ObjFanin0(pObj);
+        if ( pObj0->fMark1 || Vec_IntEntry(vRefs, Gia_ObjId(p, pObj0)) > 1 )
+            continue;
+        pObj1 = Gia_ObjFanin1(pObj);
+        if ( pObj1->fMark1 || Vec_IntEntry(vRefs, Gia_ObjId(p, pObj1)) > 1 )
+            continue;
+        // mark nodes
+        pObj->fMark1 = 1;
+        pObj0->fMark1 = 1;
+        pObj1->fMark1 = 1;
+        // mark inputs and outputs
+        pObj->fMark0 = 1;
+        Gia_ObjFanin0(pObj0)->fMark0 = 1;
+        Gia_ObjFanin1(pObj0)->fMark0 = 1;
+        Gia_ObjFanin0(pObj1)->fMark0 = 1;
+        Gia_ObjFanin1(pObj1)->fMark0 = 1;
+    }
+
+    // mark nodes with multiple fanouts and pointed to by complemented edges
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        // mark nodes with many fanouts
+        if ( Vec_IntEntry(vRefs, i) > 1 )
+            pObj->fMark0 = 1;
+        // mark nodes pointed to by a complemented edge
+        if ( Gia_ObjFaninC0(pObj) && !Gia_ObjFanin0(pObj)->fMark1 )
+            Gia_ObjFanin0(pObj)->fMark0 = 1;
+        if ( Gia_ObjFaninC1(pObj) && !Gia_ObjFanin1(pObj)->fMark1 )
+            Gia_ObjFanin1(pObj)->fMark0 = 1;
+    }
+
+    // compute supergate size for internal marked nodes
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        if ( !pObj->fMark0 )
+            continue;
+        if ( pObj->fMark1 )
+        {
+            if ( !Gia_ObjIsMuxType(pObj) )
+                continue;
+            pObjC = Gia_ObjRecognizeMux( pObj, &pObj1, &pObj0 );
+            pObj0 = Gia_Regular(pObj0);
+            pObj1 = Gia_Regular(pObj1);
+            assert( pObj0->fMark0 );
+            assert( pObj1->fMark0 );
+            nFans = 1 + (pObj0 == pObj1);
+            if ( !pObj0->fMark1 && Gia_ObjIsAnd(pObj0) && Vec_IntEntry(vRefs, Gia_ObjId(p, pObj0)) == nFans && Vec_IntEntry(vSupps, Gia_ObjId(p, pObj0)) < 3 )
+            {
+                pObj0->fMark0 = 0;
+                continue;
+            }
+            if ( !pObj1->fMark1 && Gia_ObjIsAnd(pObj1) && Vec_IntEntry(vRefs, Gia_ObjId(p, pObj1)) == nFans && Vec_IntEntry(vSupps, Gia_ObjId(p, pObj1)) < 3 )
+            {
+                pObj1->fMark0 = 0;
+                continue;
+            }
+            continue;
+        }
+
+        Gia_CnfCollectLeaves( p, i, vLeaves, 1 );
+        Vec_IntWriteEntry( vSupps, i, Vec_IntSize(vLeaves) );
+        if ( Vec_IntSize(vLeaves) >= 6 )
+            continue;
+        Vec_IntForEachEntry( vLeaves, iLit, k )
+        {
+            iTemp = Abc_Lit2Var( iLit );
+            assert( Gia_ManObj(p, iTemp)->fMark0 );
+            if ( Gia_ManObj(p, iTemp)->fMark1 || !Gia_ObjIsAnd(Gia_ManObj(p, iTemp)) || Vec_IntEntry(vRefs, iTemp) > 1 )
+                continue;
+            assert( Vec_IntEntry(vSupps, iTemp) > 0 );
+            if ( Vec_IntSize(vLeaves) - 1 + Vec_IntEntry(vSupps, iTemp) > 6 )
+                continue;
+            Gia_ManObj(p, iTemp)->fMark0 = 0;
+            Vec_IntWriteEntry( vSupps, i, 6 );
+            break;
+        }
+    }
+    Gia_ManCleanMark1( p );
+
+    // check CO drivers
+    Counter = 0;
+    Gia_ManForEachCo( p, pObj, i )
+        Counter += !Gia_ObjFanin0(pObj)->fMark0;
+    if ( Counter )
+    printf( "PO-driver rule is violated %d times.\n", Counter );
+
+    // check that the AND-gates are fine
+    Counter = 0;
+    Gia_ManFillValue( p );
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        if ( !pObj->fMark0 )
+            continue;
+        Gia_CnfCollectLeaves( p, i, vLeaves, 0 );
+        if ( Vec_IntSize(vLeaves) <= 6 )
+            continue;
+        Gia_CnfCollectVolume( p, i, vNodes );
+        Vec_IntForEachEntry( vNodes, iTemp, k )
+        {
+            Gia_Obj_t * pTemp = Gia_ManObj( p, iTemp );
+            if ( Gia_ObjFaninC0(pTemp) && !Gia_ObjFanin0(pTemp)->fMark0 )
+                Counter++;
+            if ( Gia_ObjFaninC1(pTemp) && !Gia_ObjFanin1(pTemp)->fMark0 )
+                Counter++;
+        }
+    }
+    if ( Counter )
+    printf( "AND-gate rule is violated %d times.\n", Counter );
+
+    Vec_IntFree( vLeaves );
+    Vec_IntFree( vNodes );
+    Vec_IntFree( vSupps );
+    Vec_IntFree( vRefs );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives clauses of the roots taken from the shared queue.]
+
+  Description [Each chunk of roots has its own storage for literals and
+  clauses, so the result does not depend on the thread scheduling.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_CnfDeriveFastThread( void * pUser, int iThread )
+{
+    Gia_CnfPar_t * p = (Gia_CnfPar_t *)pUser;
+    Vec_Int_t * vLeaves = Vec_IntAlloc( 100 );
+    Vec_Int_t * vNodes  = Vec_IntAlloc( 100 );
+    Vec_Int_t * vCover  = Vec_IntAlloc( 1 << 8 );
+    Vec_Wrd_t * vSims   = Vec_WrdAlloc( 256 );
+    int i, iChunk, iStop;
+    while ( (iChunk = Util_AtomicAdd(&p->iNext, 1)) < p->nChunks )
+    {
+        Vec_Int_t * vLits = p->pvLits[iChunk] = Vec_IntAlloc( 8 * p->nChunk );
+        Vec_Int_t * vClas = p->pvClas[iChunk] = Vec_IntAlloc( 4 * p->nChunk );
+        iStop = Abc_MinInt( (iChunk + 1) * p->nChunk, Vec_IntSize(p->vRoots) );
+        for ( i = iChunk * p->nChunk; i < iStop; i++ )
+            Gia_CnfComputeClauses( p->p, Vec_IntEntry(p->vRoots, i), vLeaves, vNodes, p->vMap, vCover, vSims, vLits, vClas );
+    }
+    Vec_IntFree( vLeaves );
+    Vec_IntFree( vNodes );
+    Vec_IntFree( vCover );
+    Vec_WrdFree( vSims );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives CNF from the marked AIG.]
+
+  Description [Assumes that marking is such that when we traverse from each
+  marked node, the logic cone has 6 inputs or less, or it is a multi-input AND.
+  The variables and clauses are ordered as in Cnf_DeriveFastClauses(), so the
+  result is the same for any number of threads.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Cnf_Dat_t * Gia_CnfDeriveFastClauses( Gia_Man_t * p, int nOutputs, int nProcs )
+{
+    Gia_CnfPar_t Par, * pPar = &Par;
+    Util_Pool_t * pPool;
+    Cnf_Dat_t * pCnf;
+    Vec_Int_t * vMap, * vRoots;
+    Gia_Obj_t * pObj;
+    int i, k, iObj, nVars, nLits, nClas, Entry, OutLit, DriLit;
+    int * pLits, ** pClas;
+
+    vMap  = Vec_IntStartFull( Gia_ManObjNum(p) );
+
+    // assign variables for the outputs
+    nVars = 1;
+    if ( nOutputs )
+    {
+        if ( Gia_ManRegNum(p) == 0 )
+        {
+            assert( nOutputs == Gia_ManCoNum(p) );
+            Gia_ManForEachCo( p, pObj, i )
+                Vec_IntWriteEntry( vMap, Gia_ObjId(p, pObj), nVars++ );
+        }
+        else
+        {
+            assert( nOutputs == Gia_ManRegNum(p) );
+            Gia_ManForEachRi( p, pObj, i )
+                Vec_IntWriteEntry( vMap, Gia_ObjId(p, pObj), nVars++ );
+        }
+    }
+    // assign variables to the internal nodes
+    vRoots = Vec_IntAlloc( Gia_ManAndNum(p) );
+    Gia_ManForEachAndReverse( p, pObj, i )
+        if ( pObj->fMark0 )
+        {
+            Vec_IntWriteEntry( vMap, i, nVars++ );
+            Vec_IntPush( vRoots, i );
+        }
+    // assign variables to the PIs and constant node
+    Gia_ManForEachCi( p, pObj, i )
+        Vec_IntWriteEntry( vMap, Gia_ObjId(p, pObj), nVars++ );
+    Vec_IntWriteEntry( vMap, 0, nVars++ );
+
+    // create clauses of the internal nodes
+    memset( pPar, 0, sizeof(Gia_CnfPar_t) );
+    pPar->p       = p;
+    pPar->vMap    = vMap;
+    pPar->vRoots  = vRoots;
+    nProcs = Abc_MinInt( nProcs, UTIL_PROC_MAX );
+    if ( nProcs <= 1 || Vec_IntSize(vRoots) < 1000 * nProcs || !Util_PoolIsParallel() )
+    {
+        pPar->nChunk  = Abc_MaxInt( Vec_IntSize(vRoots), 1 );
+        pPar->nChunks = 1;
+    }
+    else
+    {
+        pPar->nChunk  = Abc_MaxInt( Vec_IntSize(vRoots) / (16 * nProcs), 1000 );
+        pPar->nChunks = (Vec_IntSize(vRoots) + pPar->nChunk - 1) / pPar->nChunk;
+    }
+    pPar->pvLits  = ABC_CALLOC( Vec_Int_t *, pPar->nChunks );
+    pPar->pvClas  = ABC_CALLOC( Vec_Int_t *, pPar->nChunks );
+    Gia_ManFillValue( p );
+    if ( pPar->nChunks == 1 )
+        Gia_CnfDeriveFastThread( pPar, 0 );
+    else
+    {
+        pPool = Util_PoolStart( nProcs );
+        Util_PoolRun( pPool, Gia_CnfDeriveFastThread, pPar );
+        Util_PoolStop( pPool );
+    }
+
+    // count literals and clauses
+    nLits = nClas = 0;
+    for ( k = 0; k < pPar->nChunks; k++ )
+    {
+        nLits += Vec_IntSize( pPar->pvLits[k] );
+        nClas += Vec_IntSize( pPar->pvClas[k] );
+    }
+    nLits += Gia_ManCoNum(p) - nOutputs + 4 * nOutputs + 1;
+    nClas += Gia_ManCoNum(p) - nOutputs + 2 * nOutputs + 1;
+
+    // create structure
+    pCnf = ABC_CALLOC( Cnf_Dat_t, 1 );
+    pCnf->nVars     = nVars;
+    pCnf->nLiterals = nLits;
+    pCnf->nClauses  = nClas;
+    pCnf->pClauses  = pClas = ABC_ALLOC( int *, nClas + 1 );
+    pCnf->pClauses[0] = pLits = ABC_ALLOC( int, nLits );
+
+    // copy clauses of the internal nodes
+    for ( k = 0; k < pPar->nChunks; k++ )
+    {
+        Vec_IntForEachEntry( pPar->pvClas[k], Entry, i )
+            *pClas++ = pLits + Entry;
+        memcpy( pLits, Vec_IntArray(pPar->pvLits[k]), sizeof(int) * Vec_IntSize(pPar->pvLits[k]) );
+        pLits += Vec_IntSize( pPar->pvLits[k] );
+        Vec_IntFree( pPar->pvLits[k] );
+        Vec_IntFree( pPar->pvClas[k] );
+    }
+    ABC_FREE( pPar->pvLits );
+    ABC_FREE( pPar->pvClas );
+    Vec_IntFree( vRoots );
+
+    // create clauses for the outputs
+    Gia_ManForEachCo( p, pObj, i )
+    {
+        iObj   = Gia_ObjId( p, pObj );
+        DriLit = Abc_Var2Lit( Vec_IntEntry(vMap, Gia_ObjFaninId0(pObj, iObj)), Gia_ObjFaninC0(pObj) );
+        if ( i < Gia_ManCoNum(p) - nOutputs )
+        {
+            *pClas++ = pLits;
+            *pLits++ = DriLit;
+        }
+        else
+        {
+            OutLit = Abc_Var2Lit( Vec_IntEntry(vMap, iObj), 0 );
+            // first clause
+            *pClas++ = pLits;
+            *pLits++ = OutLit;
+            *pLits++ = Abc_LitNot(DriLit);
+            // second clause
+            *pClas++ = pLits;
+            *pLits++ = Abc_LitNot(OutLit);
+            *pLits++ = DriLit;
+        }
+    }
+
+    // write the constant literal
+    *pClas++ = pLits;
+    *pLits++ = Abc_Var2Lit( Vec_IntEntry(vMap, 0), 1 );
+    assert( pClas == pCnf->pClauses + nClas );
+    assert( pLits == pCnf->pClauses[0] + nLits );
+    pCnf->pClauses[nClas] = pLits;
+    pCnf->pVarNums = Vec_IntReleaseArray( vMap );
+    Vec_IntFree( vMap );
+    return pCnf;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Fast CNF computation.]
+
+  Description [Derives the same CNF as Cnf_DeriveFast() applied to the
+  result of Gia_ManToAigSimple(), except that the constant variable
+  stands for constant 0 rather than constant 1. The variables are indexed
+  by GIA object IDs and the field pMan of the resulting CNF is NULL.
+  The clauses are derived using nProcs threads.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Cnf_Dat_t * Gia_ManDeriveCnfFast( Gia_Man_t * p, int nOutputs, int nProcs, int fVerbose )
+{
+    Cnf_Dat_t * pCnf;
+    abctime clk = Abc_Clock();
+    assert( p->pMuxes == NULL );
+    assert( Gia_ManBufNum(p) == 0 );
+    Gia_ManCleanMark01( p );
+    Gia_CnfDeriveFastMark( p );
+    if ( fVerbose )
+        Abc_PrintTime( 1, "Marking", Abc_Clock() - clk );
+    clk = Abc_Clock();
+    pCnf = Gia_CnfDeriveFastClauses( p, nOutputs, nProcs );
+    Gia_ManCleanMark0( p );
+    if ( fVerbose )
+        Abc_PrintTime( 1, "Clauses", Abc_Clock() - clk );
+    return pCnf;
+}
+void Gia_ManDumpCnfFast( Gia_Man_t * p, char * pFileName, int nProcs, int fVerbose )
+{
+    abctime clk = Abc_Clock();
+    Cnf_Dat_t * pCnf;
+    pCnf = Gia_ManDeriveCnfFast( p, 0, nProcs, fVerbose );
+    Cnf_DataWriteIntoFile( pCnf, pFileName, 0, NULL, NULL );
+    printf( "CNF stats: Vars = %6d. Clauses = %7d. Literals = %8d. ", pCnf->nVars, pCnf->nClauses, pCnf->nLiterals );
+    Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    Cnf_DataFree( pCnf );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -19,6 +19,7 @@
 ***********************************************************************/
 
 #include "gia.h"
+#include "misc/util/utilPth.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -780,6 +781,225 @@ int Gia_ManHashAndMulti( Gia_Man_t * p, Vec_Int_t * vLits )
     return Vec_IntEntry(vLits, 0);
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Concurrent structural hashing.]
+
+  Description [The concurrent table uses open addressing with linear 
+  probing. Each entry is either 0 (empty), -1 (the node is being created 
+  by another thread), or the literal of the AND node. The entry is claimed
+  by compare-and-swap, after which the node is appended by atomically 
+  incrementing the object counter and the entry is published. The object 
+  storage is allocated upfront, so that the objects never move while 
+  the threads are running. Only AND nodes can be added concurrently; 
+  CIs and COs should be added by one thread before and after.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_ManHashParOne( int iLit0, int iLit1, int TableMask ) 
+{
+    unsigned Key = (unsigned)iLit0 * 0x9E3779B1 + (unsigned)iLit1 * 0x85EBCA77;
+    return (int)((Key ^ (Key >> 15)) & TableMask);
+}
+static inline int Gia_ManHashParAppendAnd( Gia_Man_t * p, int iLit0, int iLit1 )
+{
+    Gia_Obj_t * pObj;
+    int iObj = Util_AtomicAdd( &p->nObjs, 1 );
+    if ( iObj >= p->nObjsAlloc )
+        printf( "The limit on the number of nodes (%d) in concurrent hashing is reached. Quitting...\n", p->nObjsAlloc ), exit(1);
+    pObj = Gia_ManObj( p, iObj );
+    assert( iLit0 < iLit1 && Abc_Lit2Var(iLit1) < iObj );
+    pObj->iDiff0  = iObj - Abc_Lit2Var(iLit0);
+    pObj->fCompl0 = Abc_LitIsCompl(iLit0);
+    pObj->iDiff1  = iObj - Abc_Lit2Var(iLit1);
+    pObj->fCompl1 = Abc_LitIsCompl(iLit1);
+    return Abc_Var2Lit( iObj, 0 );
+}
+void Gia_ManHashParStart( Gia_Man_t * p, int nObjsMax )
+{
+    Gia_Obj_t * pObj;
+    int i, iPlace;
+    assert( p->pHTablePar == NULL );
+    assert( p->pMuxes == NULL && p->pFanData == NULL && !p->fSweeper );
+    if ( p->nObjsAlloc < nObjsMax )
+    {
+        p->pObjs = ABC_REALLOC( Gia_Obj_t, p->pObjs, nObjsMax );
+        memset( p->pObjs + p->nObjsAlloc, 0, sizeof(Gia_Obj_t) * (nObjsMax - p->nObjsAlloc) );
+        p->nObjsAlloc = nObjsMax;
+    }
+    p->nHTablePar = 1 << Abc_Base2Log( 2 * p->nObjsAlloc + 16 );
+    p->pHTablePar = ABC_CALLOC( int, p->nHTablePar );
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        iPlace = Gia_ManHashParOne( Gia_ObjFaninLit0(pObj, i), Gia_ObjFaninLit1(pObj, i), p->nHTablePar - 1 );
+        while ( p->pHTablePar[iPlace] )
+            iPlace = (iPlace + 1) & (p->nHTablePar - 1);
+        p->pHTablePar[iPlace] = Abc_Var2Lit( i, 0 );
+    }
+}
+void Gia_ManHashParStop( Gia_Man_t * p )
+{
+    ABC_FREE( p->pHTablePar );
+    p->nHTablePar = 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Hashes AND gate; can be called by several threads at once.]
+
+  Description [Requires Gia_ManHashParStart() to be called first.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManHashParAnd( Gia_Man_t * p, int iLit0, int iLit1 )
+{
+    Gia_Obj_t * pThis;
+    volatile int * pTable = p->pHTablePar;
+    int iPlace, Entry, iNode, TableMask = p->nHTablePar - 1;
+    assert( p->pHTablePar != NULL );
+    if ( iLit0 < 2 )
+        return iLit0 ? iLit1 : 0;
+    if ( iLit1 < 2 )
+        return iLit1 ? iLit0 : 0;
+    if ( iLit0 == iLit1 )
+        return iLit1;
+    if ( iLit0 == Abc_LitNot(iLit1) )
+        return 0;
+    if ( iLit0 > iLit1 )
+        iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1;
+    iPlace = Gia_ManHashParOne( iLit0, iLit1, TableMask );
+    while ( 1 )
+    {
+        Entry = Util_AtomicRead( pTable + iPlace );
+        if ( Entry == 0 )
+        {
+            if ( !Util_AtomicCas( pTable + iPlace, 0, -1 ) )
+                continue;
+            iNode = Gia_ManHashParAppendAnd( p, iLit0, iLit1 );
+            Util_AtomicWrite( pTable + iPlace, iNode );
+            return iNode;
+        }
+        if ( Entry == -1 ) // wait till the node is published
+            continue;
+        pThis = Gia_ManObj( p, Abc_Lit2Var(Entry) );
+        if ( Gia_ObjFaninLit0p(p, pThis) == iLit0 && Gia_ObjFaninLit1p(p, pThis) == iLit1 )
+            return Entry;
+        iPlace = (iPlace + 1) & TableMask;
+    }
+    assert( 0 );
+    return -1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Rehashes AIG using several threads.]
+
+  Description [The AND nodes are grouped by level. The nodes of each 
+  level are divided among the threads and hashed into the new manager 
+  concurrently. The resulting AIG is structurally the same as the one
+  produced by Gia_ManRehash() but the order of the nodes may differ
+  from run to run.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#define GIA_HASH_PAR_MIN 256
+typedef struct Gia_HashParData_t_
+{
+    Gia_Man_t * p;         // the old manager
+    Gia_Man_t * pNew;      // the new manager
+    int *       pNodes;    // the current level
+    int         nNodes;    // the number of nodes in the current level
+    int         nParts;    // the number of parts
+} Gia_HashParData_t;
+static void Gia_ManRehashParWorker( void * pUser, int iThread )
+{
+    Gia_HashParData_t * pData = (Gia_HashParData_t *)pUser;
+    int nPart = (pData->nNodes + pData->nParts - 1) / pData->nParts;
+    int k, kStop = Abc_MinInt( pData->nNodes, (iThread + 1) * nPart );
+    Gia_Obj_t * pObj;
+    for ( k = iThread * nPart; k < kStop; k++ )
+    {
+        pObj = Gia_ManObj( pData->p, pData->pNodes[k] );
+        pObj->Value = Gia_ManHashParAnd( pData->pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+    }
+}
+Gia_Man_t * Gia_ManRehashPar( Gia_Man_t * p, int nProcs, int fVerbose )
+{
+    Gia_HashParData_t Data, * pData = &Data;
+    Gia_Man_t * pNew, * pTemp;
+    Util_Pool_t * pPool;
+    Vec_Int_t * vNodes, * vStarts;
+    Gia_Obj_t * pObj;
+    int i, Level, nLevels;
+    abctime clk = Abc_Clock();
+    assert( p->pMuxes == NULL );
+    assert( nProcs >= 1 && nProcs <= UTIL_PROC_MAX );
+    // sort the nodes by level
+    nLevels = Gia_ManLevelNum( p );
+    vStarts = Vec_IntStart( nLevels + 2 );
+    Gia_ManForEachAnd( p, pObj, i )
+        Vec_IntAddToEntry( vStarts, Gia_ObjLevelId(p, i) + 1, 1 );
+    for ( Level = 1; Level <= nLevels + 1; Level++ )
+        Vec_IntAddToEntry( vStarts, Level, Vec_IntEntry(vStarts, Level - 1) );
+    vNodes = Vec_IntStart( Gia_ManAndNum(p) );
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        Level = Gia_ObjLevelId(p, i);
+        Vec_IntWriteEntry( vNodes, Vec_IntEntry(vStarts, Level), i );
+        Vec_IntAddToEntry( vStarts, Level, 1 );
+    }
+    // restore the beginnings of the levels
+    for ( Level = nLevels; Level > 0; Level-- )
+        Vec_IntWriteEntry( vStarts, Level, Vec_IntEntry(vStarts, Level - 1) );
+    Vec_IntWriteEntry( vStarts, 0, 0 );
+    // start the new manager
+    pNew = Gia_ManStart( Gia_ManObjNum(p) );
+    pNew->pName = Abc_UtilStrsav( p->pName );
+    pNew->pSpec = Abc_UtilStrsav( p->pSpec );
+    Gia_ManConst0(p)->Value = 0;
+    Gia_ManForEachCi( p, pObj, i )
+        pObj->Value = Gia_ManAppendCi( pNew );
+    Gia_ManHashParStart( pNew, Gia_ManObjNum(p) );
+    // hash the levels
+    pPool = Util_PoolStart( nProcs );
+    pData->p = p;
+    pData->pNew = pNew;
+    for ( Level = 1; Level <= nLevels; Level++ )
+    {
+        pData->pNodes = Vec_IntEntryP( vNodes, Vec_IntEntry(vStarts, Level) );
+        pData->nNodes = Vec_IntEntry(vStarts, Level + 1) - Vec_IntEntry(vStarts, Level);
+        pData->nParts = Abc_MinInt( nProcs, 1 + pData->nNodes / GIA_HASH_PAR_MIN );
+        if ( pData->nParts == 1 )
+            Gia_ManRehashParWorker( pData, 0 );
+        else
+            Util_PoolRun( pPool, Gia_ManRehashParWorker, pData );
+    }
+    Util_PoolStop( pPool );
+    Gia_ManHashParStop( pNew );
+    Gia_ManForEachCo( p, pObj, i )
+        pObj->Value = Gia_ManAppendCo( pNew, Gia_ObjFanin0Copy(pObj) );
+    Gia_ManSetRegNum( pNew, Gia_ManRegNum(p) );
+    Vec_IntFree( vNodes );
+    Vec_IntFree( vStarts );
+    if ( fVerbose )
+    {
+        printf( "Concurrent hashing with %d threads:  Levels = %d.  Nodes = %d -> %d.  ", nProcs, nLevels, Gia_ManAndNum(p), Gia_ManAndNum(pNew) );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    pNew = Gia_ManCleanup( pTemp = pNew );
+    Gia_ManStop( pTemp );
+    return pNew;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
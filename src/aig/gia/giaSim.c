@@ -19,6 +19,8 @@
 ***********************************************************************/
 
 #include "gia.h"
+#include "misc/util/utilSimd.h"
+#include "misc/util/utilPth.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -169,6 +171,7 @@ void Gia_ManSimSetDefaultParams( Gia_ParSim_t * p )
     p->nIters       =  32;    // the number of timeframes
     p->RandSeed     =   0;    // the seed to generate random numbers
     p->TimeLimit    =  60;    // time limit in seconds
+    p->nProcs       =   1;    // the number of simulation threads
     p->fCheckMiter  =   0;    // check if miter outputs are non-zero 
     p->fVerbose     =   0;    // enables verbose output
     p->iOutFail     =  -1;    // index of the failed output
@@ -273,9 +276,7 @@ static inline void Gia_ManSimInfoRandom( Gia_ManSim_t * p, unsigned * pInfo )
 ***********************************************************************/
 static inline void Gia_ManSimInfoZero( Gia_ManSim_t * p, unsigned * pInfo )
 {
-    int w;
-    for ( w = p->nWords-1; w >= 0; w-- )
-        pInfo[w] = 0;
+    Util_SimdFill( Util_SimdLevel(), pInfo, 0, p->nWords );
 }
 
 /**Function*************************************************************
@@ -291,10 +292,9 @@ static inline void Gia_ManSimInfoZero( Gia_ManSim_t * p, unsigned * pInfo )
 ***********************************************************************/
 static inline int Gia_ManSimInfoIsZero( Gia_ManSim_t * p, unsigned * pInfo )
 {
-    int w;
-    for ( w = 0; w < p->nWords; w++ )
-        if ( pInfo[w] )
-            return 32*w + Gia_WordFindFirstBit( pInfo[w] );
+    int w = Util_SimdFindNeq( Util_SimdLevel(), pInfo, 0, p->nWords );
+    if ( w >= 0 )
+        return 32*w + Gia_WordFindFirstBit( pInfo[w] );
     return -1;
 }
 
@@ -311,9 +311,7 @@ static inline int Gia_ManSimInfoIsZero( Gia_ManSim_t * p, unsigned * pInfo )
 ***********************************************************************/
 static inline void Gia_ManSimInfoOne( Gia_ManSim_t * p, unsigned * pInfo )
 {
-    int w;
-    for ( w = p->nWords-1; w >= 0; w-- )
-        pInfo[w] = ~0;
+    Util_SimdFill( Util_SimdLevel(), pInfo, ~0, p->nWords );
 }
 
 /**Function*************************************************************
@@ -329,9 +327,7 @@ static inline void Gia_ManSimInfoOne( Gia_ManSim_t * p, unsigned * pInfo )
 ***********************************************************************/
 static inline void Gia_ManSimInfoCopy( Gia_ManSim_t * p, unsigned * pInfo, unsigned * pInfo0 )
 {
-    int w;
-    for ( w = p->nWords-1; w >= 0; w-- )
-        pInfo[w] = pInfo0[w];
+    Util_SimdCopy( Util_SimdLevel(), pInfo, pInfo0, 0, p->nWords );
 }
 
 /**Function*************************************************************
@@ -345,13 +341,11 @@ static inline void Gia_ManSimInfoCopy( Gia_ManSim_t * p, unsigned * pInfo, unsig
   SeeAlso     []
 
 ***********************************************************************/
-static inline void Gia_ManSimulateCi( Gia_ManSim_t * p, Gia_Obj_t * pObj, int iCi )
+static inline void Gia_ManSimulateCi( Gia_ManSim_t * p, Gia_Obj_t * pObj, int iCi, int iWord, int nWords, int Level )
 {
-    unsigned * pInfo  = Gia_SimData( p, Gia_ObjValue(pObj) );
-    unsigned * pInfo0 = Gia_SimDataCi( p, iCi );
-    int w;
-    for ( w = p->nWords-1; w >= 0; w-- )
-        pInfo[w] = pInfo0[w];
+    unsigned * pInfo  = Gia_SimData( p, Gia_ObjValue(pObj) ) + iWord;
+    unsigned * pInfo0 = Gia_SimDataCi( p, iCi ) + iWord;
+    Util_SimdCopy( Level, pInfo, pInfo0, 0, nWords );
 }
 
 /**Function*************************************************************
@@ -365,17 +359,11 @@ static inline void Gia_ManSimulateCi( Gia_ManSim_t * p, Gia_Obj_t * pObj, int iC
   SeeAlso     []
 
 ***********************************************************************/
-static inline void Gia_ManSimulateCo( Gia_ManSim_t * p, int iCo, Gia_Obj_t * pObj )
+static inline void Gia_ManSimulateCo( Gia_ManSim_t * p, int iCo, Gia_Obj_t * pObj, int iWord, int nWords, int Level )
 {
-    unsigned * pInfo  = Gia_SimDataCo( p, iCo );
-    unsigned * pInfo0 = Gia_SimData( p, Gia_ObjDiff0(pObj) );
-    int w;
-    if ( Gia_ObjFaninC0(pObj) )
-        for ( w = p->nWords-1; w >= 0; w-- )
-            pInfo[w] = ~pInfo0[w];
-    else 
-        for ( w = p->nWords-1; w >= 0; w-- )
-            pInfo[w] = pInfo0[w];
+    unsigned * pInfo  = Gia_SimDataCo( p, iCo ) + iWord;
+    unsigned * pInfo0 = Gia_SimData( p, Gia_ObjDiff0(pObj) ) + iWord;
+    Util_SimdCopy( Level, pInfo, pInfo0, Gia_ObjFaninC0(pObj), nWords );
 }
 
 /**Function*************************************************************
@@ -389,30 +377,12 @@ static inline void Gia_ManSimulateCo( Gia_ManSim_t * p, int iCo, Gia_Obj_t * pOb
   SeeAlso     []
 
 ***********************************************************************/
-static inline void Gia_ManSimulateNode( Gia_ManSim_t * p, Gia_Obj_t * pObj )
+static inline void Gia_ManSimulateNode( Gia_ManSim_t * p, Gia_Obj_t * pObj, int iWord, int nWords, int Level )
 {
-    unsigned * pInfo  = Gia_SimData( p, Gia_ObjValue(pObj) );
-    unsigned * pInfo0 = Gia_SimData( p, Gia_ObjDiff0(pObj) );
-    unsigned * pInfo1 = Gia_SimData( p, Gia_ObjDiff1(pObj) );
-    int w;
-    if ( Gia_ObjFaninC0(pObj) )
-    {
-        if (  Gia_ObjFaninC1(pObj) )
-            for ( w = p->nWords-1; w >= 0; w-- )
-                pInfo[w] = ~(pInfo0[w] | pInfo1[w]);
-        else 
-            for ( w = p->nWords-1; w >= 0; w-- )
-                pInfo[w] = ~pInfo0[w] & pInfo1[w];
-    }
-    else 
-    {
-        if (  Gia_ObjFaninC1(pObj) )
-            for ( w = p->nWords-1; w >= 0; w-- )
-                pInfo[w] = pInfo0[w] & ~pInfo1[w];
-        else 
-            for ( w = p->nWords-1; w >= 0; w-- )
-                pInfo[w] = pInfo0[w] & pInfo1[w];
-    }
+    unsigned * pInfo  = Gia_SimData( p, Gia_ObjValue(pObj) ) + iWord;
+    unsigned * pInfo0 = Gia_SimData( p, Gia_ObjDiff0(pObj) ) + iWord;
+    unsigned * pInfo1 = Gia_SimData( p, Gia_ObjDiff1(pObj) ) + iWord;
+    Util_SimdAnd( Level, pInfo, pInfo0, pInfo1, Gia_ObjFaninC0(pObj), Gia_ObjFaninC1(pObj), nWords );
 }
 
 /**Function*************************************************************
@@ -463,43 +433,111 @@ void Gia_ManSimInfoTransfer( Gia_ManSim_t * p )
 
 /**Function*************************************************************
 
-  Synopsis    []
+  Synopsis    [Simulates one timeframe for the given range of words.]
 
-  Description []
+  Description [Ranges that do not overlap can be simulated concurrently
+  because each word of a pattern depends only on the same word of the
+  fanins.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void Gia_ManSimulateRound( Gia_ManSim_t * p )
+void Gia_ManSimulateRoundRange( Gia_ManSim_t * p, int iWord, int nWords )
 {
     Gia_Obj_t * pObj;
-    int i, iCis = 0, iCos = 0;
+    int i, iCis = 0, iCos = 0, Level = Util_SimdLevel();
     assert( p->pAig->nFront > 0 );
     assert( Gia_ManConst0(p->pAig)->Value == 0 );
-    Gia_ManSimInfoZero( p, Gia_SimData(p, 0) );
+    assert( iWord >= 0 && iWord + nWords <= p->nWords );
+    Util_SimdFill( Level, Gia_SimData(p, 0) + iWord, 0, nWords );
     Gia_ManForEachObj1( p->pAig, pObj, i )
     {
         if ( Gia_ObjIsAndOrConst0(pObj) )
         {
             assert( Gia_ObjValue(pObj) < p->pAig->nFront );
-            Gia_ManSimulateNode( p, pObj );
+            Gia_ManSimulateNode( p, pObj, iWord, nWords, Level );
         }
         else if ( Gia_ObjIsCo(pObj) )
         {
             assert( Gia_ObjValue(pObj) == GIA_NONE );
-            Gia_ManSimulateCo( p, iCos++, pObj );
+            Gia_ManSimulateCo( p, iCos++, pObj, iWord, nWords, Level );
         }
         else // if ( Gia_ObjIsCi(pObj) )
         {
             assert( Gia_ObjValue(pObj) < p->pAig->nFront );
-            Gia_ManSimulateCi( p, pObj, iCis++ );
+            Gia_ManSimulateCi( p, pObj, iCis++, iWord, nWords, Level );
         }
     }
     assert( Gia_ManCiNum(p->pAig) == iCis );
     assert( Gia_ManCoNum(p->pAig) == iCos );
 }
+void Gia_ManSimulateRound( Gia_ManSim_t * p )
+{
+    Gia_ManSimulateRoundRange( p, 0, p->nWords );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates one timeframe using a pool of threads.]
+
+  Description [The words of the patterns are divided into nParts slices
+  and each thread simulates the whole AIG for its slice. The slices are
+  multiples of the grain (except for the last one), which is the largest
+  power of two not exceeding nWords/nParts, capped at GIA_SIM_PAR_GRAIN
+  words (one cache line). Returning from Util_PoolRun() serves as the
+  barrier between timeframes.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#define GIA_SIM_PAR_GRAIN  16
+
+typedef struct Gia_SimParData_t_ Gia_SimParData_t;
+struct Gia_SimParData_t_
+{
+    Gia_ManSim_t *    p;
+    int               nParts;      // the number of slices
+    int               nGrain;      // the slice granularity in words
+};
+
+static inline int Gia_ManSimParGrain( int nWords, int nParts )
+{
+    int nGrain = 1;
+    while ( 2 * nGrain <= GIA_SIM_PAR_GRAIN && 2 * nGrain * nParts <= nWords )
+        nGrain *= 2;
+    return nGrain;
+}
+
+static void Gia_ManSimulateRoundWorker( void * pUser, int iThread )
+{
+    Gia_SimParData_t * pData = (Gia_SimParData_t *)pUser;
+    int nChunks = (pData->p->nWords + pData->nGrain - 1) / pData->nGrain;
+    int iStart, iStop;
+    if ( iThread >= pData->nParts )
+        return;
+    iStart = pData->nGrain * (iThread * nChunks / pData->nParts);
+    iStop  = pData->nGrain * ((iThread + 1) * nChunks / pData->nParts);
+    iStop  = Abc_MinInt( iStop, pData->p->nWords );
+    if ( iStart < iStop )
+        Gia_ManSimulateRoundRange( pData->p, iStart, iStop - iStart );
+}
+static void Gia_ManSimulateRoundPar( Gia_ManSim_t * p, Util_Pool_t * pPool, int nParts )
+{
+    Gia_SimParData_t Data, * pData = &Data;
+    if ( pPool == NULL || nParts == 1 )
+    {
+        Gia_ManSimulateRound( p );
+        return;
+    }
+    pData->p = p;
+    pData->nParts = nParts;
+    pData->nGrain = Gia_ManSimParGrain( p->nWords, nParts );
+    Util_PoolRun( pPool, Gia_ManSimulateRoundWorker, pData );
+}
 
 /**Function*************************************************************
 
@@ -599,8 +637,9 @@ int Gia_ManSimSimulate( Gia_Man_t * pAig, Gia_ParSim_t * pPars )
 {
     extern int Gia_ManSimSimulateEquiv( Gia_Man_t * pAig, Gia_ParSim_t * pPars );
     Gia_ManSim_t * p;
+    Util_Pool_t * pPool = NULL;
     abctime clkTotal = Abc_Clock();
-    int i, iOut, iPat, RetValue = 0;
+    int i, iOut, iPat, nParts, RetValue = 0;
     abctime nTimeToStop = pPars->TimeLimit ? pPars->TimeLimit * CLOCKS_PER_SEC + Abc_Clock(): 0;
     if ( pAig->pReprs && pAig->pNexts )
         return Gia_ManSimSimulateEquiv( pAig, pPars );
@@ -608,9 +647,20 @@ int Gia_ManSimSimulate( Gia_Man_t * pAig, Gia_ParSim_t * pPars )
     p = Gia_ManSimCreate( pAig, pPars );
     Gia_ManResetRandom( pPars );
     Gia_ManSimInfoInit( p );
+    // the random patterns are generated by the calling thread,
+    // so the results do not depend on the number of threads
+    nParts = Abc_MinInt( Abc_MaxInt(pPars->nProcs, 1), p->nWords );
+    if ( nParts < pPars->nProcs )
+        Abc_Print( 0, "Using %d threads because there are only %d words to simulate.\n", nParts, p->nWords );
+    if ( nParts > 1 && Gia_ManSimParGrain(p->nWords, nParts) < GIA_SIM_PAR_GRAIN )
+        Abc_Print( 0, "The slices of %d threads share cache lines; consider increasing the number of words (-W).\n", nParts );
+    if ( nParts > 1 )
+        pPool = Util_PoolStart( nParts );
+    if ( pPars->fVerbose && nParts > 1 )
+        Abc_Print( 1, "Simulating %d words using %d threads (grain of %d words).\n", p->nWords, nParts, Gia_ManSimParGrain(p->nWords, nParts) );
     for ( i = 0; i < pPars->nIters; i++ )
     {
-        Gia_ManSimulateRound( p );
+        Gia_ManSimulateRoundPar( p, pPool, nParts );
         if ( pPars->fVerbose )
         {
             Abc_Print( 1, "Frame %4d out of %4d and timeout %3d sec. ", i+1, pPars->nIters, pPars->TimeLimit );
@@ -646,6 +696,8 @@ int Gia_ManSimSimulate( Gia_Man_t * pAig, Gia_ParSim_t * pPars )
         if ( i < pPars->nIters - 1 )
             Gia_ManSimInfoTransfer( p );
     }
+    if ( pPool )
+        Util_PoolStop( pPool );
     Gia_ManSimDelete( p );
     if ( pAig->pCexSeq == NULL )
         Abc_Print( 1, "No bug detected after simulating %d frames with %d words.  ", i, pPars->nWords );
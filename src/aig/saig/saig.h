@@ -50,6 +50,8 @@ struct Sec_MtrStatus_t_
     int         iOut;         // the satisfied output
 }; 
  
+typedef struct Saig_Tsw_t_ Saig_Tsw_t;
+
 typedef struct Saig_ParBbr_t_ Saig_ParBbr_t;
 struct Saig_ParBbr_t_
 {
@@ -173,6 +175,13 @@ extern int               Saig_ManRetimeSteps( Aig_Man_t * p, int nSteps, int fFo
 extern void              Saig_ManReportUselessRegisters( Aig_Man_t * pAig );
 /*=== saigSimMv.c ==========================================================*/
 extern Vec_Ptr_t *       Saig_MvManSimulate( Aig_Man_t * pAig, int nFramesSymb, int nFramesSatur, int fVerbose, int fVeryVerbose );
+/*=== saigSimTer.c ==========================================================*/
+extern Saig_Tsw_t *      Saig_TswStart( Aig_Man_t * pAig, int nWordsMax );
+extern void              Saig_TswStop( Saig_Tsw_t * p );
+extern int               Saig_TswWordNum( Saig_Tsw_t * p );
+extern void              Saig_TswSetCone( Saig_Tsw_t * p, Vec_Int_t * vCiObjs, Vec_Int_t * vNodes, Vec_Int_t * vCoObjs );
+extern void              Saig_TswSimulate( Saig_Tsw_t * p, int nWords, Vec_Int_t * vCiVals, Vec_Wrd_t * vCiXs );
+extern void              Saig_TswCheckCos( Saig_Tsw_t * p, int nWords, Vec_Int_t * vCoVals, word * pRes );
 /*=== saigStrSim.c ==========================================================*/
 extern Vec_Int_t *       Saig_StrSimPerformMatching( Aig_Man_t * p0, Aig_Man_t * p1, int nDist, int fVerbose, Aig_Man_t ** ppMiter );
 /*=== saigSwitch.c ==========================================================*/
@@ -0,0 +1,268 @@
+/**CFile****************************************************************
+
+  FileName    [saigSimTer.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Sequential AIG package.]
+
+  Synopsis    [Bit-sliced ternary simulation.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: saigSimTer.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "saig.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// Each object of the cone has two rails of nWords words. A bit of the first 
+// rail is 1 if the object can take value 0 in this lane, and a bit of the 
+// second rail is 1 if it can take value 1. Binary values have exactly one 
+// rail bit set; the undefined value (X) has both of them set. The rails are 
+// indexed by the position of the object in the cone (the constant, the CIs,
+// the nodes, the COs), so the memory is proportional to the largest cone.
+
+struct Saig_Tsw_t_
+{
+    Aig_Man_t *      pAig;         // the AIG
+    int              nWordsMax;    // the max number of words per rail
+    int              nWords;       // the number of words per rail in the last simulation
+    // the current cone
+    int              nCis;         // the number of CIs
+    int              nNodes;       // the number of internal nodes
+    int              nCos;         // the number of COs
+    Vec_Int_t *      vObj2Pos;     // the position of each object in the cone
+    Vec_Int_t *      vFanins;      // the fanins of the nodes and the COs (position literals)
+    // simulation info
+    int              nSims;        // the number of words allocated
+    word *           pSims;        // simulation info for each object of the cone
+};
+
+static inline word * Saig_TswRail( Saig_Tsw_t * p, int Pos, int Rail )  { return p->pSims + (2 * Pos + Rail) * p->nWords; }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts bit-sliced ternary simulator.]
+
+  Description [Each lane of the simulation words can be assigned its own
+  set of undefined CIs, which allows for evaluating up to 64 * nWordsMax
+  ternary assignments in one pass over the logic cone. The memory is 
+  allocated when the cones are simulated.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Saig_Tsw_t * Saig_TswStart( Aig_Man_t * pAig, int nWordsMax )
+{
+    Saig_Tsw_t * p;
+    assert( nWordsMax > 0 );
+    p = ABC_CALLOC( Saig_Tsw_t, 1 );
+    p->pAig      = pAig;
+    p->nWordsMax = nWordsMax;
+    p->vObj2Pos  = Vec_IntAlloc( 0 );
+    p->vFanins   = Vec_IntAlloc( 0 );
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops bit-sliced ternary simulator.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Saig_TswStop( Saig_Tsw_t * p )
+{
+    Vec_IntFree( p->vObj2Pos );
+    Vec_IntFree( p->vFanins );
+    ABC_FREE( p->pSims );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the max number of simulation words.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Saig_TswWordNum( Saig_Tsw_t * p )
+{
+    return p->nWordsMax;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Sets the cone to be simulated.]
+
+  Description [The cone is given by its CIs (vCiObjs), internal nodes in
+  a topological order (vNodes) and COs (vCoObjs), as object IDs. The 
+  fanins of the nodes and the COs should belong to the cone.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Saig_TswSetCone( Saig_Tsw_t * p, Vec_Int_t * vCiObjs, Vec_Int_t * vNodes, Vec_Int_t * vCoObjs )
+{
+    Aig_Obj_t * pObj;
+    int i, nPos = 1;
+    Vec_IntFillExtra( p->vObj2Pos, Aig_ManObjNumMax(p->pAig), -1 );
+    Vec_IntWriteEntry( p->vObj2Pos, Aig_ObjId(Aig_ManConst1(p->pAig)), 0 );
+    Aig_ManForEachObjVec( vCiObjs, p->pAig, pObj, i )
+        Vec_IntWriteEntry( p->vObj2Pos, Aig_ObjId(pObj), nPos++ );
+    Vec_IntClear( p->vFanins );
+    Aig_ManForEachObjVec( vNodes, p->pAig, pObj, i )
+    {
+        assert( Aig_ObjIsNode(pObj) );
+        Vec_IntPush( p->vFanins, Abc_Var2Lit(Vec_IntEntry(p->vObj2Pos, Aig_ObjFaninId0(pObj)), Aig_ObjFaninC0(pObj)) );
+        Vec_IntPush( p->vFanins, Abc_Var2Lit(Vec_IntEntry(p->vObj2Pos, Aig_ObjFaninId1(pObj)), Aig_ObjFaninC1(pObj)) );
+        Vec_IntWriteEntry( p->vObj2Pos, Aig_ObjId(pObj), nPos++ );
+    }
+    Aig_ManForEachObjVec( vCoObjs, p->pAig, pObj, i )
+    {
+        assert( Aig_ObjIsCo(pObj) );
+        Vec_IntPush( p->vFanins, Abc_Var2Lit(Vec_IntEntry(p->vObj2Pos, Aig_ObjFaninId0(pObj)), Aig_ObjFaninC0(pObj)) );
+    }
+    p->nCis   = Vec_IntSize(vCiObjs);
+    p->nNodes = Vec_IntSize(vNodes);
+    p->nCos   = Vec_IntSize(vCoObjs);
+    // allocate simulation info for the largest cone
+    nPos = 1 + p->nCis + p->nNodes + p->nCos;
+    if ( p->nSims < 2 * p->nWordsMax * nPos )
+    {
+        p->nSims = 2 * p->nWordsMax * nPos;
+        p->pSims = ABC_REALLOC( word, p->pSims, p->nSims );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates the cone in all lanes.]
+
+  Description [CI i of the cone has binary value vCiVals[i] in the lanes, 
+  in which its mask in vCiXs (stored as nWords words starting from entry 
+  i * nWords) is 0, and the undefined value in the lanes, in which the 
+  mask is 1.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Saig_TswSimulate( Saig_Tsw_t * p, int nWords, Vec_Int_t * vCiVals, Vec_Wrd_t * vCiXs )
+{
+    word * pSim0, * pSim1, * pFan00, * pFan01, * pFan10, * pFan11, * pMask;
+    int * pFanins = Vec_IntArray( p->vFanins );
+    int i, w, Pos = 0;
+    assert( nWords > 0 && nWords <= p->nWordsMax );
+    assert( Vec_IntSize(vCiVals) == p->nCis );
+    assert( Vec_WrdSize(vCiXs) >= nWords * p->nCis );
+    p->nWords = nWords;
+    // set the constant
+    pSim0 = Saig_TswRail( p, Pos, 0 );
+    pSim1 = Saig_TswRail( p, Pos++, 1 );
+    for ( w = 0; w < nWords; w++ )
+        pSim0[w] = 0, pSim1[w] = ~(word)0;
+    // set the CIs
+    for ( i = 0; i < p->nCis; i++ )
+    {
+        pSim0 = Saig_TswRail( p, Pos, 0 );
+        pSim1 = Saig_TswRail( p, Pos++, 1 );
+        pMask = Vec_WrdEntryP( vCiXs, i * nWords );
+        if ( Vec_IntEntry(vCiVals, i) )
+            for ( w = 0; w < nWords; w++ )
+                pSim0[w] = pMask[w], pSim1[w] = ~(word)0;
+        else
+            for ( w = 0; w < nWords; w++ )
+                pSim0[w] = ~(word)0, pSim1[w] = pMask[w];
+    }
+    // simulate the nodes
+    for ( i = 0; i < p->nNodes; i++, pFanins += 2 )
+    {
+        pSim0  = Saig_TswRail( p, Pos, 0 );
+        pSim1  = Saig_TswRail( p, Pos++, 1 );
+        pFan00 = Saig_TswRail( p, Abc_Lit2Var(pFanins[0]),  Abc_LitIsCompl(pFanins[0]) );
+        pFan01 = Saig_TswRail( p, Abc_Lit2Var(pFanins[0]), !Abc_LitIsCompl(pFanins[0]) );
+        pFan10 = Saig_TswRail( p, Abc_Lit2Var(pFanins[1]),  Abc_LitIsCompl(pFanins[1]) );
+        pFan11 = Saig_TswRail( p, Abc_Lit2Var(pFanins[1]), !Abc_LitIsCompl(pFanins[1]) );
+        for ( w = 0; w < nWords; w++ )
+        {
+            pSim0[w] = pFan00[w] | pFan10[w];
+            pSim1[w] = pFan01[w] & pFan11[w];
+        }
+    }
+    // transfer to the COs
+    for ( i = 0; i < p->nCos; i++, pFanins++ )
+    {
+        pSim0  = Saig_TswRail( p, Pos, 0 );
+        pSim1  = Saig_TswRail( p, Pos++, 1 );
+        pFan00 = Saig_TswRail( p, Abc_Lit2Var(pFanins[0]),  Abc_LitIsCompl(pFanins[0]) );
+        pFan01 = Saig_TswRail( p, Abc_Lit2Var(pFanins[0]), !Abc_LitIsCompl(pFanins[0]) );
+        for ( w = 0; w < nWords; w++ )
+            pSim0[w] = pFan00[w], pSim1[w] = pFan01[w];
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Finds the lanes, in which the COs have the given values.]
+
+  Description [Sets the bits of pRes (nWords words) to 1 for the lanes,
+  in which CO i of the cone has binary value vCoVals[i].]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Saig_TswCheckCos( Saig_Tsw_t * p, int nWords, Vec_Int_t * vCoVals, word * pRes )
+{
+    word * pSim;
+    int i, w, Pos = 1 + p->nCis + p->nNodes;
+    assert( nWords == p->nWords );
+    assert( Vec_IntSize(vCoVals) == p->nCos );
+    for ( w = 0; w < nWords; w++ )
+        pRes[w] = ~(word)0;
+    for ( i = 0; i < p->nCos; i++, Pos++ )
+    {
+        // the lane is good if the CO cannot take the opposite value
+        pSim = Saig_TswRail( p, Pos, !Vec_IntEntry(vCoVals, i) );
+        for ( w = 0; w < nWords; w++ )
+            pRes[w] &= ~pSim[w];
+    }
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
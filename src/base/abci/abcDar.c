@@ -35,6 +35,7 @@
 #include "opt/csw/csw.h"
 #include "proof/pdr/pdr.h"
 #include "sat/bmc/bmc.h"
+#include "misc/util/utilPth.h"
 #include "map/mio/mio.h"
 
 ABC_NAMESPACE_IMPL_START
@@ -1821,6 +1822,30 @@ int Abc_NtkDSat( Abc_Ntk_t * pNtk, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit
     return RetValue;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Solves combinational miter using a portfolio of SAT solvers.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_NtkDSatPortfolio( Abc_Ntk_t * pNtk, ABC_INT64_T nConfLimit, int nProcs, int fShare, int fVerbose )
+{
+    Aig_Man_t * pMan;
+    int RetValue;
+    assert( Abc_NtkIsStrash(pNtk) );
+    assert( Abc_NtkLatchNum(pNtk) == 0 );
+    pMan = Abc_NtkToDar( pNtk, 0, 0 );
+    RetValue = Fra_FraigSatPortfolio( pMan, nConfLimit, nProcs, fShare, fVerbose ); 
+    pNtk->pModel = (int *)pMan->pData, pMan->pData = NULL;
+    Aig_ManStop( pMan );
+    return RetValue;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Solves combinational miter using a SAT solver.]
@@ -2345,8 +2370,9 @@ int Abc_NtkDarBmc3( Abc_Ntk_t * pNtk, Saig_ParBmc_t * pPars, int fOrDecomp )
     Aig_Man_t * pMan;
     Vec_Int_t * vMap = NULL;
     int status, RetValue = -1;
-    abctime clk = Abc_Clock();
-    abctime nTimeOut = pPars->nTimeOut ? pPars->nTimeOut * CLOCKS_PER_SEC + Abc_Clock(): 0;
+    // wall-clock time, because the engine may solve on other threads
+    abctime clk = Util_WallClock();
+    abctime nTimeOut = pPars->nTimeOut ? pPars->nTimeOut * CLOCKS_PER_SEC + Util_WallClock(): 0;
     if ( fOrDecomp && !pPars->fSolveAll )
         pMan = Abc_NtkToDarBmc( pNtk, &vMap );
     else
@@ -2375,7 +2401,7 @@ int Abc_NtkDarBmc3( Abc_Ntk_t * pNtk, Saig_ParBmc_t * pPars, int fOrDecomp )
             if ( pPars->nFailOuts == 0 )
             {
                 Abc_Print( 1, "No output asserted in %d frames. Resource limit reached ", Abc_MaxInt(pPars->iFrame+1,0) );
-                if ( nTimeOut && Abc_Clock() > nTimeOut )
+                if ( nTimeOut && Util_WallClock() > nTimeOut )
                     Abc_Print( 1, "(timeout %d sec). ", pPars->nTimeOut );
                 else
                     Abc_Print( 1, "(conf limit %d). ", pPars->nConfLimit );
@@ -2383,7 +2409,7 @@ int Abc_NtkDarBmc3( Abc_Ntk_t * pNtk, Saig_ParBmc_t * pPars, int fOrDecomp )
             else
             {
                 Abc_Print( 1, "The total of %d outputs asserted in %d frames. Resource limit reached ", pPars->nFailOuts, pPars->iFrame );
-                if ( Abc_Clock() > nTimeOut )
+                if ( Util_WallClock() > nTimeOut )
                     Abc_Print( 1, "(timeout %d sec). ", pPars->nTimeOut );
                 else
                     Abc_Print( 1, "(conf limit %d). ", pPars->nConfLimit );
@@ -2413,7 +2439,7 @@ int Abc_NtkDarBmc3( Abc_Ntk_t * pNtk, Saig_ParBmc_t * pPars, int fOrDecomp )
                 Abc_Print( 1, ".   " );
             }
         }
-        ABC_PRT( "Time", Abc_Clock() - clk );
+        ABC_PRT( "Time", Util_WallClock() - clk );
     }
     if ( RetValue == 0 && pPars->fSolveAll )
     {
@@ -20,6 +20,7 @@
 
 #include "base/abc/abc.h"
 #include "misc/extra/extraBdd.h"
+#include "misc/util/utilPth.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -33,6 +34,34 @@ static Abc_Obj_t * Abc_NodeBddToMuxes( Abc_Obj_t * pNodeOld, Abc_Ntk_t * pNtkNew
 static Abc_Obj_t * Abc_NodeBddToMuxes_rec( DdManager * dd, DdNode * bFunc, Abc_Ntk_t * pNtkNew, st__table * tBdd2Node );
 static DdNode *    Abc_NodeGlobalBdds_rec( DdManager * dd, Abc_Obj_t * pNode, int nBddSizeMax, int fDropInternal, ProgressBar * pProgress, int * pCounter, int fVerbose );
 
+// the task of building global BDDs for a group of COs
+typedef struct Abc_BddTask_t_ Abc_BddTask_t;
+struct Abc_BddTask_t_
+{
+    Abc_Ntk_t *     pNtk;          // the network
+    DdManager *     dd;            // the manager of this task
+    Vec_Ptr_t *     vCos;          // the COs of this task
+    Vec_Ptr_t *     vNodes;        // the internal nodes of their cones
+    Vec_Ptr_t *     vFuncs;        // the BDDs of the objects (by object ID)
+    Vec_Int_t *     vRefs;         // the remaining fanouts (by object ID)
+    Vec_Ptr_t *     vRes;          // the BDDs of the COs (referenced)
+    volatile int *  pnLiveAll;     // the live nodes in the managers of all tasks
+    volatile int *  pfAbort;       // raised when one of the tasks fails
+    int             nLive;         // the live nodes in the manager of this task
+    int             nBddSizeMax;   // the limit on the number of live nodes in all managers
+    int             fReorder;      // enables dynamic reordering
+};
+
+// the tasks performed by the threads of the pool
+typedef struct Abc_BddTasks_t_ Abc_BddTasks_t;
+struct Abc_BddTasks_t_
+{
+    Vec_Ptr_t *     vTasks;        // the tasks
+    volatile int    iNext;         // the next task to perform
+    volatile int    nLiveAll;      // the live nodes in the managers of all tasks
+    volatile int    fAbort;        // raised when one of the tasks fails
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -465,6 +494,320 @@ DdNode * Abc_NodeGlobalBdds_rec( DdManager * dd, Abc_Obj_t * pNode, int nBddSize
     return bFunc;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Starts the task of building BDDs for COs iCoStart to iCoStop-1.]
+
+  Description [The nodes are collected and the references are counted
+  by the main thread, because the traversal IDs are shared.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_BddTask_t * Abc_NtkBddTaskStart( Abc_Ntk_t * pNtk, int iCoStart, int iCoStop, volatile int * pnLiveAll, volatile int * pfAbort, int nBddSizeMax, int fReorder )
+{
+    Abc_BddTask_t * p;
+    Abc_Obj_t * pObj, * pFanin;
+    int i, k;
+    p = ABC_CALLOC( Abc_BddTask_t, 1 );
+    p->pNtk        = pNtk;
+    p->pnLiveAll   = pnLiveAll;
+    p->pfAbort     = pfAbort;
+    p->nBddSizeMax = nBddSizeMax;
+    p->fReorder    = fReorder;
+    p->dd          = Cudd_Init( Abc_NtkCiNum(pNtk), 0, CUDD_UNIQUE_SLOTS, CUDD_CACHE_SLOTS, 0 );
+    p->vCos        = Vec_PtrAlloc( iCoStop - iCoStart );
+    for ( i = iCoStart; i < iCoStop; i++ )
+        Vec_PtrPush( p->vCos, Abc_NtkCo(pNtk, i) );
+    p->vNodes      = Abc_NtkDfsNodes( pNtk, (Abc_Obj_t **)Vec_PtrArray(p->vCos), Vec_PtrSize(p->vCos) );
+    p->vFuncs      = Vec_PtrStart( Abc_NtkObjNumMax(pNtk) );
+    p->vRefs       = Vec_IntStart( Abc_NtkObjNumMax(pNtk) );
+    p->vRes        = Vec_PtrAlloc( Vec_PtrSize(p->vCos) );
+    // the BDDs of the CIs and the constant are never dereferenced
+    Vec_PtrWriteEntry( p->vFuncs, Abc_ObjId(Abc_AigConst1(pNtk)), p->dd->one );
+    Abc_NtkForEachCi( pNtk, pObj, i )
+        Vec_PtrWriteEntry( p->vFuncs, Abc_ObjId(pObj), p->dd->vars[i] );
+    // count the fanouts of the nodes within the cones
+    Vec_PtrForEachEntry( Abc_Obj_t *, p->vNodes, pObj, i )
+        Abc_ObjForEachFanin( pObj, pFanin, k )
+            Vec_IntAddToEntry( p->vRefs, Abc_ObjId(pFanin), 1 );
+    Vec_PtrForEachEntry( Abc_Obj_t *, p->vCos, pObj, i )
+        Vec_IntAddToEntry( p->vRefs, Abc_ObjFaninId0(pObj), 1 );
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the task.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkBddTaskStop( Abc_BddTask_t * p )
+{
+    Abc_Obj_t * pObj;
+    DdNode * bFunc;
+    int i;
+    Vec_PtrForEachEntry( Abc_Obj_t *, p->vNodes, pObj, i )
+        if ( (bFunc = (DdNode *)Vec_PtrEntry(p->vFuncs, Abc_ObjId(pObj))) )
+            Cudd_RecursiveDeref( p->dd, bFunc );
+    Vec_PtrForEachEntry( DdNode *, p->vRes, bFunc, i )
+        Cudd_RecursiveDeref( p->dd, bFunc );
+    Extra_StopManager( p->dd );
+    Vec_PtrFree( p->vCos );
+    Vec_PtrFree( p->vNodes );
+    Vec_PtrFree( p->vFuncs );
+    Vec_IntFree( p->vRefs );
+    Vec_PtrFree( p->vRes );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Dereferences the BDD of the fanin after its last use.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Abc_NtkBddTaskDeref( Abc_BddTask_t * p, Abc_Obj_t * pFanin )
+{
+    DdNode * bFunc;
+    if ( Vec_IntAddToEntry(p->vRefs, Abc_ObjId(pFanin), -1) > 0 || !Abc_ObjIsNode(pFanin) )
+        return;
+    bFunc = (DdNode *)Vec_PtrEntry( p->vFuncs, Abc_ObjId(pFanin) );
+    Vec_PtrWriteEntry( p->vFuncs, Abc_ObjId(pFanin), NULL );
+    Cudd_RecursiveDeref( p->dd, bFunc );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Updates the number of live nodes in all managers.]
+
+  Description [Returns the number of live nodes in the managers of all 
+  tasks, in which the current count of this task is included.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Abc_NtkBddTaskUpdateLive( Abc_BddTask_t * p )
+{
+    int nLive = (int)(Cudd_ReadKeys(p->dd) - Cudd_ReadDead(p->dd));
+    int nLiveAll = Util_AtomicAdd( p->pnLiveAll, nLive - p->nLive ) + nLive - p->nLive;
+    p->nLive = nLive;
+    return nLiveAll;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Builds global BDDs of one group of COs in its own manager.]
+
+  Description [The nodes of the cones are given in a topological order.
+  The BDDs of the internal nodes are dereferenced as soon as their last
+  fanout is processed. Only the private data of the task is modified, so
+  the tasks can be performed on separate threads. The limit on the live
+  nodes applies to the managers of all tasks together. When one task
+  fails, it raises the shared flag, so that the other tasks stop too.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_NtkBddTaskPerform( Abc_BddTask_t * p )
+{
+    Abc_Obj_t * pObj, * pFanin;
+    DdNode * bFunc, * bFunc0, * bFunc1;
+    int i, k, nLiveAll;
+    if ( p->fReorder )
+        Cudd_AutodynEnable( p->dd, CUDD_REORDER_SYMM_SIFT );
+    Vec_PtrForEachEntry( Abc_Obj_t *, p->vNodes, pObj, i )
+    {
+        nLiveAll = Abc_NtkBddTaskUpdateLive( p );
+        if ( nLiveAll > p->nBddSizeMax || *p->pfAbort )
+            break;
+        bFunc0 = Cudd_NotCond( (DdNode *)Vec_PtrEntry(p->vFuncs, Abc_ObjFaninId0(pObj)), (int)Abc_ObjFaninC0(pObj) );
+        bFunc1 = Cudd_NotCond( (DdNode *)Vec_PtrEntry(p->vFuncs, Abc_ObjFaninId1(pObj)), (int)Abc_ObjFaninC1(pObj) );
+        bFunc  = Cudd_bddAndLimit( p->dd, bFunc0, bFunc1, p->nBddSizeMax - nLiveAll );
+        if ( bFunc == NULL )
+            break;
+        Cudd_Ref( bFunc );
+        Vec_PtrWriteEntry( p->vFuncs, Abc_ObjId(pObj), bFunc );
+        Abc_ObjForEachFanin( pObj, pFanin, k )
+            Abc_NtkBddTaskDeref( p, pFanin );
+    }
+    if ( i == Vec_PtrSize(p->vNodes) )
+    {
+        Vec_PtrForEachEntry( Abc_Obj_t *, p->vCos, pObj, i )
+        {
+            bFunc = Cudd_NotCond( (DdNode *)Vec_PtrEntry(p->vFuncs, Abc_ObjFaninId0(pObj)), (int)Abc_ObjFaninC0(pObj) );
+            Cudd_Ref( bFunc );
+            Vec_PtrPush( p->vRes, bFunc );
+            Abc_NtkBddTaskDeref( p, Abc_ObjFanin0(pObj) );
+        }
+    }
+    else
+        *p->pfAbort = 1;
+    if ( p->fReorder )
+        Cudd_AutodynDisable( p->dd );
+    Abc_NtkBddTaskUpdateLive( p );
+    return Vec_PtrSize(p->vRes) == Vec_PtrSize(p->vCos);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs the tasks using the threads of the pool.]
+
+  Description [The threads take the tasks one by one until none is left.
+  Returns 1 if all tasks succeeded.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkBddTaskThread( void * pUser, int iThread )
+{
+    Abc_BddTasks_t * p = (Abc_BddTasks_t *)pUser;
+    int iTask;
+    while ( (iTask = Util_AtomicAdd(&p->iNext, 1)) < Vec_PtrSize(p->vTasks) )
+        Abc_NtkBddTaskPerform( (Abc_BddTask_t *)Vec_PtrEntry(p->vTasks, iTask) );
+}
+int Abc_NtkBddTasksPerform( Abc_BddTasks_t * p, int nProcs )
+{
+    Util_Pool_t * pPool;
+    Abc_BddTask_t * pTask;
+    int i, RetValue = 1;
+    pPool = Util_PoolStart( nProcs );
+    Util_PoolRun( pPool, Abc_NtkBddTaskThread, p );
+    Util_PoolStop( pPool );
+    Vec_PtrForEachEntry( Abc_BddTask_t *, p->vTasks, pTask, i )
+        RetValue &= (Vec_PtrSize(pTask->vRes) == Vec_PtrSize(pTask->vCos));
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives global BDDs for the COs using several threads.]
+
+  Description [The COs are divided into nProcs groups. The BDDs of each
+  group are built in a separate manager, which reorders its variables
+  independently. The main manager takes the variable order of the largest
+  group, after which the BDDs of all groups are transferred into it.
+  The limit nBddSizeMax applies to the live nodes of all managers during
+  the construction and to the main manager during the transfer. Only the
+  COs of the resulting network have global BDDs assigned. The same holds
+  after Abc_NtkBuildGlobalBdds() with fDropInternal set to 1, which drops
+  the BDDs of the CIs and the constant after their last fanout, but the 
+  variable order and the runtime limits may differ.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Abc_NtkBuildGlobalBddsPar( Abc_Ntk_t * pNtk, int nBddSizeMax, int fReorder, int nProcs, int fVerbose )
+{
+    Abc_BddTasks_t Tasks, * p = &Tasks;
+    Vec_Att_t * pAttMan;
+    Abc_BddTask_t * pTask, * pTaskBig = NULL;
+    Abc_Obj_t * pObj;
+    DdManager * dd;
+    DdNode ** pRes;
+    unsigned int MaxLive;
+    int i, k, iCo = 0, nCos, RetValue;
+    abctime clk = Util_WallClock();
+    assert( Abc_NtkIsStrash(pNtk) );
+    assert( Abc_NtkGlobalBdd(pNtk) == NULL );
+    if ( nProcs < 2 || Abc_NtkCoNum(pNtk) < 2 )
+        return Abc_NtkBuildGlobalBdds( pNtk, nBddSizeMax, 1, fReorder, fVerbose );
+    nProcs = Abc_MinInt( Abc_MinInt(nProcs, UTIL_PROC_MAX), Abc_NtkCoNum(pNtk) );
+    // remove dangling nodes
+    Abc_AigCleanup( (Abc_Aig_t *)pNtk->pManFunc );
+    // divide the COs into groups of consecutive outputs
+    p->vTasks   = Vec_PtrAlloc( nProcs );
+    p->iNext    = 0;
+    p->nLiveAll = 0;
+    p->fAbort   = 0;
+    for ( i = 0; i < nProcs; i++ )
+    {
+        nCos  = (Abc_NtkCoNum(pNtk) - iCo) / (nProcs - i);
+        pTask = Abc_NtkBddTaskStart( pNtk, iCo, iCo + nCos, &p->nLiveAll, &p->fAbort, nBddSizeMax, fReorder );
+        Vec_PtrPush( p->vTasks, pTask );
+        iCo  += nCos;
+    }
+    RetValue = Abc_NtkBddTasksPerform( p, nProcs );
+    if ( fVerbose )
+    {
+        Vec_PtrForEachEntry( Abc_BddTask_t *, p->vTasks, pTask, i )
+            printf( "Thread %d : COs = %6d. Nodes = %7d. Live BDD nodes = %8d.\n", i,
+                Vec_PtrSize(pTask->vCos), Vec_PtrSize(pTask->vNodes), Cudd_ReadKeys(pTask->dd) - Cudd_ReadDead(pTask->dd) );
+        Abc_PrintTime( 1, "Parallel BDD construction time", Util_WallClock() - clk );
+    }
+    if ( !RetValue )
+    {
+        if ( fVerbose )
+        printf( "Constructing global BDDs is aborted.\n" );
+        Vec_PtrForEachEntry( Abc_BddTask_t *, p->vTasks, pTask, i )
+            Abc_NtkBddTaskStop( pTask );
+        Vec_PtrFree( p->vTasks );
+        return NULL;
+    }
+    // start the manager with the variable order of the largest group
+    Vec_PtrForEachEntry( Abc_BddTask_t *, p->vTasks, pTask, i )
+        if ( pTaskBig == NULL || Cudd_ReadKeys(pTaskBig->dd) - Cudd_ReadDead(pTaskBig->dd) < Cudd_ReadKeys(pTask->dd) - Cudd_ReadDead(pTask->dd) )
+            pTaskBig = pTask;
+    dd = Cudd_Init( Abc_NtkCiNum(pNtk), 0, CUDD_UNIQUE_SLOTS, CUDD_CACHE_SLOTS, 0 );
+    Cudd_ShuffleHeap( dd, pTaskBig->dd->invperm );
+    pAttMan = Vec_AttAlloc( Abc_NtkObjNumMax(pNtk) + 1, dd, (void (*)(void*))Extra_StopManager, NULL, (void (*)(void*,void*))Cudd_RecursiveDeref );
+    Vec_PtrWriteEntry( pNtk->vAttrs, VEC_ATTR_GLOBAL_BDD, pAttMan );
+    if ( fReorder )
+        Cudd_AutodynEnable( dd, CUDD_REORDER_SYMM_SIFT );
+    // transfer the BDDs into the main manager, which is subject to the same limit
+    MaxLive = Cudd_ReadMaxLive( dd );
+    Cudd_SetMaxLive( dd, nBddSizeMax );
+    pRes = ABC_ALLOC( DdNode *, Abc_NtkCoNum(pNtk) );
+    Vec_PtrForEachEntry( Abc_BddTask_t *, p->vTasks, pTask, i )
+    {
+        if ( RetValue )
+            RetValue = Cudd_bddTransferArray( pTask->dd, dd, (DdNode **)Vec_PtrArray(pTask->vRes), Vec_PtrSize(pTask->vRes), pRes );
+        if ( RetValue )
+            Vec_PtrForEachEntry( Abc_Obj_t *, pTask->vCos, pObj, k )
+                Abc_ObjSetGlobalBdd( pObj, pRes[k] );
+        if ( RetValue && Cudd_ReadKeys(dd) - Cudd_ReadDead(dd) > (unsigned)nBddSizeMax )
+            RetValue = 0;
+        Abc_NtkBddTaskStop( pTask );
+    }
+    Cudd_SetMaxLive( dd, MaxLive );
+    Vec_PtrFree( p->vTasks );
+    ABC_FREE( pRes );
+    if ( !RetValue )
+    {
+        if ( fVerbose )
+        printf( "Transferring global BDDs is aborted.\n" );
+        Abc_NtkFreeGlobalBdds( pNtk, 1 );
+        return NULL;
+    }
+    // reorder one more time
+    if ( fReorder )
+    {
+        Cudd_ReduceHeap( dd, CUDD_REORDER_SYMM_SIFT, 1 );
+        Cudd_AutodynDisable( dd );
+    }
+    return dd;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Frees the global BDDs of the network.]
@@ -1967,9 +1967,11 @@ int IoCommandWriteCnf2( Abc_Frame_t * pAbc, int argc, char **argv )
     int fNewAlgo    = 1;
     int fCnfObjIds  = 0;
     int fAddOrCla   = 1;
+    int fFastAlgo   = 0;
+    int nProcs      = 1;
     int c, fVerbose = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "Kaiovh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "KPaiofvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -1982,6 +1984,17 @@ int IoCommandWriteCnf2( Abc_Frame_t * pAbc, int argc, char **argv )
                 nLutSize = atoi(argv[globalUtilOptind]);
                 globalUtilOptind++;
                 break;
+            case 'P':
+                if ( globalUtilOptind >= argc )
+                {
+                    Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                    goto usage;
+                }
+                nProcs = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if ( nProcs <= 0 )
+                    goto usage;
+                break;
             case 'a':
                 fNewAlgo ^= 1;
                 break;
@@ -1991,6 +2004,9 @@ int IoCommandWriteCnf2( Abc_Frame_t * pAbc, int argc, char **argv )
             case 'o':
                 fAddOrCla ^= 1;
                 break;
+            case 'f':
+                fFastAlgo ^= 1;
+                break;
             case 'v':
                 fVerbose ^= 1;
                 break;
@@ -2031,19 +2047,23 @@ int IoCommandWriteCnf2( Abc_Frame_t * pAbc, int argc, char **argv )
         return 0;
     }
     fclose( pFile );
-    if ( fNewAlgo )
+    if ( fFastAlgo )
+        Gia_ManDumpCnfFast( pAbc->pGia, pFileName, nProcs, fVerbose );
+    else if ( fNewAlgo )
         Mf_ManDumpCnf( pAbc->pGia, pFileName, nLutSize, fCnfObjIds, fAddOrCla, fVerbose );
     else
         Jf_ManDumpCnf( pAbc->pGia, pFileName, fVerbose );
     return 0;
 
 usage:
-    fprintf( pAbc->Err, "usage: &write_cnf [-Kaiovh] <file>\n" );
+    fprintf( pAbc->Err, "usage: &write_cnf [-KPaiofvh] <file>\n" );
     fprintf( pAbc->Err, "\t           writes CNF produced by a new generator\n" );
     fprintf( pAbc->Err, "\t-K <num> : the LUT size (3 <= num <= 8) [default = %d]\n", nLutSize );
+    fprintf( pAbc->Err, "\t-P <num> : the number of threads used by the fast generator (-f) [default = %d]\n", nProcs );
     fprintf( pAbc->Err, "\t-a       : toggle using new algorithm [default = %s]\n", fNewAlgo? "yes" : "no" );
     fprintf( pAbc->Err, "\t-i       : toggle using AIG object IDs as CNF variables [default = %s]\n", fCnfObjIds? "yes" : "no" );
     fprintf( pAbc->Err, "\t-o       : toggle adding OR clause for the outputs [default = %s]\n", fAddOrCla? "yes" : "no" );
+    fprintf( pAbc->Err, "\t-f       : toggle using fast structural CNF asserting all outputs [default = %s]\n", fFastAlgo? "yes" : "no" );
     fprintf( pAbc->Err, "\t-v       : toggle printing verbose information [default = %s]\n", fVerbose? "yes" : "no" );
     fprintf( pAbc->Err, "\t-h       : print the help massage\n" );
     fprintf( pAbc->Err, "\tfile     : the name of the file to write\n" );
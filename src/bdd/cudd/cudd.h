@@ -846,6 +846,7 @@ extern DdNode *        Cudd_addBddIthBit( DdManager * dd, DdNode * f, int bit );
 extern DdNode *        Cudd_BddToAdd( DdManager * dd, DdNode * B );
 extern DdNode *        Cudd_addBddPattern( DdManager * dd, DdNode * f );
 extern DdNode *        Cudd_bddTransfer( DdManager * ddSource, DdManager * ddDestination, DdNode * f );
+extern int             Cudd_bddTransferArray( DdManager * ddSource, DdManager * ddDestination, DdNode ** pFuncs, int nFuncs, DdNode ** pRes );
 extern int             Cudd_DebugCheck( DdManager * table );
 extern int             Cudd_CheckKeys( DdManager * table );
 extern DdNode *        Cudd_bddClippingAnd( DdManager * dd, DdNode * f, DdNode * g, int maxDepth, int direction );
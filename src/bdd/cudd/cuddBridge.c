@@ -16,6 +16,7 @@
             <li> Cudd_BddToAdd()
             <li> Cudd_addBddPattern()
             <li> Cudd_bddTransfer()
+            <li> Cudd_bddTransferArray()
             </ul>
         Internal procedures included in this file:
             <ul>
@@ -30,6 +31,8 @@
             <li> addBddDoIthBit()
             <li> ddBddToAddRecur()
             <li> cuddBddTransferRecur()
+            <li> ddBddTransferArray()
+            <li> ddBddTransferSameOrderRecur()
             </ul>
             ]
 
@@ -122,6 +125,8 @@ static DdNode * addBddDoInterval (DdManager *dd, DdNode *f, DdNode *l, DdNode *u
 static DdNode * addBddDoIthBit (DdManager *dd, DdNode *f, DdNode *index);
 static DdNode * ddBddToAddRecur (DdManager *dd, DdNode *B);
 static DdNode * cuddBddTransferRecur (DdManager *ddS, DdManager *ddD, DdNode *f, st__table *table);
+static int ddBddTransferArray (DdManager *ddS, DdManager *ddD, DdNode **pFuncs, int nFuncs, DdNode **pRes);
+static DdNode * ddBddTransferSameOrderRecur (DdManager *ddS, DdManager *ddD, DdNode *f, st__table *table);
 
 /**AutomaticEnd***************************************************************/
 
@@ -421,6 +426,43 @@ Cudd_bddTransfer(
 } /* end of Cudd_bddTransfer */
 
 
+/**Function********************************************************************
+
+  Synopsis    [Converts an array of BDDs from a manager to another one.]
+
+  Description [Converts the nFuncs BDDs in pFuncs from ddSource to
+  ddDestination and writes the results into pRes. The BDDs share one
+  translation table, so the common nodes are converted once. If the
+  variables of ddSource appear in the same relative order in both
+  managers, the nodes are created directly in the unique table of
+  ddDestination instead of calling ITE. The source manager is only
+  read, so several threads can convert BDDs from the same manager into
+  their own managers at the same time. Returns 1 if successful, in which
+  case the results are referenced; 0 otherwise.]
+
+  SideEffects [None]
+
+  SeeAlso     [Cudd_bddTransfer]
+
+******************************************************************************/
+int
+Cudd_bddTransferArray(
+  DdManager * ddSource,
+  DdManager * ddDestination,
+  DdNode ** pFuncs,
+  int nFuncs,
+  DdNode ** pRes)
+{
+    int result;
+    do {
+        ddDestination->reordered = 0;
+        result = ddBddTransferArray(ddSource, ddDestination, pFuncs, nFuncs, pRes);
+    } while (ddDestination->reordered == 1);
+    return(result);
+
+} /* end of Cudd_bddTransferArray */
+
+
 /*---------------------------------------------------------------------------*/
 /* Definition of internal functions                                          */
 /*---------------------------------------------------------------------------*/
@@ -1024,6 +1066,147 @@ cuddBddTransferRecur(
 } /* end of cuddBddTransferRecur */
 
 
+/**Function********************************************************************
+
+  Synopsis    [Converts an array of BDDs from a manager to another one.]
+
+  Description [Performs the conversion for Cudd_bddTransferArray.
+  Returns 1 if successful; 0 otherwise.]
+
+  SideEffects [None]
+
+  SeeAlso     [Cudd_bddTransferArray]
+
+******************************************************************************/
+static int
+ddBddTransferArray(
+  DdManager * ddS,
+  DdManager * ddD,
+  DdNode ** pFuncs,
+  int nFuncs,
+  DdNode ** pRes)
+{
+    DdNode *res, *key, *value;
+    st__table *table = NULL;
+    st__generator *gen = NULL;
+    int i, k, sameOrder = 1;
+
+    /* Check whether the source variables have the same relative order. */
+    if (ddS->size > ddD->size) sameOrder = 0;
+    for (i = 1; sameOrder && i < ddS->size; i++) {
+        if (ddD->perm[ddS->invperm[i-1]] > ddD->perm[ddS->invperm[i]])
+            sameOrder = 0;
+    }
+
+    table = st__init_table( st__ptrcmp, st__ptrhash);
+    if (table == NULL) return(0);
+    for (i = 0; i < nFuncs; i++) {
+        if (sameOrder)
+            res = ddBddTransferSameOrderRecur(ddS, ddD, pFuncs[i], table);
+        else
+            res = cuddBddTransferRecur(ddS, ddD, pFuncs[i], table);
+        if (res == NULL) break;
+        cuddRef(res);
+        pRes[i] = res;
+    }
+
+    /* Dereference all elements in the table and dispose of the table. */
+    gen = st__init_gen(table);
+    if (gen != NULL) {
+        while ( st__gen(gen, (const char **)&key, (char **)&value)) {
+            Cudd_RecursiveDeref(ddD, value);
+        }
+        st__free_gen(gen);
+    }
+    st__free_table(table);
+
+    if (i < nFuncs || gen == NULL) {
+        for (k = 0; k < i; k++) {
+            Cudd_RecursiveDeref(ddD, pRes[k]);
+            pRes[k] = NULL;
+        }
+        return(0);
+    }
+    return(1);
+
+} /* end of ddBddTransferArray */
+
+
+/**Function********************************************************************
+
+  Synopsis    [Performs the recursive step of Cudd_bddTransferArray.]
+
+  Description [Performs the recursive step of Cudd_bddTransferArray
+  when the variable orders of the two managers agree. Since the
+  regular nodes are converted into regular nodes, the nodes of the
+  destination manager can be found or created using cuddUniqueInter.
+  Returns a pointer to the result if successful; NULL otherwise.]
+
+  SideEffects [None]
+
+  SeeAlso     [cuddBddTransferRecur]
+
+******************************************************************************/
+static DdNode *
+ddBddTransferSameOrderRecur(
+  DdManager * ddS,
+  DdManager * ddD,
+  DdNode * f,
+  st__table * table)
+{
+    DdNode *t, *e, *res;
+    int comple;
+
+    statLine(ddD);
+    comple = Cudd_IsComplement(f);
+
+    /* Trivial cases. */
+    if (Cudd_IsConstant(f)) return(Cudd_NotCond(DD_ONE(ddD), comple));
+
+    /* Now f is a regular pointer to a non-constant node. */
+    f = Cudd_Regular(f);
+
+    /* Check the cache. */
+    if ( st__lookup(table, (const char *)f, (char **)&res))
+        return(Cudd_NotCond(res,comple));
+
+    if ( ddD->TimeStop && Abc_Clock() > ddD->TimeStop )
+        return NULL;
+
+    /* Recursive step. */
+    t = ddBddTransferSameOrderRecur(ddS, ddD, cuddT(f), table);
+    if (t == NULL) {
+        return(NULL);
+    }
+    cuddRef(t);
+
+    e = ddBddTransferSameOrderRecur(ddS, ddD, cuddE(f), table);
+    if (e == NULL) {
+        Cudd_RecursiveDeref(ddD, t);
+        return(NULL);
+    }
+    cuddRef(e);
+
+    assert(!Cudd_IsComplement(t) && t != e);
+    res = cuddUniqueInter(ddD,(int)f->index,t,e);
+    if (res == NULL) {
+        Cudd_RecursiveDeref(ddD, t);
+        Cudd_RecursiveDeref(ddD, e);
+        return(NULL);
+    }
+    cuddRef(res);
+    cuddDeref(t);
+    cuddDeref(e);
+
+    if ( st__add_direct(table, (char *) f, (char *) res) == st__OUT_OF_MEM) {
+        Cudd_RecursiveDeref(ddD, res);
+        return(NULL);
+    }
+    return(Cudd_NotCond(res,comple));
+
+} /* end of ddBddTransferSameOrderRecur */
+
+
 ABC_NAMESPACE_IMPL_END
 
 
@@ -75,6 +75,16 @@
 #include "misc/util/util_hack.h"
 #include "cuddInt.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -109,6 +119,14 @@ int     ddTotalNumberSwapping;
 int     ddTotalNISwaps;
 #endif
 
+#ifdef ABC_USE_PTHREADS
+/* The reordering procedures use static data (entry, the counters of
+** swaps, etc), so reordering is serialized when several managers are
+** used by different threads. The other BDD operations of different
+** managers may run concurrently. */
+static pthread_mutex_t ddReorderMutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
 /*---------------------------------------------------------------------------*/
 /* Macro declarations                                                        */
 /*---------------------------------------------------------------------------*/
@@ -119,6 +137,8 @@ int     ddTotalNISwaps;
 /* Static function prototypes                                                */
 /*---------------------------------------------------------------------------*/
 
+static int ddReduceHeap (DdManager *table, Cudd_ReorderingType heuristic, int minsize);
+static int ddShuffleHeap (DdManager *table, int *permutation);
 static int ddUniqueCompare (int *ptrX, int *ptrY);
 static Move * ddSwapAny (DdManager *table, int x, int y);
 static int ddSiftingAux (DdManager *table, int x, int xLow, int xHigh);
@@ -177,6 +197,74 @@ Cudd_ReduceHeap(
   DdManager * table /* DD manager */,
   Cudd_ReorderingType heuristic /* method used for reordering */,
   int  minsize /* bound below which no reordering occurs */)
+{
+    int result;
+#ifdef ABC_USE_PTHREADS
+    int status;
+    status = pthread_mutex_lock(&ddReorderMutex); assert(status == 0);
+#endif
+    result = ddReduceHeap(table, heuristic, minsize);
+#ifdef ABC_USE_PTHREADS
+    status = pthread_mutex_unlock(&ddReorderMutex); assert(status == 0);
+#endif
+    return(result);
+
+} /* end of Cudd_ReduceHeap */
+
+
+/**Function********************************************************************
+
+  Synopsis    [Reorders variables according to given permutation.]
+
+  Description [Reorders variables according to given permutation.
+  The i-th entry of the permutation array contains the index of the variable
+  that should be brought to the i-th level.  The size of the array should be
+  equal or greater to the number of variables currently in use.
+  Returns 1 in case of success; 0 otherwise.]
+
+  SideEffects [Changes the variable order for all diagrams and clears
+  the cache.]
+
+  SeeAlso [Cudd_ReduceHeap]
+
+******************************************************************************/
+int
+Cudd_ShuffleHeap(
+  DdManager * table /* DD manager */,
+  int * permutation /* required variable permutation */)
+{
+    int result;
+#ifdef ABC_USE_PTHREADS
+    int status;
+    status = pthread_mutex_lock(&ddReorderMutex); assert(status == 0);
+#endif
+    result = ddShuffleHeap(table, permutation);
+#ifdef ABC_USE_PTHREADS
+    status = pthread_mutex_unlock(&ddReorderMutex); assert(status == 0);
+#endif
+    return(result);
+
+} /* end of Cudd_ShuffleHeap */
+
+
+/**Function********************************************************************
+
+  Synopsis    [Main dynamic reordering routine.]
+
+  Description [Performs the reordering for Cudd_ReduceHeap. Called
+  while holding the reordering lock.]
+
+  SideEffects [Changes the variable order for all diagrams and clears
+  the cache.]
+
+  SeeAlso     [Cudd_ReduceHeap]
+
+******************************************************************************/
+static int
+ddReduceHeap(
+  DdManager * table /* DD manager */,
+  Cudd_ReorderingType heuristic /* method used for reordering */,
+  int  minsize /* bound below which no reordering occurs */)
 {
     DdHook *hook;
     int result;
@@ -315,27 +403,24 @@ Cudd_ReduceHeap(
 
     return(result);
 
-} /* end of Cudd_ReduceHeap */
+} /* end of ddReduceHeap */
 
 
 /**Function********************************************************************
 
   Synopsis    [Reorders variables according to given permutation.]
 
-  Description [Reorders variables according to given permutation.
-  The i-th entry of the permutation array contains the index of the variable
-  that should be brought to the i-th level.  The size of the array should be
-  equal or greater to the number of variables currently in use.
-  Returns 1 in case of success; 0 otherwise.]
+  Description [Performs the reordering for Cudd_ShuffleHeap. Called
+  while holding the reordering lock.]
 
   SideEffects [Changes the variable order for all diagrams and clears
   the cache.]
 
-  SeeAlso [Cudd_ReduceHeap]
+  SeeAlso [Cudd_ShuffleHeap]
 
 ******************************************************************************/
-int
-Cudd_ShuffleHeap(
+static int
+ddShuffleHeap(
   DdManager * table /* DD manager */,
   int * permutation /* required variable permutation */)
 {
@@ -379,7 +464,7 @@ Cudd_ShuffleHeap(
 
     return(result);
 
-} /* end of Cudd_ShuffleHeap */
+} /* end of ddShuffleHeap */
 
 
 /*---------------------------------------------------------------------------*/
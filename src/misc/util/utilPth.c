@@ -0,0 +1,429 @@
+/**CFile****************************************************************
+
+  FileName    [utilPth.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Generic interface to pthreads.]
+
+  Synopsis    [Atomic operations, locks and a simple pool of worker threads.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: utilPth.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "abc_global.h"
+#include "utilPth.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The pool runs the same task on all of its threads and returns when every
+// thread is done, which makes each call to Util_PoolRun() a barrier.
+// The calling thread takes part in the computation as thread 0.
+// Without pthreads the pool degenerates into a loop over thread indexes,
+// so the tasks of one round should never wait for each other.
+
+struct Util_Pool_t_
+{
+    int               nThreads;    // the number of threads (including the caller)
+    Util_PoolFunc_t   pFunc;       // the current task
+    void *            pUser;       // the current user data
+#ifdef ABC_USE_PTHREADS
+    pthread_t         Threads[UTIL_PROC_MAX];
+    pthread_mutex_t   Mutex;       // protects the fields below
+    pthread_cond_t    CondStart;   // signals a new round
+    pthread_cond_t    CondDone;    // signals the end of the round
+    int               iRound;      // the current round
+    int               nDone;       // the number of threads done in this round
+    int               fStop;       // the pool is being stopped
+#endif
+};
+
+// The lock is a readers-writer lock: any number of readers or one writer.
+// Without pthreads there is only one thread, so locking does nothing.
+
+struct Util_Lock_t_
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_rwlock_t  Lock;
+#else
+    int               Dummy;
+#endif
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+#ifdef ABC_USE_PTHREADS
+
+typedef struct Util_PoolArg_t_
+{
+    Util_Pool_t *     pPool;
+    int               iThread;
+} Util_PoolArg_t;
+
+/**Function*************************************************************
+
+  Synopsis    [Checks the value returned by a pthread call.]
+
+  Description [The synchronization cannot be skipped, so the program is
+  aborted if a call fails. The check does not depend on NDEBUG.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Util_PthCheck( int status, const char * pCall )
+{
+    if ( status == 0 )
+        return;
+    fprintf( stderr, "Error: %s() failed with code %d.\n", pCall, status );
+    fflush( stderr );
+    abort();
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Worker thread of the pool.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Util_PoolWorkerThread( void * pArg )
+{
+    Util_Pool_t * p = ((Util_PoolArg_t *)pArg)->pPool;
+    int iThread = ((Util_PoolArg_t *)pArg)->iThread;
+    int iRound = 0;
+    ABC_FREE( pArg );
+    while ( 1 )
+    {
+        Util_PthCheck( pthread_mutex_lock( &p->Mutex ), "pthread_mutex_lock" );
+        while ( p->iRound == iRound && !p->fStop )
+            pthread_cond_wait( &p->CondStart, &p->Mutex );
+        if ( p->fStop )
+        {
+            Util_PthCheck( pthread_mutex_unlock( &p->Mutex ), "pthread_mutex_unlock" );
+            pthread_exit( NULL );
+            return NULL;
+        }
+        iRound = p->iRound;
+        Util_PthCheck( pthread_mutex_unlock( &p->Mutex ), "pthread_mutex_unlock" );
+        p->pFunc( p->pUser, iThread );
+        Util_PthCheck( pthread_mutex_lock( &p->Mutex ), "pthread_mutex_lock" );
+        if ( ++p->nDone == p->nThreads - 1 )
+            pthread_cond_signal( &p->CondDone );
+        Util_PthCheck( pthread_mutex_unlock( &p->Mutex ), "pthread_mutex_unlock" );
+    }
+    assert( 0 );
+    return NULL;
+}
+
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the pool can run threads concurrently.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Util_PoolIsParallel()
+{
+#ifdef ABC_USE_PTHREADS
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the elapsed (wall-clock) time.]
+
+  Description [The result is measured in the units of Abc_Clock(), which
+  returns the CPU time of the calling thread and therefore cannot be used
+  to implement timeouts shared by several threads.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+abctime Util_WallClock()
+{
+#if defined(_WIN32)
+    return (abctime)GetTickCount64() * CLOCKS_PER_SEC / 1000;
+#elif defined(CLOCK_MONOTONIC)
+    struct timespec ts;
+    if ( clock_gettime(CLOCK_MONOTONIC, &ts) < 0 )
+        return (abctime)-1;
+    return ((abctime)ts.tv_sec) * CLOCKS_PER_SEC + ((abctime)ts.tv_nsec) * CLOCKS_PER_SEC / 1000000000;
+#else
+    return (abctime)time(NULL) * CLOCKS_PER_SEC;
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Suspends the calling thread for a short time.]
+
+  Description [Used by the threads waiting for each other, so that 
+  polling a shared variable does not keep a core busy.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Util_ThreadSleep( int nMicroSecs )
+{
+#if defined(_WIN32)
+    Sleep( (nMicroSecs + 999) / 1000 );
+#else
+    struct timespec ts;
+    ts.tv_sec  = nMicroSecs / 1000000;
+    ts.tv_nsec = (nMicroSecs % 1000000) * 1000;
+    nanosleep( &ts, NULL );
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the readers-writer lock.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Util_Lock_t * Util_LockStart()
+{
+    Util_Lock_t * p = ABC_CALLOC( Util_Lock_t, 1 );
+#ifdef ABC_USE_PTHREADS
+    Util_PthCheck( pthread_rwlock_init( &p->Lock, NULL ), "pthread_rwlock_init" );
+#endif
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the readers-writer lock.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Util_LockStop( Util_Lock_t * p )
+{
+    if ( p == NULL )
+        return;
+#ifdef ABC_USE_PTHREADS
+    pthread_rwlock_destroy( &p->Lock );
+#endif
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Takes the lock for reading or for writing.]
+
+  Description [The calling thread sleeps while the lock is not available.
+  A NULL lock is never taken, so that the code shared with the 
+  single-threaded engines can leave it NULL.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Util_LockRead( Util_Lock_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    if ( p == NULL )
+        return;
+    Util_PthCheck( pthread_rwlock_rdlock( &p->Lock ), "pthread_rwlock_rdlock" );
+#endif
+}
+void Util_LockWrite( Util_Lock_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    if ( p == NULL )
+        return;
+    Util_PthCheck( pthread_rwlock_wrlock( &p->Lock ), "pthread_rwlock_wrlock" );
+#endif
+}
+void Util_LockUnlock( Util_Lock_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    if ( p == NULL )
+        return;
+    Util_PthCheck( pthread_rwlock_unlock( &p->Lock ), "pthread_rwlock_unlock" );
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the pool with the given number of threads.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Util_Pool_t * Util_PoolStart( int nThreads )
+{
+    Util_Pool_t * p;
+    assert( nThreads >= 1 && nThreads <= UTIL_PROC_MAX );
+    p = ABC_CALLOC( Util_Pool_t, 1 );
+    p->nThreads = nThreads;
+#ifdef ABC_USE_PTHREADS
+    {
+        int i;
+        Util_PthCheck( pthread_mutex_init( &p->Mutex, NULL ), "pthread_mutex_init" );
+        Util_PthCheck( pthread_cond_init( &p->CondStart, NULL ), "pthread_cond_init" );
+        Util_PthCheck( pthread_cond_init( &p->CondDone, NULL ), "pthread_cond_init" );
+        for ( i = 1; i < nThreads; i++ )
+        {
+            Util_PoolArg_t * pArg = ABC_CALLOC( Util_PoolArg_t, 1 );
+            pArg->pPool   = p;
+            pArg->iThread = i;
+            Util_PthCheck( pthread_create( p->Threads + i, NULL, Util_PoolWorkerThread, (void *)pArg ), "pthread_create" );
+        }
+    }
+#endif
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the pool.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Util_PoolStop( Util_Pool_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    int i;
+    Util_PthCheck( pthread_mutex_lock( &p->Mutex ), "pthread_mutex_lock" );
+    p->fStop = 1;
+    pthread_cond_broadcast( &p->CondStart );
+    Util_PthCheck( pthread_mutex_unlock( &p->Mutex ), "pthread_mutex_unlock" );
+    for ( i = 1; i < p->nThreads; i++ )
+        pthread_join( p->Threads[i], NULL );
+    pthread_cond_destroy( &p->CondStart );
+    pthread_cond_destroy( &p->CondDone );
+    pthread_mutex_destroy( &p->Mutex );
+#endif
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the number of threads.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Util_PoolThreadNum( Util_Pool_t * p )
+{
+    return p->nThreads;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs the task on all threads and waits for them to finish.]
+
+  Description [The task is called as pFunc(pUser, iThread) with iThread
+  ranging from 0 to nThreads-1. Thread 0 is the calling thread.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Util_PoolRun( Util_Pool_t * p, Util_PoolFunc_t pFunc, void * pUser )
+{
+#ifdef ABC_USE_PTHREADS
+    if ( p->nThreads == 1 )
+    {
+        pFunc( pUser, 0 );
+        return;
+    }
+    Util_PthCheck( pthread_mutex_lock( &p->Mutex ), "pthread_mutex_lock" );
+    p->pFunc = pFunc;
+    p->pUser = pUser;
+    p->nDone = 0;
+    p->iRound++;
+    pthread_cond_broadcast( &p->CondStart );
+    Util_PthCheck( pthread_mutex_unlock( &p->Mutex ), "pthread_mutex_unlock" );
+    pFunc( pUser, 0 );
+    Util_PthCheck( pthread_mutex_lock( &p->Mutex ), "pthread_mutex_lock" );
+    while ( p->nDone < p->nThreads - 1 )
+        pthread_cond_wait( &p->CondDone, &p->Mutex );
+    Util_PthCheck( pthread_mutex_unlock( &p->Mutex ), "pthread_mutex_unlock" );
+#else
+    int i;
+    p->pFunc = pFunc;
+    p->pUser = pUser;
+    for ( i = 0; i < p->nThreads; i++ )
+        pFunc( pUser, i );
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_IMPL_END
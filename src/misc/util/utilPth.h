@@ -0,0 +1,91 @@
+/**CFile****************************************************************
+
+  FileName    [utilPth.h]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Generic interface to pthreads.]
+
+  Synopsis    [Atomic operations, locks and a simple pool of worker threads.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: utilPth.h,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#ifndef ABC__misc__util__utilPth_h
+#define ABC__misc__util__utilPth_h
+
+////////////////////////////////////////////////////////////////////////
+///                          INCLUDES                                ///
+////////////////////////////////////////////////////////////////////////
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                         PARAMETERS                               ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_HEADER_START
+
+#define UTIL_PROC_MAX 128
+
+////////////////////////////////////////////////////////////////////////
+///                         BASIC TYPES                              ///
+////////////////////////////////////////////////////////////////////////
+
+typedef struct Util_Pool_t_ Util_Pool_t;
+typedef struct Util_Lock_t_ Util_Lock_t;
+
+// the task performed by the i-th thread of the pool
+typedef void (*Util_PoolFunc_t)( void * pUser, int iThread );
+
+////////////////////////////////////////////////////////////////////////
+///                      MACRO DEFINITIONS                           ///
+////////////////////////////////////////////////////////////////////////
+
+// atomic operations on 32-bit integers (they also serve as full memory barriers)
+#ifdef _WIN32
+static inline int  Util_AtomicCas( volatile int * p, int Old, int New ) { return InterlockedCompareExchange( (volatile LONG *)p, New, Old ) == Old; }
+static inline int  Util_AtomicAdd( volatile int * p, int Add )          { return InterlockedExchangeAdd( (volatile LONG *)p, Add );               }
+static inline void Util_AtomicBarrier()                                 { MemoryBarrier();                                                        }
+#else
+static inline int  Util_AtomicCas( volatile int * p, int Old, int New ) { return __sync_bool_compare_and_swap( p, Old, New );                     }
+static inline int  Util_AtomicAdd( volatile int * p, int Add )          { return __sync_fetch_and_add( p, Add );                                  }
+static inline void Util_AtomicBarrier()                                 { __sync_synchronize();                                                   }
+#endif
+static inline int  Util_AtomicRead( volatile int * p )                  { int Value = *p; Util_AtomicBarrier(); return Value;                      }
+static inline void Util_AtomicWrite( volatile int * p, int Value )      { Util_AtomicBarrier(); *p = Value;                                        }
+
+////////////////////////////////////////////////////////////////////////
+///                    FUNCTION DECLARATIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/*=== utilPth.c ==========================================================*/
+extern int           Util_PoolIsParallel();
+extern Util_Pool_t * Util_PoolStart( int nThreads );
+extern void          Util_PoolStop( Util_Pool_t * p );
+extern int           Util_PoolThreadNum( Util_Pool_t * p );
+extern void          Util_PoolRun( Util_Pool_t * p, Util_PoolFunc_t pFunc, void * pUser );
+extern abctime       Util_WallClock();
+extern void          Util_ThreadSleep( int nMicroSecs );
+extern Util_Lock_t * Util_LockStart();
+extern void          Util_LockStop( Util_Lock_t * p );
+extern void          Util_LockRead( Util_Lock_t * p );
+extern void          Util_LockWrite( Util_Lock_t * p );
+extern void          Util_LockUnlock( Util_Lock_t * p );
+
+ABC_NAMESPACE_HEADER_END
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,347 @@
+/**CFile****************************************************************
+
+  FileName    [utilSimd.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Bit-parallel simulation kernels.]
+
+  Synopsis    [Operations on simulation info using SIMD instructions.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: utilSimd.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "abc_global.h"
+#include "utilSimd.h"
+
+// the vector kernels are compiled for the target instruction set using
+// function attributes, so that the rest of the code does not depend on
+// the compiler flags, and the kernels are selected at runtime
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__)) && !defined(ABC_NO_SIMD)
+#define UTIL_SIMD_X86
+#include <immintrin.h>
+#define UTIL_SIMD_TARGET_AVX2    __attribute__((target("avx2")))
+#define UTIL_SIMD_TARGET_AVX512  __attribute__((target("avx512f")))
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the scalar code in utilSimd.h is used until Util_SimdInit() is called
+int Util_SimdLevelCur = UTIL_SIMD_NONE;
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+#ifdef UTIL_SIMD_X86
+
+/**Function*************************************************************
+
+  Synopsis    [AVX2 kernels (eight 32-bit units at a time).]
+
+  Description [The units following the last complete vector are processed
+  using a masked load/store. The memory is only accessed through vector
+  loads and stores, so the kernels can be applied to arrays of unsigned 
+  and of word.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+UTIL_SIMD_TARGET_AVX2 static inline __m256i Util_SimdTailAvx2( int nInts )
+{
+    return _mm256_cmpgt_epi32( _mm256_set1_epi32(nInts), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7) );
+}
+UTIL_SIMD_TARGET_AVX2 static inline int Util_SimdFirstAvx2( __m256i x )
+{
+    int Zeros = _mm256_movemask_ps( _mm256_castsi256_ps(_mm256_cmpeq_epi32(x, _mm256_setzero_si256())) );
+    return __builtin_ctz( ~Zeros & 0xFF );
+}
+UTIL_SIMD_TARGET_AVX2 void Util_SimdAndAvx2( void * pRes, void * p0, void * p1, int fCompl0, int fCompl1, int nInts )
+{
+    int * r = (int *)pRes, * a = (int *)p0, * b = (int *)p1;
+    __m256i Mask0 = _mm256_set1_epi32( fCompl0 ? -1 : 0 );
+    __m256i Mask1 = _mm256_set1_epi32( fCompl1 ? -1 : 0 );
+    __m256i x, y, Tail;
+    int w;
+    for ( w = 0; w + 8 <= nInts; w += 8 )
+    {
+        x = _mm256_xor_si256( _mm256_loadu_si256((const __m256i *)(a + w)), Mask0 );
+        y = _mm256_xor_si256( _mm256_loadu_si256((const __m256i *)(b + w)), Mask1 );
+        _mm256_storeu_si256( (__m256i *)(r + w), _mm256_and_si256(x, y) );
+    }
+    if ( w < nInts )
+    {
+        Tail = Util_SimdTailAvx2( nInts - w );
+        x = _mm256_xor_si256( _mm256_maskload_epi32(a + w, Tail), Mask0 );
+        y = _mm256_xor_si256( _mm256_maskload_epi32(b + w, Tail), Mask1 );
+        _mm256_maskstore_epi32( r + w, Tail, _mm256_and_si256(x, y) );
+    }
+}
+UTIL_SIMD_TARGET_AVX2 void Util_SimdCopyAvx2( void * pRes, void * p0, int fCompl, int nInts )
+{
+    int * r = (int *)pRes, * a = (int *)p0;
+    __m256i Mask = _mm256_set1_epi32( fCompl ? -1 : 0 );
+    __m256i Tail;
+    int w;
+    for ( w = 0; w + 8 <= nInts; w += 8 )
+        _mm256_storeu_si256( (__m256i *)(r + w), _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)(a + w)), Mask) );
+    if ( w < nInts )
+    {
+        Tail = Util_SimdTailAvx2( nInts - w );
+        _mm256_maskstore_epi32( r + w, Tail, _mm256_xor_si256(_mm256_maskload_epi32(a + w, Tail), Mask) );
+    }
+}
+UTIL_SIMD_TARGET_AVX2 void Util_SimdFillAvx2( void * pRes, unsigned Value, int nInts )
+{
+    int * r = (int *)pRes;
+    __m256i Fill = _mm256_set1_epi32( (int)Value );
+    int w;
+    for ( w = 0; w + 8 <= nInts; w += 8 )
+        _mm256_storeu_si256( (__m256i *)(r + w), Fill );
+    if ( w < nInts )
+        _mm256_maskstore_epi32( r + w, Util_SimdTailAvx2(nInts - w), Fill );
+}
+UTIL_SIMD_TARGET_AVX2 int Util_SimdFindDiffAvx2( void * p0, void * p1, int fCompl, int nInts )
+{
+    int * a = (int *)p0, * b = (int *)p1;
+    __m256i Mask = _mm256_set1_epi32( fCompl ? -1 : 0 );
+    __m256i x, Tail;
+    int w;
+    for ( w = 0; w + 8 <= nInts; w += 8 )
+    {
+        x = _mm256_xor_si256( _mm256_loadu_si256((const __m256i *)(a + w)), _mm256_loadu_si256((const __m256i *)(b + w)) );
+        x = _mm256_xor_si256( x, Mask );
+        if ( !_mm256_testz_si256(x, x) )
+            return w + Util_SimdFirstAvx2( x );
+    }
+    if ( w < nInts )
+    {
+        Tail = Util_SimdTailAvx2( nInts - w );
+        x = _mm256_xor_si256( _mm256_maskload_epi32(a + w, Tail), _mm256_maskload_epi32(b + w, Tail) );
+        x = _mm256_and_si256( _mm256_xor_si256(x, Mask), Tail );
+        if ( !_mm256_testz_si256(x, x) )
+            return w + Util_SimdFirstAvx2( x );
+    }
+    return -1;
+}
+UTIL_SIMD_TARGET_AVX2 int Util_SimdFindNeqAvx2( void * p, unsigned Value, int nInts )
+{
+    int * a = (int *)p;
+    __m256i Fill = _mm256_set1_epi32( (int)Value );
+    __m256i x, Tail;
+    int w;
+    for ( w = 0; w + 8 <= nInts; w += 8 )
+    {
+        x = _mm256_xor_si256( _mm256_loadu_si256((const __m256i *)(a + w)), Fill );
+        if ( !_mm256_testz_si256(x, x) )
+            return w + Util_SimdFirstAvx2( x );
+    }
+    if ( w < nInts )
+    {
+        Tail = Util_SimdTailAvx2( nInts - w );
+        x = _mm256_and_si256( _mm256_xor_si256(_mm256_maskload_epi32(a + w, Tail), Fill), Tail );
+        if ( !_mm256_testz_si256(x, x) )
+            return w + Util_SimdFirstAvx2( x );
+    }
+    return -1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [AVX-512 kernels (sixteen 32-bit units at a time).]
+
+  Description [The remaining units are processed using a masked
+  load/store, so there is no scalar tail.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+UTIL_SIMD_TARGET_AVX512 void Util_SimdAndAvx512( void * pRes, void * p0, void * p1, int fCompl0, int fCompl1, int nInts )
+{
+    int * r = (int *)pRes, * a = (int *)p0, * b = (int *)p1;
+    __m512i Mask0 = _mm512_set1_epi32( fCompl0 ? -1 : 0 );
+    __m512i Mask1 = _mm512_set1_epi32( fCompl1 ? -1 : 0 );
+    __m512i x, y;
+    __mmask16 Tail;
+    int w;
+    for ( w = 0; w + 16 <= nInts; w += 16 )
+    {
+        x = _mm512_xor_si512( _mm512_loadu_si512((const void *)(a + w)), Mask0 );
+        y = _mm512_xor_si512( _mm512_loadu_si512((const void *)(b + w)), Mask1 );
+        _mm512_storeu_si512( (void *)(r + w), _mm512_and_si512(x, y) );
+    }
+    if ( w < nInts )
+    {
+        Tail = (__mmask16)((1 << (nInts - w)) - 1);
+        x = _mm512_xor_si512( _mm512_maskz_loadu_epi32(Tail, (const void *)(a + w)), Mask0 );
+        y = _mm512_xor_si512( _mm512_maskz_loadu_epi32(Tail, (const void *)(b + w)), Mask1 );
+        _mm512_mask_storeu_epi32( (void *)(r + w), Tail, _mm512_and_si512(x, y) );
+    }
+}
+UTIL_SIMD_TARGET_AVX512 void Util_SimdCopyAvx512( void * pRes, void * p0, int fCompl, int nInts )
+{
+    int * r = (int *)pRes, * a = (int *)p0;
+    __m512i Mask = _mm512_set1_epi32( fCompl ? -1 : 0 );
+    __mmask16 Tail;
+    int w;
+    for ( w = 0; w + 16 <= nInts; w += 16 )
+        _mm512_storeu_si512( (void *)(r + w), _mm512_xor_si512(_mm512_loadu_si512((const void *)(a + w)), Mask) );
+    if ( w < nInts )
+    {
+        Tail = (__mmask16)((1 << (nInts - w)) - 1);
+        _mm512_mask_storeu_epi32( (void *)(r + w), Tail, _mm512_xor_si512(_mm512_maskz_loadu_epi32(Tail, (const void *)(a + w)), Mask) );
+    }
+}
+UTIL_SIMD_TARGET_AVX512 void Util_SimdFillAvx512( void * pRes, unsigned Value, int nInts )
+{
+    int * r = (int *)pRes;
+    __m512i Fill = _mm512_set1_epi32( (int)Value );
+    int w;
+    for ( w = 0; w + 16 <= nInts; w += 16 )
+        _mm512_storeu_si512( (void *)(r + w), Fill );
+    if ( w < nInts )
+        _mm512_mask_storeu_epi32( (void *)(r + w), (__mmask16)((1 << (nInts - w)) - 1), Fill );
+}
+UTIL_SIMD_TARGET_AVX512 int Util_SimdFindDiffAvx512( void * p0, void * p1, int fCompl, int nInts )
+{
+    int * a = (int *)p0, * b = (int *)p1;
+    __m512i Mask = _mm512_set1_epi32( fCompl ? -1 : 0 );
+    __m512i x;
+    __mmask16 Tail, Diff;
+    int w;
+    for ( w = 0; w + 16 <= nInts; w += 16 )
+    {
+        x = _mm512_xor_si512( _mm512_loadu_si512((const void *)(a + w)), _mm512_loadu_si512((const void *)(b + w)) );
+        x = _mm512_xor_si512( x, Mask );
+        Diff = _mm512_test_epi32_mask( x, x );
+        if ( Diff )
+            return w + __builtin_ctz( (unsigned)Diff );
+    }
+    if ( w < nInts )
+    {
+        Tail = (__mmask16)((1 << (nInts - w)) - 1);
+        x = _mm512_xor_si512( _mm512_maskz_loadu_epi32(Tail, (const void *)(a + w)), _mm512_maskz_loadu_epi32(Tail, (const void *)(b + w)) );
+        x = _mm512_xor_si512( x, Mask );
+        Diff = _mm512_mask_test_epi32_mask( Tail, x, x );
+        if ( Diff )
+            return w + __builtin_ctz( (unsigned)Diff );
+    }
+    return -1;
+}
+UTIL_SIMD_TARGET_AVX512 int Util_SimdFindNeqAvx512( void * p, unsigned Value, int nInts )
+{
+    int * a = (int *)p;
+    __m512i Fill = _mm512_set1_epi32( (int)Value );
+    __mmask16 Tail, Diff;
+    int w;
+    for ( w = 0; w + 16 <= nInts; w += 16 )
+    {
+        Diff = _mm512_cmpneq_epi32_mask( _mm512_loadu_si512((const void *)(a + w)), Fill );
+        if ( Diff )
+            return w + __builtin_ctz( (unsigned)Diff );
+    }
+    if ( w < nInts )
+    {
+        Tail = (__mmask16)((1 << (nInts - w)) - 1);
+        Diff = _mm512_mask_cmpneq_epi32_mask( Tail, _mm512_maskz_loadu_epi32(Tail, (const void *)(a + w)), Fill );
+        if ( Diff )
+            return w + __builtin_ctz( (unsigned)Diff );
+    }
+    return -1;
+}
+
+#else
+
+// the vector kernels are never selected without the x86 instruction sets
+void Util_SimdAndAvx2( void * pRes, void * p0, void * p1, int fCompl0, int fCompl1, int nInts )    { assert( 0 ); }
+void Util_SimdCopyAvx2( void * pRes, void * p0, int fCompl, int nInts )                            { assert( 0 ); }
+void Util_SimdFillAvx2( void * pRes, unsigned Value, int nInts )                                   { assert( 0 ); }
+int  Util_SimdFindDiffAvx2( void * p0, void * p1, int fCompl, int nInts )                          { assert( 0 ); return -1; }
+int  Util_SimdFindNeqAvx2( void * p, unsigned Value, int nInts )                                   { assert( 0 ); return -1; }
+void Util_SimdAndAvx512( void * pRes, void * p0, void * p1, int fCompl0, int fCompl1, int nInts )  { assert( 0 ); }
+void Util_SimdCopyAvx512( void * pRes, void * p0, int fCompl, int nInts )                          { assert( 0 ); }
+void Util_SimdFillAvx512( void * pRes, unsigned Value, int nInts )                                 { assert( 0 ); }
+int  Util_SimdFindDiffAvx512( void * p0, void * p1, int fCompl, int nInts )                        { assert( 0 ); return -1; }
+int  Util_SimdFindNeqAvx512( void * p, unsigned Value, int nInts )                                 { assert( 0 ); return -1; }
+
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the best instruction set supported by the CPU.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Util_SimdDetect()
+{
+#ifdef UTIL_SIMD_X86
+    __builtin_cpu_init();
+    if ( __builtin_cpu_supports("avx512f") )
+        return UTIL_SIMD_AVX512;
+    if ( __builtin_cpu_supports("avx2") )
+        return UTIL_SIMD_AVX2;
+#endif
+    return UTIL_SIMD_NONE;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Selects the kernels.]
+
+  Description [Util_SimdInit() is called once when the framework starts,
+  before any threads are created, and selects the best instruction set 
+  supported by the CPU. Util_SimdSetLevel() can reduce the level, for
+  example, to compare the kernels. It should not be called while other 
+  threads are simulating. Returns the level used.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Util_SimdSetLevel( int Level )
+{
+    return Util_SimdLevelCur = Abc_MaxInt( UTIL_SIMD_NONE, Abc_MinInt(Level, Util_SimdDetect()) );
+}
+void Util_SimdInit()
+{
+    Util_SimdSetLevel( UTIL_SIMD_AVX512 );
+}
+const char * Util_SimdName( int Level )
+{
+    if ( Level == UTIL_SIMD_AVX512 )
+        return "AVX-512";
+    if ( Level == UTIL_SIMD_AVX2 )
+        return "AVX2";
+    return "scalar";
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_IMPL_END
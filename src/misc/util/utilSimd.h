@@ -0,0 +1,198 @@
+/**CFile****************************************************************
+
+  FileName    [utilSimd.h]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Bit-parallel simulation kernels.]
+
+  Synopsis    [Operations on simulation info using SIMD instructions.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: utilSimd.h,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#ifndef ABC__misc__util__utilSimd_h
+#define ABC__misc__util__utilSimd_h
+
+////////////////////////////////////////////////////////////////////////
+///                          INCLUDES                                ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                         PARAMETERS                               ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_HEADER_START
+
+// the instruction sets used by the kernels
+#define UTIL_SIMD_NONE    0
+#define UTIL_SIMD_AVX2    1
+#define UTIL_SIMD_AVX512  2
+
+////////////////////////////////////////////////////////////////////////
+///                         BASIC TYPES                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the instruction set selected once by Util_SimdInit()
+extern int Util_SimdLevelCur;
+
+// vector kernels working on nInts 32-bit units (including the last partial vector)
+extern void Util_SimdAndAvx2( void * pRes, void * p0, void * p1, int fCompl0, int fCompl1, int nInts );
+extern void Util_SimdCopyAvx2( void * pRes, void * p0, int fCompl, int nInts );
+extern void Util_SimdFillAvx2( void * pRes, unsigned Value, int nInts );
+extern int  Util_SimdFindDiffAvx2( void * p0, void * p1, int fCompl, int nInts );
+extern int  Util_SimdFindNeqAvx2( void * p, unsigned Value, int nInts );
+extern void Util_SimdAndAvx512( void * pRes, void * p0, void * p1, int fCompl0, int fCompl1, int nInts );
+extern void Util_SimdCopyAvx512( void * pRes, void * p0, int fCompl, int nInts );
+extern void Util_SimdFillAvx512( void * pRes, unsigned Value, int nInts );
+extern int  Util_SimdFindDiffAvx512( void * p0, void * p1, int fCompl, int nInts );
+extern int  Util_SimdFindNeqAvx512( void * p, unsigned Value, int nInts );
+
+////////////////////////////////////////////////////////////////////////
+///                      MACRO DEFINITIONS                           ///
+////////////////////////////////////////////////////////////////////////
+
+// the level is looked up once by the caller and passed to the kernels below,
+// which dispatch with a direct call (the tests are the same for all nodes)
+static inline int  Util_SimdLevel()                                                                                   { return Util_SimdLevelCur; }
+
+// pRes = (p0 ^ Compl0) & (p1 ^ Compl1)
+static inline void Util_SimdAnd( int Level, unsigned * pRes, unsigned * p0, unsigned * p1, int fCompl0, int fCompl1, int nWords )
+{
+    unsigned Mask0 = fCompl0 ? ~0 : 0, Mask1 = fCompl1 ? ~0 : 0;
+    int w;
+    if ( Level == UTIL_SIMD_AVX512 )
+        Util_SimdAndAvx512( pRes, p0, p1, fCompl0, fCompl1, nWords );
+    else if ( Level == UTIL_SIMD_AVX2 )
+        Util_SimdAndAvx2( pRes, p0, p1, fCompl0, fCompl1, nWords );
+    else
+        for ( w = 0; w < nWords; w++ )
+            pRes[w] = (p0[w] ^ Mask0) & (p1[w] ^ Mask1);
+}
+static inline void Util_SimdAndW( int Level, word * pRes, word * p0, word * p1, int fCompl0, int fCompl1, int nWords )
+{
+    word Mask0 = fCompl0 ? ~(word)0 : 0, Mask1 = fCompl1 ? ~(word)0 : 0;
+    int w;
+    if ( Level == UTIL_SIMD_AVX512 )
+        Util_SimdAndAvx512( pRes, p0, p1, fCompl0, fCompl1, 2*nWords );
+    else if ( Level == UTIL_SIMD_AVX2 )
+        Util_SimdAndAvx2( pRes, p0, p1, fCompl0, fCompl1, 2*nWords );
+    else
+        for ( w = 0; w < nWords; w++ )
+            pRes[w] = (p0[w] ^ Mask0) & (p1[w] ^ Mask1);
+}
+// pRes = p0 ^ Compl
+static inline void Util_SimdCopy( int Level, unsigned * pRes, unsigned * p0, int fCompl, int nWords )
+{
+    unsigned Mask = fCompl ? ~0 : 0;
+    int w;
+    if ( Level == UTIL_SIMD_AVX512 )
+        Util_SimdCopyAvx512( pRes, p0, fCompl, nWords );
+    else if ( Level == UTIL_SIMD_AVX2 )
+        Util_SimdCopyAvx2( pRes, p0, fCompl, nWords );
+    else
+        for ( w = 0; w < nWords; w++ )
+            pRes[w] = p0[w] ^ Mask;
+}
+static inline void Util_SimdCopyW( int Level, word * pRes, word * p0, int fCompl, int nWords )
+{
+    word Mask = fCompl ? ~(word)0 : 0;
+    int w;
+    if ( Level == UTIL_SIMD_AVX512 )
+        Util_SimdCopyAvx512( pRes, p0, fCompl, 2*nWords );
+    else if ( Level == UTIL_SIMD_AVX2 )
+        Util_SimdCopyAvx2( pRes, p0, fCompl, 2*nWords );
+    else
+        for ( w = 0; w < nWords; w++ )
+            pRes[w] = p0[w] ^ Mask;
+}
+// pRes = Value
+static inline void Util_SimdFill( int Level, unsigned * pRes, unsigned Value, int nWords )
+{
+    int w;
+    if ( Level == UTIL_SIMD_AVX512 )
+        Util_SimdFillAvx512( pRes, Value, nWords );
+    else if ( Level == UTIL_SIMD_AVX2 )
+        Util_SimdFillAvx2( pRes, Value, nWords );
+    else
+        for ( w = 0; w < nWords; w++ )
+            pRes[w] = Value;
+}
+// returns the first word where p0 != (p1 ^ Compl), or -1
+static inline int  Util_SimdFindDiff( int Level, unsigned * p0, unsigned * p1, int fCompl, int nWords )
+{
+    unsigned Mask = fCompl ? ~0 : 0;
+    int w;
+    if ( Level == UTIL_SIMD_AVX512 )
+        return Util_SimdFindDiffAvx512( p0, p1, fCompl, nWords );
+    if ( Level == UTIL_SIMD_AVX2 )
+        return Util_SimdFindDiffAvx2( p0, p1, fCompl, nWords );
+    for ( w = 0; w < nWords; w++ )
+        if ( p0[w] != (p1[w] ^ Mask) )
+            return w;
+    return -1;
+}
+static inline int  Util_SimdFindDiffW( int Level, word * p0, word * p1, int fCompl, int nWords )
+{
+    word Mask = fCompl ? ~(word)0 : 0;
+    int w;
+    if ( Level == UTIL_SIMD_AVX512 )
+        return (w = Util_SimdFindDiffAvx512( p0, p1, fCompl, 2*nWords )) == -1 ? -1 : w / 2;
+    if ( Level == UTIL_SIMD_AVX2 )
+        return (w = Util_SimdFindDiffAvx2( p0, p1, fCompl, 2*nWords )) == -1 ? -1 : w / 2;
+    for ( w = 0; w < nWords; w++ )
+        if ( p0[w] != (p1[w] ^ Mask) )
+            return w;
+    return -1;
+}
+// returns the first word where p != Value, or -1
+static inline int  Util_SimdFindNeq( int Level, unsigned * p, unsigned Value, int nWords )
+{
+    int w;
+    if ( Level == UTIL_SIMD_AVX512 )
+        return Util_SimdFindNeqAvx512( p, Value, nWords );
+    if ( Level == UTIL_SIMD_AVX2 )
+        return Util_SimdFindNeqAvx2( p, Value, nWords );
+    for ( w = 0; w < nWords; w++ )
+        if ( p[w] != Value )
+            return w;
+    return -1;
+}
+// returns the first word where p != (Compl ? ~0 : 0), or -1
+static inline int  Util_SimdFindNeqW( int Level, word * p, int fCompl, int nWords )
+{
+    word Value = fCompl ? ~(word)0 : 0;
+    int w;
+    if ( Level == UTIL_SIMD_AVX512 )
+        return (w = Util_SimdFindNeqAvx512( p, (unsigned)Value, 2*nWords )) == -1 ? -1 : w / 2;
+    if ( Level == UTIL_SIMD_AVX2 )
+        return (w = Util_SimdFindNeqAvx2( p, (unsigned)Value, 2*nWords )) == -1 ? -1 : w / 2;
+    for ( w = 0; w < nWords; w++ )
+        if ( p[w] != Value )
+            return w;
+    return -1;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                    FUNCTION DECLARATIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/*=== utilSimd.c ==========================================================*/
+extern void          Util_SimdInit();
+extern int           Util_SimdSetLevel( int Level );
+extern const char *  Util_SimdName( int Level );
+
+ABC_NAMESPACE_HEADER_END
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
@@ -37,6 +37,9 @@
 
 ABC_NAMESPACE_HEADER_START
 
+// the max number of provers run on each abstraction (&gla -q -K num)
+#define ABS_PROVER_MAX  6
+
 
 ////////////////////////////////////////////////////////////////////////
 ///                         BASIC TYPES                              ///
@@ -67,15 +70,18 @@ struct Abs_Par_t_
     int            fUseSimple;         // use simple CNF construction
     int            fSkipHash;          // skip hashing CNF while unrolling
     int            fUseFullProof;      // use full proof for UNSAT cores
+    int            fProofStream;       // stream the full proof to a file instead of memory
     int            fDumpVabs;          // dumps the abstracted model
     int            fDumpMabs;          // dumps the original AIG with abstraction map
     int            fCallProver;        // calls the prover
     int            fSimpProver;        // calls simplification before prover
+    int            nProvers;           // the number of provers run on each abstraction
     char *         pFileVabs;          // dumps the abstracted model into this file
     int            fVerbose;           // verbose flag
     int            fVeryVerbose;       // print additional information
     int            iFrame;             // the number of frames covered
     int            iFrameProved;       // the number of frames proved
+    int            iFrameProvedBmc;    // the number of frames proved by BMC on the abstractions
     int            nFramesNoChange;    // the number of last frames without changes
     int            nFramesNoChangeLim; // the number of last frames without changes to dump abstraction
 };
@@ -135,9 +141,11 @@ extern int               Gia_ManPerformGlaOld( Gia_Man_t * p, Abs_Par_t * pPars,
 /*=== absIter.c =========================================================*/
 extern Gia_Man_t *       Gia_ManShrinkGla( Gia_Man_t * p, int nFrameMax, int nTimeOut, int fUsePdr, int fUseSat, int fUseBdd, int fVerbose );
 /*=== absPth.c =========================================================*/
-extern void              Gia_GlaProveAbsracted( Gia_Man_t * p, int fSimpProver, int fVerbose );
+extern void              Gia_GlaProveAbsracted( Gia_Man_t * p, int fSimpProver, int nProvers, int fVerbose );
 extern void              Gia_GlaProveCancel( int fVerbose );
 extern int               Gia_GlaProveCheck( int fVerbose );
+extern int               Gia_GlaProveFrames( int fVerbose );
+extern void              Gia_GlaProveStop( int fVerbose );
 /*=== absVta.c =========================================================*/
 extern int               Gia_VtaPerform( Gia_Man_t * pAig, Abs_Par_t * pPars );
 /*=== absUtil.c =========================================================*/
@@ -1570,8 +1570,11 @@ int Gia_ManPerformGla( Gia_Man_t * pAig, Abs_Par_t * pPars )
             Vec_IntFillExtra( Ga2_MapFrameMap(p, f), Vec_IntSize(p->vValues), -1 );
             // add static clauses to this timeframe
             Ga2_ManAddAbsClauses( p, f );
+            // account for the frames proved by the provers on the abstractions (&gla -q)
+            if ( p->pPars->fCallProver )
+                p->pPars->iFrameProvedBmc = Gia_GlaProveFrames(pPars->fVerbose);
             // skip checking if skipcheck is enabled (&gla -s)
-            if ( p->pPars->fUseSkip && f <= p->pPars->iFrameProved )
+            if ( p->pPars->fUseSkip && (f <= p->pPars->iFrameProved || f <= p->pPars->iFrameProvedBmc) )
                 continue;
             // skip checking if we need to skip several starting frames (&gla -S <num>)
             if ( p->pPars->nFramesStart && f <= p->pPars->nFramesStart )
@@ -1782,7 +1785,7 @@ int Gia_ManPerformGla( Gia_Man_t * pAig, Abs_Par_t * pPars )
                     if ( iFrameTryToProve >= 0 )
                         Gia_GlaProveCancel( pPars->fVerbose );
                     // prove new one
-                    Gia_GlaProveAbsracted( pAig, pPars->fSimpProver, pPars->fVeryVerbose );
+                    Gia_GlaProveAbsracted( pAig, pPars->fSimpProver, pPars->nProvers, pPars->fVeryVerbose );
                     iFrameTryToProve = f;
                     p->nPdrCalls++;
                 }
@@ -1811,9 +1814,9 @@ int Gia_ManPerformGla( Gia_Man_t * pAig, Abs_Par_t * pPars )
     }
 finish:
     Prf_ManStopP( &p->pSat->pPrf2 );
-    // cancel old one if it is proving
-    if ( iFrameTryToProve >= 0 )
-        Gia_GlaProveCancel( pPars->fVerbose );
+    // cancel the provers and wait until they quit
+    if ( pPars->fCallProver )
+        Gia_GlaProveStop( pPars->fVerbose );
     // analize the results
     if ( !p->fUseNewLine )
         Abc_Print( 1, "\n" );
@@ -1833,6 +1836,8 @@ finish:
             Abc_Print( 1, "GLA found that the size of abstraction exceeds %d %% in frame %d.  ", pPars->nRatioMin, p->pPars->iFrameProved+1 );
         else
             Abc_Print( 1, "GLA finished %d frames and produced a %d-stable abstraction.  ", p->pPars->iFrameProved+1, p->pPars->nFramesNoChange );
+        if ( p->pPars->iFrameProvedBmc > p->pPars->iFrameProved )
+            Abc_Print( 1, "BMC on the abstractions proved %d frames.  ", p->pPars->iFrameProvedBmc+1 );
         p->pPars->iFrame = p->pPars->iFrameProved;
     }
     else
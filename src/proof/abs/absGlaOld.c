@@ -973,7 +973,9 @@ Gla_Man_t * Gla_ManStart( Gia_Man_t * pGia0, Abs_Par_t * pPars )
     }
     // other 
     p->pSat        = sat_solver2_new();
-    if ( pPars->fUseFullProof )
+    if ( pPars->fProofStream )
+        p->pSat->pPrf3 = Prf_LogStart( NULL, (1 << 20) );
+    if ( pPars->fUseFullProof && p->pSat->pPrf3 == NULL )
         p->pSat->pPrf1 = Vec_SetAlloc( 20 );
 //    p->pSat->fVerbose = p->pPars->fVerbose;
 //    sat_solver2_set_learntmax( p->pSat, pPars->nLearnedMax );
@@ -1557,6 +1559,8 @@ void Gla_ManReportMemory( Gla_Man_t * p )
     ABC_PRMP( "Memory: Refine   ", memRef, memTot );
     ABC_PRMP( "Memory: Other    ", memOth, memTot );
     ABC_PRMP( "Memory: TOTAL    ", memTot, memTot );
+    if ( p->pSat->pPrf3 )
+        Abc_Print( 1, "Proof streamed to disk = %.2f MB\n", Prf_LogFileSize(p->pSat->pPrf3) / (1<<20) );
 }
 
 
@@ -1781,7 +1785,7 @@ int Gia_ManPerformGlaOld( Gia_Man_t * pAig, Abs_Par_t * pPars, int fStartVta )
 
                 // start incremental proof manager
                 assert( p->pSat->pPrf2 == NULL );
-                if ( p->pSat->pPrf1 == NULL )
+                if ( p->pSat->pPrf1 == NULL && p->pSat->pPrf3 == NULL )
                     p->pSat->pPrf2 = Prf_ManAlloc();
                 if ( p->pSat->pPrf2 )
                 {
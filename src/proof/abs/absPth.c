@@ -21,6 +21,8 @@
 #include "abs.h"
 #include "proof/pdr/pdr.h"
 #include "proof/ssw/ssw.h"
+#include "proof/int/int.h"
+#include "sat/bmc/bmc.h"
 
 
 #ifdef ABC_USE_PTHREADS
@@ -42,28 +44,67 @@ ABC_NAMESPACE_IMPL_START
 
 #ifndef ABC_USE_PTHREADS
 
-void Gia_GlaProveAbsracted( Gia_Man_t * p, int fSimpProver, int fVerbose ) {}
+void Gia_GlaProveAbsracted( Gia_Man_t * p, int fSimpProver, int nProvers, int fVerbose ) {}
 void Gia_GlaProveCancel( int fVerbose )                                    {}
 int  Gia_GlaProveCheck( int fVerbose )                                     { return 0; }
+int  Gia_GlaProveFrames( int fVerbose )                                    { return -1; }
+void Gia_GlaProveStop( int fVerbose )                                      {}
 
 #else // pthreads are used
 
+// the provers run on each abstraction (the first nProvers of them are used)
+typedef enum {
+    ABS_PROVER_PDR,           // PDR with default settings
+    ABS_PROVER_BMC,           // BMC (reports the proved frames to the GLA loop)
+    ABS_PROVER_INT,           // interpolation
+    ABS_PROVER_PDR_MONO,      // PDR with monolythic CNF
+    ABS_PROVER_PDR_TWO,       // PDR with two rounds of generalization
+    ABS_PROVER_PDR_SKIP       // PDR without expensive generalization
+} Abs_Prover_t;
+
+static char * s_ProverNames[ABS_PROVER_MAX] = { "pdr", "bmc3", "int", "pdr -m", "pdr -r", "pdr -g" };
+
 // information given to the thread
 typedef struct Abs_ThData_t_
 {
     Aig_Man_t * pAig;
+    int         Prover;
     int         fVerbose;
     int         RunId;
+    volatile int fStop;       // raised when the abstraction is cancelled (checked by the SAT solvers)
 } Abs_ThData_t;
 
 // mutext to control access to shared variables
 pthread_mutex_t g_mutex = PTHREAD_MUTEX_INITIALIZER;
+// mutext to serialize interpolation (it uses the global CNF manager and rewriting library)
+pthread_mutex_t g_mutexInt = PTHREAD_MUTEX_INITIALIZER;
 static volatile int g_nRunIds = 0;             // the number of the last prover instance
 static volatile int g_fAbstractionProved = 0;  // set to 1 when prover successed to prove
+static pthread_t * g_pThreads = NULL;          // the prover threads started since the last stop
+static Abs_ThData_t ** g_pThData = NULL;       // their data (freed after they are joined)
+static int g_nThreads = 0, g_nThreadsAlloc = 0; // (used only by the thread running GLA)
+static volatile int g_iFrameProved = -1;       // the last frame proved by BMC on any abstraction
+static volatile int g_nProverPos = 0;          // the number of outputs of the abstractions
 
 // call back procedure for PDR
 int Abs_CallBackToStop( int RunId ) { assert( RunId <= g_nRunIds ); return RunId < g_nRunIds; }
 
+// call back procedure for BMC (any abstraction over-approximates the design,
+// so the frames proved on a stale abstraction are still valid for the design);
+// BMC calls it for each output proved in the frame, and it stops at the first
+// output that is not proved, so the frame is proved with its last output
+int Abs_CallBackOnFrameDone( int iFrame, int iPo, int Status )
+{
+    int status;
+    if ( Status != 1 || iPo != g_nProverPos - 1 )
+        return 0;
+    status = pthread_mutex_lock(&g_mutex);  assert( status == 0 );
+    if ( g_iFrameProved < iFrame )
+        g_iFrameProved = iFrame;
+    status = pthread_mutex_unlock(&g_mutex);  assert( status == 0 );
+    return 0;
+}
+
 // test procedure to replace PDR
 int Pdr_ManSolve_test( Aig_Man_t * pAig, Pdr_Par_t * pPars, Abc_Cex_t ** ppCex )
 {
@@ -81,12 +122,74 @@ int Pdr_ManSolve_test( Aig_Man_t * pAig, Pdr_Par_t * pPars, Abc_Cex_t ** ppCex )
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
+/**Function*************************************************************
+
+  Synopsis    [Runs one prover on the abstraction.]
+
+  Description [Returns 1 if the abstraction is proved, 0 if it is
+  disproved, and -1 if undecided or cancelled.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abs_ProverRun( Abs_ThData_t * pThData )
+{
+    Aig_Man_t * pAig = pThData->pAig;
+    int RetValue, iFrame, status;
+    if ( pThData->Prover == ABS_PROVER_BMC )
+    {
+        Saig_ParBmc_t Pars, * pPars = &Pars;
+        Saig_ParBmcSetDefaultParams( pPars );
+        pPars->fSilent          = 1;
+        pPars->fNotVerbose      = 1;
+        pPars->RunId            = pThData->RunId;
+        pPars->pFuncStop        = Abs_CallBackToStop;
+        pPars->pStop            = &pThData->fStop;
+        pPars->pFuncOnFrameDone = Abs_CallBackOnFrameDone;
+        return Saig_ManBmcScalable( pAig, pPars );
+    }
+    if ( pThData->Prover == ABS_PROVER_INT )
+    {
+        Inter_ManParams_t Pars, * pPars = &Pars;
+        if ( Saig_ManRegNum(pAig) == 0 || Saig_ManPiNum(pAig) == 0 )
+            return -1;
+        // wait for the previous interpolation run to finish
+        status = pthread_mutex_lock(&g_mutexInt);  assert( status == 0 );
+        if ( Abs_CallBackToStop(pThData->RunId) )
+            RetValue = -1;
+        else
+        {
+            Inter_ManSetDefaultParams( pPars );
+            pPars->RunId     = pThData->RunId;
+            pPars->pFuncStop = Abs_CallBackToStop;
+            pPars->pStop     = &pThData->fStop;
+            RetValue = Inter_ManPerformInterpolation( pAig, pPars, &iFrame );
+        }
+        status = pthread_mutex_unlock(&g_mutexInt);  assert( status == 0 );
+        return RetValue;
+    }
+    else
+    {
+        Pdr_Par_t Pars, * pPars = &Pars;
+        Pdr_ManSetDefaultParams( pPars );
+        pPars->fSilent      = 1;
+        pPars->RunId        = pThData->RunId;
+        pPars->pFuncStop    = Abs_CallBackToStop;
+        pPars->fMonoCnf     = (pThData->Prover == ABS_PROVER_PDR_MONO);
+        pPars->fTwoRounds   = (pThData->Prover == ABS_PROVER_PDR_TWO);
+        pPars->fSkipGeneral = (pThData->Prover == ABS_PROVER_PDR_SKIP);
+        return Pdr_ManSolve( pAig, pPars );
+    }
+}
+
 /**Function*************************************************************
 
   Synopsis    [Create one thread]
 
   Description []
-               
+
   SideEffects []
 
   SeeAlso     []
@@ -95,14 +198,9 @@ int Pdr_ManSolve_test( Aig_Man_t * pAig, Pdr_Par_t * pPars, Abc_Cex_t ** ppCex )
 void * Abs_ProverThread( void * pArg )
 {
     Abs_ThData_t * pThData = (Abs_ThData_t *)pArg;
-    Pdr_Par_t Pars, * pPars = &Pars;
     int RetValue, status;
-    // call PDR
-    Pdr_ManSetDefaultParams( pPars );
-    pPars->fSilent   = 1;
-    pPars->RunId     = pThData->RunId;
-    pPars->pFuncStop = Abs_CallBackToStop;
-    RetValue = Pdr_ManSolve( pThData->pAig, pPars );
+    // call the prover
+    RetValue = Abs_ProverRun( pThData );
     // update the result
     if ( RetValue == 1 )
     {
@@ -114,33 +212,40 @@ void * Abs_ProverThread( void * pArg )
     if ( pThData->fVerbose )
     {
         if ( RetValue == 1 )
-            Abc_Print( 1, "Proved abstraction %d.\n", pThData->RunId );
+            Abc_Print( 1, "Proved abstraction %d using \"%s\".\n", pThData->RunId, s_ProverNames[pThData->Prover] );
         else if ( RetValue == 0 )
-            Abc_Print( 1, "Disproved abstraction %d.\n", pThData->RunId );
+            Abc_Print( 1, "Disproved abstraction %d using \"%s\".\n", pThData->RunId, s_ProverNames[pThData->Prover] );
         else if ( RetValue == -1 )
-            Abc_Print( 1, "Cancelled abstraction %d.\n", pThData->RunId );
+            Abc_Print( 1, "Cancelled abstraction %d using \"%s\".\n", pThData->RunId, s_ProverNames[pThData->Prover] );
         else assert( 0 );
     }
-    // free memory
+    // free memory (the thread data is freed by Gia_GlaProveStop)
     Aig_ManStop( pThData->pAig );
-    ABC_FREE( pThData );
+    pThData->pAig = NULL;
     // quit this thread
 	pthread_exit( NULL );
 	assert(0);
 	return NULL;
 }
-void Gia_GlaProveAbsracted( Gia_Man_t * pGia, int fSimpProver, int fVerbose )
+static void Abs_ProverStopAll()
+{
+    int i;
+    // the provers started so far work on the abstractions being cancelled
+    for ( i = 0; i < g_nThreads; i++ )
+        g_pThData[i]->fStop = 1;
+}
+void Gia_GlaProveAbsracted( Gia_Man_t * pGia, int fSimpProver, int nProvers, int fVerbose )
 {
     extern Aig_Man_t * Dar_ManRwsat( Aig_Man_t * pAig, int fBalance, int fVerbose );
     Abs_ThData_t * pThData;
     Ssw_Pars_t Pars, * pPars = &Pars;
     Aig_Man_t * pAig, * pTemp;
     Gia_Man_t * pAbs;
-	pthread_t ProverThread;
-    int status;
+    int i, RunId, status;
+    assert( nProvers >= 1 && nProvers <= ABS_PROVER_MAX );
     // disable verbosity
 //    fVerbose = 0;
-    // create abstraction 
+    // create abstraction
     assert( pGia->vGateClasses != NULL );
     pAbs = Gia_ManDupAbsGates( pGia, pGia->vGateClasses );
     Gia_ManCleanValue( pGia );
@@ -158,29 +263,41 @@ void Gia_GlaProveAbsracted( Gia_Man_t * pGia, int fSimpProver, int fVerbose )
         Aig_ManStop( pTemp );
     }
     // synthesize abstraction
-//    pAig = Dar_ManRwsat( pTemp = pAig, 0, 0 ); 
+//    pAig = Dar_ManRwsat( pTemp = pAig, 0, 0 );
 //    Aig_ManStop( pTemp );
-    // reset the proof 
+    // reset the proof
     status = pthread_mutex_lock(&g_mutex);  assert( status == 0 );
     g_fAbstractionProved = 0;
+    g_nProverPos = Saig_ManPoNum(pAig);
+    RunId = ++g_nRunIds;
+    Abs_ProverStopAll();
     status = pthread_mutex_unlock(&g_mutex);  assert( status == 0 );
-    // collect thread data
-    pThData = ABC_CALLOC( Abs_ThData_t, 1 );
-    pThData->pAig = pAig;
-    pThData->fVerbose = fVerbose;
-    status = pthread_mutex_lock(&g_mutex);  assert( status == 0 );
-    pThData->RunId = ++g_nRunIds;
-    status = pthread_mutex_unlock(&g_mutex);  assert( status == 0 );
-    // create thread
-    if ( fVerbose )  Abc_Print( 1, "\nTrying to prove abstraction %d.\n", pThData->RunId );
-    status = pthread_create( &ProverThread, NULL, Abs_ProverThread, pThData );
-    assert( status == 0 );
+    if ( fVerbose )  Abc_Print( 1, "\nTrying to prove abstraction %d.\n", RunId );
+    // start the provers (each of them gets its own copy of the abstraction)
+    if ( g_nThreads + nProvers > g_nThreadsAlloc )
+    {
+        g_nThreadsAlloc = Abc_MaxInt( 2 * g_nThreadsAlloc, g_nThreads + nProvers );
+        g_pThreads = ABC_REALLOC( pthread_t, g_pThreads, g_nThreadsAlloc );
+        g_pThData  = ABC_REALLOC( Abs_ThData_t *, g_pThData, g_nThreadsAlloc );
+    }
+    for ( i = 0; i < nProvers; i++ )
+    {
+        pThData = ABC_CALLOC( Abs_ThData_t, 1 );
+        pThData->pAig = (i == nProvers - 1) ? pAig : Aig_ManDupSimple( pAig );
+        pThData->Prover = i;
+        pThData->fVerbose = fVerbose;
+        pThData->RunId = RunId;
+        g_pThData[g_nThreads] = pThData;
+        status = pthread_create( g_pThreads + g_nThreads++, NULL, Abs_ProverThread, pThData );
+        assert( status == 0 );
+    }
 }
 void Gia_GlaProveCancel( int fVerbose )
 {
     int status;
     status = pthread_mutex_lock(&g_mutex);  assert( status == 0 );
     g_nRunIds++;
+    Abs_ProverStopAll();
     status = pthread_mutex_unlock(&g_mutex);  assert( status == 0 );
 }
 int Gia_GlaProveCheck( int fVerbose )
@@ -193,6 +310,34 @@ int Gia_GlaProveCheck( int fVerbose )
     status = pthread_mutex_unlock(&g_mutex);  assert( status == 0 );
     return 1;
 }
+int Gia_GlaProveFrames( int fVerbose )
+{
+    int status, iFrame;
+    status = pthread_mutex_lock(&g_mutex);  assert( status == 0 );
+    iFrame = g_iFrameProved;
+    status = pthread_mutex_unlock(&g_mutex);  assert( status == 0 );
+    return iFrame;
+}
+void Gia_GlaProveStop( int fVerbose )
+{
+    int i, status;
+    // cancel the provers and wait until they quit
+    Gia_GlaProveCancel( fVerbose );
+    for ( i = 0; i < g_nThreads; i++ )
+    {
+        status = pthread_join( g_pThreads[i], NULL );
+        assert( status == 0 );
+        ABC_FREE( g_pThData[i] );
+    }
+    ABC_FREE( g_pThreads );
+    ABC_FREE( g_pThData );
+    g_nThreads = g_nThreadsAlloc = 0;
+    // reset the results for the next run
+    status = pthread_mutex_lock(&g_mutex);  assert( status == 0 );
+    g_fAbstractionProved = 0;
+    g_iFrameProved = -1;
+    status = pthread_mutex_unlock(&g_mutex);  assert( status == 0 );
+}
 
 #endif // pthreads are used
 
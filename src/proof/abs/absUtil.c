@@ -58,9 +58,11 @@ void Abs_ParSetDefaults( Abs_Par_t * p )
     p->fUseTermVars       =      0;   // use terminal variables
     p->fUseRollback       =      0;   // use rollback to the starting number of frames
     p->fPropFanout        =      1;   // propagate fanouts during refinement
+    p->nProvers           =      1;   // the number of provers run on each abstraction
     p->fVerbose           =      0;   // verbose flag
     p->iFrame             =     -1;   // the number of frames covered 
     p->iFrameProved       =     -1;   // the number of frames proved
+    p->iFrameProvedBmc    =     -1;   // the number of frames proved by BMC on the abstractions
     p->nFramesNoChangeLim =      2;   // the number of frames without change to dump abstraction
 }
 
@@ -1005,7 +1005,10 @@ Vta_Man_t * Vga_ManStart( Gia_Man_t * pGia, Abs_Par_t * pPars )
     // other data
     p->vCores      = Vec_PtrAlloc( 100 );
     p->pSat        = sat_solver2_new();
-    p->pSat->pPrf1 = Vec_SetAlloc( 20 );
+    if ( p->pPars->fProofStream )
+        p->pSat->pPrf3 = Prf_LogStart( NULL, (1 << 20) );
+    if ( p->pSat->pPrf3 == NULL )
+        p->pSat->pPrf1 = Vec_SetAlloc( 20 );
 //    p->pSat->fVerbose = p->pPars->fVerbose;
 //    sat_solver2_set_learntmax( p->pSat, pPars->nLearnedMax );
     p->pSat->nLearntStart = p->pPars->nLearnedStart;
@@ -1475,6 +1478,8 @@ void Gia_VtaPrintMemory( Vta_Man_t * p )
     ABC_PRMP( "Memory: Map     ", memMap, memTot );
     ABC_PRMP( "Memory: Other   ", memOth, memTot );
     ABC_PRMP( "Memory: TOTAL   ", memTot, memTot );
+    if ( p->pSat->pPrf3 )
+        Abc_Print( 1, "Proof streamed to disk = %.2f MB\n", Prf_LogFileSize(p->pSat->pPrf3) / (1<<20) );
 }
 
 
@@ -51,6 +51,9 @@ struct Cec_ParSat_t_
     int              fCheckMiter;   // the circuit is the miter
 //    int              fFirstStop;    // stop on the first sat output
     int              fLearnCls;     // perform clause learning
+    int              fLbdMode;      // use LBD-based clause management and restarts
+    int              fIncremental;  // collect garbage in one solver instead of recycling it
+    int              nProcs;        // the number of threads (for circuit SAT only)
     int              fVerbose;      // verbose stats
 };
 
@@ -69,6 +72,7 @@ struct Cec_ParSim_t_
     int              fSeqSimulate;  // performs sequential simulation
     int              fLatchCorr;    // consider only latch outputs
     int              fConstCorr;    // consider only constants
+    int              fEventSim;     // resimulate counter-examples only in the TFO of the changed CIs
     int              fVeryVerbose;  // verbose stats
     int              fVerbose;      // verbose stats
 };
@@ -108,6 +112,10 @@ struct Cec_ParFra_t_
     int              fColorDiff;    // miter with separate outputs
     int              fSatSweeping;  // enable SAT sweeping
     int              fRunCSat;      // enable another solver
+    int              fLearnCls;     // use clause learning in the circuit-based solver
+    int              nProcs;        // the number of threads of the circuit-based solver
+    int              fLbdMode;      // use LBD-based clause management and restarts
+    int              fIncremental;  // collect garbage in one solver instead of recycling it
     int              fVeryVerbose;  // verbose stats
     int              fVerbose;      // verbose stats
     int              iOutFail;      // the failed output
@@ -123,6 +131,8 @@ struct Cec_ParCec_t_
     int              fUseSmartCnf;  // use smart CNF computation
     int              fRewriting;    // enables AIG rewriting
     int              fNaive;        // performs naive SAT-based checking
+    int              nProcs;        // the number of threads of the circuit-based solver (0 = not used)
+    int              fIncremental;  // collect garbage in one solver instead of recycling it
     int              fSilent;       // print no messages
     int              fVeryVerbose;  // verbose stats
     int              fVerbose;      // verbose stats
@@ -148,6 +158,8 @@ struct Cec_ParCor_t_
 //    int              fFirstStop;    // stop on the first sat output
     int              fUseSmartCnf;  // use smart CNF computation
     int              fStopWhenGone; // quit when PO is not a candidate constant
+    int              fIncremental;  // collect garbage in one solver instead of recycling it
+    int              fEventSim;     // resimulate counter-examples only in the TFO of the changed CIs
     int              fVerboseFlops; // verbose stats
     int              fVeryVerbose;  // verbose stats
     int              fVerbose;      // verbose stats
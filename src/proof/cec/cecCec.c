@@ -356,6 +356,9 @@ int Cec_ManVerify( Gia_Man_t * pInit, Cec_ParCec_t * pPars )
     pParsFra->nBTLimit     = pPars->nBTLimit;
     pParsFra->TimeLimit    = pPars->TimeLimit;
     pParsFra->fVerbose     = pPars->fVerbose;
+    pParsFra->fIncremental = pPars->fIncremental;
+    pParsFra->fRunCSat     = (pPars->nProcs > 0);
+    pParsFra->nProcs       = pPars->nProcs;
     pParsFra->fCheckMiter  = 1;
     pParsFra->fDualOut     = 1;
     pNew = Cec_ManSatSweeping( p, pParsFra, pPars->fSilent );
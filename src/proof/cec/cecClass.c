@@ -19,6 +19,7 @@
 ***********************************************************************/
 
 #include "cecInt.h"
+#include "misc/util/utilSimd.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -49,21 +50,7 @@ static inline float      Cec_MemUsage( Cec_ManSim_t * p )                  { ret
 ***********************************************************************/
 int Cec_ManSimCompareConst( unsigned * p, int nWords )
 {
-    int w;
-    if ( p[0] & 1 )
-    {
-        for ( w = 0; w < nWords; w++ )
-            if ( p[w] != ~0 )
-                return 0;
-        return 1;
-    }
-    else
-    {
-        for ( w = 0; w < nWords; w++ )
-            if ( p[w] != 0 )
-                return 0;
-        return 1;
-    }
+    return Util_SimdFindNeq( Util_SimdLevel(), p, (p[0] & 1) ? ~0 : 0, nWords ) == -1;
 }
 
 /**Function*************************************************************
@@ -79,21 +66,7 @@ int Cec_ManSimCompareConst( unsigned * p, int nWords )
 ***********************************************************************/
 int Cec_ManSimCompareEqual( unsigned * p0, unsigned * p1, int nWords )
 {
-    int w;
-    if ( (p0[0] & 1) == (p1[0] & 1) )
-    {
-        for ( w = 0; w < nWords; w++ )
-            if ( p0[w] != p1[w] )
-                return 0;
-        return 1;
-    }
-    else
-    {
-        for ( w = 0; w < nWords; w++ )
-            if ( p0[w] != ~p1[w] )
-                return 0;
-        return 1;
-    }
+    return Util_SimdFindDiff( Util_SimdLevel(), p0, p1, (p0[0] & 1) != (p1[0] & 1), nWords ) == -1;
 }
 
 /**Function*************************************************************
@@ -109,21 +82,11 @@ int Cec_ManSimCompareEqual( unsigned * p0, unsigned * p1, int nWords )
 ***********************************************************************/
 int Cec_ManSimCompareConstFirstBit( unsigned * p, int nWords )
 {
-    int w;
-    if ( p[0] & 1 )
-    {
-        for ( w = 0; w < nWords; w++ )
-            if ( p[w] != ~0 )
-                return 32*w + Gia_WordFindFirstBit( ~p[w] );
-        return -1;
-    }
-    else
-    {
-        for ( w = 0; w < nWords; w++ )
-            if ( p[w] != 0 )
-                return 32*w + Gia_WordFindFirstBit( p[w] );
+    unsigned Mask = (p[0] & 1) ? ~0 : 0;
+    int w = Util_SimdFindNeq( Util_SimdLevel(), p, Mask, nWords );
+    if ( w == -1 )
         return -1;
-    }
+    return 32*w + Gia_WordFindFirstBit( p[w] ^ Mask );
 }
 
 /**Function*************************************************************
@@ -139,21 +102,11 @@ int Cec_ManSimCompareConstFirstBit( unsigned * p, int nWords )
 ***********************************************************************/
 int Cec_ManSimCompareEqualFirstBit( unsigned * p0, unsigned * p1, int nWords )
 {
-    int w;
-    if ( (p0[0] & 1) == (p1[0] & 1) )
-    {
-        for ( w = 0; w < nWords; w++ )
-            if ( p0[w] != p1[w] )
-                return 32*w + Gia_WordFindFirstBit( p0[w] ^ p1[w] );
+    unsigned Mask = ((p0[0] & 1) != (p1[0] & 1)) ? ~0 : 0;
+    int w = Util_SimdFindDiff( Util_SimdLevel(), p0, p1, Mask != 0, nWords );
+    if ( w == -1 )
         return -1;
-    }
-    else
-    {
-        for ( w = 0; w < nWords; w++ )
-            if ( p0[w] != ~p1[w] )
-                return 32*w + Gia_WordFindFirstBit( p0[w] ^ ~p1[w] );
-        return -1;
-    }
+    return 32*w + Gia_WordFindFirstBit( p0[w] ^ p1[w] ^ Mask );
 }
 
 /**Function*************************************************************
@@ -653,7 +606,7 @@ int Cec_ManSimSimulateRound( Cec_ManSim_t * p, Vec_Ptr_t * vInfoCis, Vec_Ptr_t *
 {
     Gia_Obj_t * pObj;
     unsigned * pRes0, * pRes1, * pRes;
-    int i, k, w, Ent, iCiId = 0, iCoId = 0;
+    int i, k, w, Ent, iCiId = 0, iCoId = 0, Level = Util_SimdLevel();
     // prepare internal storage
     if ( p->nWordsOld != p->nWords )
         Cec_ManSimMemRelink( p );
@@ -667,8 +620,7 @@ int Cec_ManSimSimulateRound( Cec_ManSim_t * p, Vec_Ptr_t * vInfoCis, Vec_Ptr_t *
     if ( Gia_ObjValue(Gia_ManConst0(p->pAig)) )
     {
         pRes = Cec_ManSimSimRef( p, 0 );
-        for ( w = 1; w <= p->nWords; w++ )
-            pRes[w] = 0;
+        Util_SimdFill( Level, pRes + 1, 0, p->nWords );
     }
     Gia_ManForEachObj1( p->pAig, pObj, i )
     {
@@ -683,8 +635,7 @@ int Cec_ManSimSimulateRound( Cec_ManSim_t * p, Vec_Ptr_t * vInfoCis, Vec_Ptr_t *
             if ( vInfoCis ) 
             {
                 pRes0 = (unsigned *)Vec_PtrEntry( vInfoCis, iCiId++ );
-                for ( w = 1; w <= p->nWords; w++ )
-                    pRes[w] = pRes0[w-1];
+                Util_SimdCopy( Level, pRes + 1, pRes0, 0, p->nWords );
             }
             else
             {
@@ -701,12 +652,7 @@ int Cec_ManSimSimulateRound( Cec_ManSim_t * p, Vec_Ptr_t * vInfoCis, Vec_Ptr_t *
             if ( vInfoCos )
             {
                 pRes = (unsigned *)Vec_PtrEntry( vInfoCos, iCoId++ );
-                if ( Gia_ObjFaninC0(pObj) )
-                    for ( w = 1; w <= p->nWords; w++ )
-                        pRes[w-1] = ~pRes0[w];
-                else 
-                    for ( w = 1; w <= p->nWords; w++ )
-                        pRes[w-1] = pRes0[w];
+                Util_SimdCopy( Level, pRes, pRes0 + 1, Gia_ObjFaninC0(pObj), p->nWords );
             }
             continue;
         }
@@ -717,24 +663,7 @@ int Cec_ManSimSimulateRound( Cec_ManSim_t * p, Vec_Ptr_t * vInfoCis, Vec_Ptr_t *
 
 //        Abc_Print( 1, "%d,%d  ", Gia_ObjValue( Gia_ObjFanin0(pObj) ), Gia_ObjValue( Gia_ObjFanin1(pObj) ) );
 
-        if ( Gia_ObjFaninC0(pObj) )
-        {
-            if ( Gia_ObjFaninC1(pObj) )
-                for ( w = 1; w <= p->nWords; w++ )
-                    pRes[w] = ~(pRes0[w] | pRes1[w]);
-            else
-                for ( w = 1; w <= p->nWords; w++ )
-                    pRes[w] = ~pRes0[w] & pRes1[w];
-        }
-        else
-        {
-            if ( Gia_ObjFaninC1(pObj) )
-                for ( w = 1; w <= p->nWords; w++ )
-                    pRes[w] = pRes0[w] & ~pRes1[w];
-            else
-                for ( w = 1; w <= p->nWords; w++ )
-                    pRes[w] = pRes0[w] & pRes1[w];
-        }
+        Util_SimdAnd( Level, pRes + 1, pRes0 + 1, pRes1 + 1, Gia_ObjFaninC0(pObj), Gia_ObjFaninC1(pObj), p->nWords );
 
 references:
         // if this node is candidate constant, collect it
@@ -53,6 +53,9 @@ void Cec_ManSatSetDefaultParams( Cec_ParSat_t * p )
     p->fCheckMiter    =       0;  // the circuit is the miter
 //    p->fFirstStop     =       0;  // stop on the first sat output
     p->fLearnCls      =       0;  // perform clause learning
+    p->fLbdMode       =       0;  // use LBD-based clause management and restarts
+    p->fIncremental   =       0;  // collect garbage in one solver instead of recycling it
+    p->nProcs         =       1;  // the number of threads (for circuit SAT only)
     p->fVerbose       =       0;  // verbose stats
 }  
 
@@ -79,6 +82,7 @@ void Cec_ManSimSetDefaultParams( Cec_ParSim_t * p )
 //    p->fFirstStop     =       0;  // stop on the first sat output
     p->fDualOut       =       0;  // miter with separate outputs
     p->fConstCorr     =       0;  // consider only constants
+    p->fEventSim      =       0;  // resimulate counter-examples in the TFO of the changed CIs
     p->fSeqSimulate   =       0;  // performs sequential simulation
     p->fVeryVerbose   =       0;  // verbose stats
     p->fVerbose       =       0;  // verbose stats
@@ -138,6 +142,10 @@ void Cec_ManFraSetDefaultParams( Cec_ParFra_t * p )
     p->fDualOut       =       0;  // miter with separate outputs
     p->fColorDiff     =       0;  // miter with separate outputs
     p->fSatSweeping   =       0;  // enable SAT sweeping
+    p->nProcs         =       1;  // the number of threads of the circuit-based solver
+    p->fLearnCls      =       0;  // use clause learning in the circuit-based solver
+    p->fLbdMode       =       0;  // use LBD-based clause management and restarts
+    p->fIncremental   =       0;  // collect garbage in one solver instead of recycling it
     p->fVeryVerbose   =       0;  // verbose stats
     p->fVerbose       =       0;  // verbose stats
     p->iOutFail       =      -1;  // the failed output
@@ -162,6 +170,7 @@ void Cec_ManCecSetDefaultParams( Cec_ParCec_t * p )
 //    p->fFirstStop     =       0;  // stop on the first sat output
     p->fUseSmartCnf   =       0;  // use smart CNF computation
     p->fRewriting     =       0;  // enables AIG rewriting
+    p->fIncremental   =       0;  // collect garbage in one solver instead of recycling it
     p->fVeryVerbose   =       0;  // verbose stats
     p->fVerbose       =       0;  // verbose stats
     p->iOutFail       =      -1;  // the number of failed output
@@ -189,10 +198,12 @@ void Cec_ManCorSetDefaultParams( Cec_ParCor_t * p )
     p->nStepsMax      =      -1;  // (scorr only) the max number of induction steps
     p->fLatchCorr     =       0;  // consider only latch outputs
     p->fConstCorr     =       0;  // consider only constants
+    p->fEventSim      =       0;  // resimulate counter-examples in the TFO of the changed CIs
     p->fUseRings      =       1;  // combine classes into rings
     p->fUseCSat       =       1;  // use circuit-based solver
 //    p->fFirstStop     =       0;  // stop on the first sat output
     p->fUseSmartCnf   =       0;  // use smart CNF computation
+    p->fIncremental   =       0;  // collect garbage in one solver instead of recycling it
     p->fVeryVerbose   =       0;  // verbose stats
     p->fVerbose       =       0;  // verbose stats
 }  
@@ -368,6 +379,10 @@ Gia_Man_t * Cec_ManSatSweeping( Gia_Man_t * pAig, Cec_ParFra_t * pPars, int fSil
     // SAT solving
     Cec_ManSatSetDefaultParams( pParsSat );
     pParsSat->nBTLimit = pPars->nBTLimit;
+    pParsSat->fLbdMode = pPars->fLbdMode;
+    pParsSat->fIncremental = pPars->fIncremental;
+    pParsSat->nProcs = pPars->nProcs;
+    pParsSat->fLearnCls = pPars->fLearnCls;
     pParsSat->fVerbose = pPars->fVeryVerbose;
     // simulation patterns
     pPat = Cec_ManPatStart();
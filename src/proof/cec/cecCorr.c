@@ -552,6 +552,18 @@ int Cec_ManResimulateCounterExamples( Cec_ManSim_t * pSim, Vec_Int_t * vCexStore
 //    pSim->pPars->nWords  = 63;
     pSim->pPars->nFrames = nFrames;
     vSimInfo = Vec_PtrAllocSimInfo( Gia_ManRegNum(pSim->pAig) + Gia_ManPiNum(pSim->pAig) * nFrames, pSim->pPars->nWords );
+    if ( pSim->pPars->fEventSim && !pSim->pPars->fCheckMiter && !pSim->pBestState )
+    {
+        Cec_ManRes_t * pRes = Cec_ManResStart( pSim, nFrames );
+        while ( iStart < Vec_IntSize(vCexStore) )
+        {
+            Vec_PtrCleanSimInfo( vSimInfo, 0, pSim->pPars->nWords );
+            iStart = Cec_ManLoadCounterExamples( vSimInfo, vCexStore, iStart );
+            Gia_ManCorrPerformRemapping( vPairs, vSimInfo );
+            Cec_ManResSimulate( pRes, vSimInfo );
+        }
+        Cec_ManResStop( pRes );
+    }
     while ( iStart < Vec_IntSize(vCexStore) )
     {
         Cec_ManStartSimInfo( vSimInfo, Gia_ManRegNum(pSim->pAig) );
@@ -587,6 +599,17 @@ int Cec_ManResimulateCounterExamplesComb( Cec_ManSim_t * pSim, Vec_Int_t * vCexS
     Gia_ManCreateValueRefs( pSim->pAig );
     pSim->pPars->nFrames = 1;
     vSimInfo = Vec_PtrAllocSimInfo( Gia_ManCiNum(pSim->pAig), pSim->pPars->nWords );
+    if ( pSim->pPars->fEventSim && !pSim->pPars->fCheckMiter && !pSim->pBestState )
+    {
+        Cec_ManRes_t * pRes = Cec_ManResStart( pSim, 1 );
+        while ( iStart < Vec_IntSize(vCexStore) )
+        {
+            Vec_PtrCleanSimInfo( vSimInfo, 0, pSim->pPars->nWords );
+            iStart = Cec_ManLoadCounterExamples( vSimInfo, vCexStore, iStart );
+            Cec_ManResSimulate( pRes, vSimInfo );
+        }
+        Cec_ManResStop( pRes );
+    }
     while ( iStart < Vec_IntSize(vCexStore) )
     {
         Cec_ManStartSimInfo( vSimInfo, 0 );
@@ -784,11 +807,13 @@ void Cec_ManLSCorrespondenceBmc( Gia_Man_t * pAig, Cec_ParCor_t * pPars, int nPr
     pParsSim->nFrames    = pPars->nRounds;
     pParsSim->fVerbose   = pPars->fVerbose;
     pParsSim->fLatchCorr = pPars->fLatchCorr;
+    pParsSim->fEventSim  = pPars->fEventSim;
     pParsSim->fSeqSimulate = 1;
     pSim = Cec_ManSimStart( pAig, pParsSim );
     // prepare SAT solving
     Cec_ManSatSetDefaultParams( pParsSat );
     pParsSat->nBTLimit = pPars->nBTLimit;
+    pParsSat->fIncremental = pPars->fIncremental;
     pParsSat->fVerbose = pPars->fVerbose;
     fChanges = 1;
     while ( fChanges )
@@ -934,6 +959,7 @@ int Cec_ManLSCorrespondenceClasses( Gia_Man_t * pAig, Cec_ParCor_t * pPars )
     pParsSim->nFrames    = pPars->nFrames;
     pParsSim->fVerbose   = pPars->fVerbose;
     pParsSim->fLatchCorr = pPars->fLatchCorr;
+    pParsSim->fEventSim  = pPars->fEventSim;
     pParsSim->fConstCorr = pPars->fConstCorr;
     pParsSim->fSeqSimulate = 1;
     // create equivalence classes of registers
@@ -946,6 +972,7 @@ int Cec_ManLSCorrespondenceClasses( Gia_Man_t * pAig, Cec_ParCor_t * pPars )
     // prepare SAT solving
     Cec_ManSatSetDefaultParams( pParsSat );
     pParsSat->nBTLimit = pPars->nBTLimit;
+    pParsSat->fIncremental = pPars->fIncremental;
     pParsSat->fVerbose = pPars->fVerbose;
     // limit the number of conflicts in the circuit-based solver
     if ( pPars->fUseCSat )
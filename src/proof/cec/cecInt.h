@@ -86,6 +86,9 @@ struct Cec_ManSat_t_
     Vec_Ptr_t *      vUsedNodes;     // nodes whose SAT vars are assigned
     int              nRecycles;      // the number of times SAT solver was recycled
     int              nCallsSince;    // the number of calls since the last recycle
+    int              nCollects;      // the number of garbage collections (incremental mode)
+    int              nSatVarsLive;   // the number of SAT variables after the last collection
+    int              nLearntsKept;   // the number of learned clauses kept by collections
     Vec_Ptr_t *      vFanins;        // fanins of the CNF node
     // counter-examples
     Vec_Int_t *      vCex;           // the latest counter-example
@@ -141,6 +144,35 @@ struct Cec_ManSim_t_
     Vec_Int_t *      vRefinedC;      // refined const reprs
 };
 
+// event-driven resimulation manager
+typedef struct Cec_ManRes_t_ Cec_ManRes_t;
+struct Cec_ManRes_t_
+{
+    Cec_ManSim_t *   pSim;           // the simulation manager with the classes
+    int              nWords;         // the number of simulation words
+    int              nFrames;        // the number of time frames
+    int              nObjWords;      // the number of words in the node bitmaps
+    // background values
+    unsigned *       pPhase;         // the value of each node under the all-0 pattern
+    unsigned *       pRefs;          // the value of each node in each frame of the background sequence
+    unsigned *       pConsts;        // simulation info of the nodes not in the TFO
+    // simulation info of the changed nodes
+    int *            pSlots;         // the slot of each node or -1 if the node is not changed
+    unsigned *       pData;          // simulation info of the slots
+    int              nSlotsAlloc;    // the number of allocated slots
+    unsigned *       pRis;           // flop inputs from the previous frame
+    unsigned *       pRisNext;       // flop inputs of the current frame
+    Vec_Int_t *      vRis;           // the changed flops in the previous frame
+    Vec_Int_t *      vRisNext;       // the changed flops in the current frame
+    // temporaries
+    Vec_Int_t *      vChanged;       // the nodes in the TFO of the changed CIs
+    Vec_Int_t *      vHeads;         // the heads of the touched classes
+    Vec_Int_t *      vRefinedC;      // refined const reprs
+    // statistics
+    word             nNodesSim;      // the number of simulated nodes
+    word             nNodesAll;      // the number of nodes simulated by full resimulation
+};
+
 // combinational simulation manager
 typedef struct Cec_ManFra_t_ Cec_ManFra_t;
 struct Cec_ManFra_t_
@@ -171,6 +203,10 @@ struct Cec_ManFra_t_
 /*=== cecCorr.c ============================================================*/
 extern void                 Cec_ManRefinedClassPrintStats( Gia_Man_t * p, Vec_Str_t * vStatus, int iIter, abctime Time );
 /*=== cecClass.c ============================================================*/
+extern int                  Cec_ManSimCompareConst( unsigned * p, int nWords );
+extern int                  Cec_ManSimCompareEqual( unsigned * p0, unsigned * p1, int nWords );
+extern void                 Cec_ManSimClassCreate( Gia_Man_t * p, Vec_Int_t * vClass );
+extern int                  Cec_ManSimHashKey( unsigned * pSim, int nWords, int nTableSize );
 extern int                  Cec_ManSimClassRemoveOne( Cec_ManSim_t * p, int i );
 extern int                  Cec_ManSimClassesPrepare( Cec_ManSim_t * p, int LevelMax );
 extern int                  Cec_ManSimClassesRefine( Cec_ManSim_t * p );
@@ -193,6 +229,10 @@ extern void                 Cec_ManPatSavePattern( Cec_ManPat_t *  pPat, Cec_Man
 extern void                 Cec_ManPatSavePatternCSat( Cec_ManPat_t * pMan, Vec_Int_t * vPat );
 extern Vec_Ptr_t *          Cec_ManPatCollectPatterns( Cec_ManPat_t *  pMan, int nInputs, int nWords );
 extern Vec_Ptr_t *          Cec_ManPatPackPatterns( Vec_Int_t * vCexStore, int nInputs, int nRegs, int nWordsInit );
+/*=== cecResim.c ============================================================*/
+extern Cec_ManRes_t *       Cec_ManResStart( Cec_ManSim_t * pSim, int nFrames );
+extern void                 Cec_ManResStop( Cec_ManRes_t * p );
+extern void                 Cec_ManResSimulate( Cec_ManRes_t * p, Vec_Ptr_t * vInfo );
 /*=== cecSeq.c ============================================================*/
 extern int                  Cec_ManSeqResimulate( Cec_ManSim_t * p, Vec_Ptr_t * vInfo );
 extern int                  Cec_ManSeqResimulateInfo( Gia_Man_t * pAig, Vec_Ptr_t * vSimInfo, Abc_Cex_t * pBestState, int fCheckMiter );
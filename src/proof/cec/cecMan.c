@@ -78,6 +78,8 @@ void Cec_ManSatPrintStats( Cec_ManSat_t * p )
     Abc_Print( 1, "Conf = %5d  ", p->pPars->nBTLimit );
     Abc_Print( 1, "MinVar = %5d  ", p->pPars->nSatVarMax );
     Abc_Print( 1, "MinCalls = %5d\n", p->pPars->nCallsRecycle );
+    if ( p->pPars->fIncremental )
+        Abc_Print( 1, "Garbage collections = %d.  Learned clauses kept = %d.\n", p->nCollects, p->nLearntsKept );
     Abc_Print( 1, "Unsat calls %6d  (%6.2f %%)   Ave conf = %8.1f   ", 
         p->nSatUnsat, p->nSatTotal? 100.0*p->nSatUnsat/p->nSatTotal : 0.0, p->nSatUnsat? 1.0*p->nConfUnsat/p->nSatUnsat :0.0 );
     Abc_PrintTimeP( 1, "Time", p->timeSatUnsat, p->timeTotal );
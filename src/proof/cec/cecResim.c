@@ -0,0 +1,478 @@
+/**CFile****************************************************************
+
+  FileName    [cecResim.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Combinational equivalence checking.]
+
+  Synopsis    [Event-driven resimulation of counter-examples.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: cecResim.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "cecInt.h"
+#include "misc/util/utilSimd.h"
+
+ABC_NAMESPACE_IMPL_START
+
+// The counter-examples are packed into bits 1..32*nWords-1 of the simulation
+// info on top of the background sequence, in which all PIs are 0 in every
+// frame and the flops start in the all-0 state. Bit 0 is the all-0 pattern
+// of every frame, as in Cec_ManSimSimulateRound(), so it is equal to the
+// phase of each node and normalizes the comparison of the nodes.
+// A node outside of the transitive fanout of the CIs that differ from the
+// background has a constant simulation word (the background value of the
+// node in this frame) with bit 0 equal to its phase. Such nodes are never
+// evaluated, and the classes that have only such nodes are never compared,
+// because they were already refined using the background sequence.
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+static inline int        Cec_ResPhase( Cec_ManRes_t * p, int iObj )         { return Abc_InfoHasBit( p->pPhase, iObj );                              }
+static inline int        Cec_ResRef( Cec_ManRes_t * p, int iObj, int f )    { return Abc_InfoHasBit( p->pRefs + f * p->nObjWords, iObj );            }
+static inline unsigned * Cec_ResConst( Cec_ManRes_t * p, int iObj, int f )  { return p->pConsts + p->nWords * (2 * Cec_ResRef(p, iObj, f) + Cec_ResPhase(p, iObj)); }
+static inline unsigned * Cec_ResSim( Cec_ManRes_t * p, int iObj, int f )    { return p->pSlots[iObj] >= 0 ? p->pData + p->nWords * p->pSlots[iObj] : Cec_ResConst(p, iObj, f); }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the values of the nodes under the background.]
+
+  Description [The phase is the value under the all-0 pattern of one frame.
+  The reference values are derived by simulating the background sequence.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cec_ManResComputeRefs( Cec_ManRes_t * p )
+{
+    Gia_Man_t * pAig = p->pSim->pAig;
+    Gia_Obj_t * pObj;
+    unsigned * pRef, * pRefPrev = NULL;
+    int i, f, Value;
+    Gia_ManForEachObj1( pAig, pObj, i )
+    {
+        if ( Gia_ObjIsCi(pObj) )
+            continue;
+        if ( Gia_ObjIsCo(pObj) )
+            Value = Cec_ResPhase(p, Gia_ObjFaninId0(pObj, i)) ^ Gia_ObjFaninC0(pObj);
+        else
+            Value = (Cec_ResPhase(p, Gia_ObjFaninId0(pObj, i)) ^ Gia_ObjFaninC0(pObj)) &
+                    (Cec_ResPhase(p, Gia_ObjFaninId1(pObj, i)) ^ Gia_ObjFaninC1(pObj));
+        if ( Value )
+            Abc_InfoSetBit( p->pPhase, i );
+    }
+    for ( f = 0; f < p->nFrames; f++, pRefPrev = pRef )
+    {
+        pRef = p->pRefs + f * p->nObjWords;
+        Gia_ManForEachObj1( pAig, pObj, i )
+        {
+            if ( Gia_ObjIsPi(pAig, pObj) )
+                continue;
+            if ( Gia_ObjIsCi(pObj) )
+                Value = f ? Abc_InfoHasBit( pRefPrev, Gia_ObjId(pAig, Gia_ObjRoToRi(pAig, pObj)) ) : 0;
+            else if ( Gia_ObjIsCo(pObj) )
+                Value = Abc_InfoHasBit(pRef, Gia_ObjFaninId0(pObj, i)) ^ Gia_ObjFaninC0(pObj);
+            else
+                Value = (Abc_InfoHasBit(pRef, Gia_ObjFaninId0(pObj, i)) ^ Gia_ObjFaninC0(pObj)) &
+                        (Abc_InfoHasBit(pRef, Gia_ObjFaninId1(pObj, i)) ^ Gia_ObjFaninC1(pObj));
+            if ( Value )
+                Abc_InfoSetBit( pRef, i );
+        }
+    }
+    // constant simulation words for each combination of the reference value and the phase
+    for ( i = 0; i < 4; i++ )
+    {
+        Util_SimdFill( Util_SimdLevel(), p->pConsts + i * p->nWords, (i >> 1) ? ~0 : 0, p->nWords );
+        p->pConsts[i * p->nWords] = (p->pConsts[i * p->nWords] & ~1) | (i & 1);
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Refines one equivalence class.]
+
+  Description [Same as Cec_ManSimClassRefineOne() but takes the simulation
+  info of the nodes from the event-driven simulator.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cec_ManResClassRefineOne( Cec_ManRes_t * p, int i, int f, int nWords )
+{
+    Cec_ManSim_t * pSim = p->pSim;
+    unsigned * pSim0, * pSim1;
+    int Ent;
+    Vec_IntClear( pSim->vClassOld );
+    Vec_IntClear( pSim->vClassNew );
+    Vec_IntPush( pSim->vClassOld, i );
+    pSim0 = Cec_ResSim( p, i, f );
+    Gia_ClassForEachObj1( pSim->pAig, i, Ent )
+    {
+        pSim1 = Cec_ResSim( p, Ent, f );
+        if ( Cec_ManSimCompareEqual( pSim0, pSim1, nWords ) )
+            Vec_IntPush( pSim->vClassOld, Ent );
+        else
+            Vec_IntPush( pSim->vClassNew, Ent );
+    }
+    if ( Vec_IntSize( pSim->vClassNew ) == 0 )
+        return 0;
+    Cec_ManSimClassCreate( pSim->pAig, pSim->vClassOld );
+    Cec_ManSimClassCreate( pSim->pAig, pSim->vClassNew );
+    if ( Vec_IntSize(pSim->vClassNew) > 1 )
+        return 1 + Cec_ManResClassRefineOne( p, Vec_IntEntry(pSim->vClassNew,0), f, nWords );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Refines nodes belonging to candidate constant class.]
+
+  Description [Same as Cec_ManSimProcessRefined().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cec_ManResProcessRefined( Cec_ManRes_t * p, Vec_Int_t * vRefined, int f, int nWords )
+{
+    Gia_Man_t * pAig = p->pSim->pAig;
+    unsigned * pSim;
+    int * pTable, nTableSize, i, k, Key;
+    if ( Vec_IntSize(vRefined) == 0 )
+        return;
+    if ( p->pSim->pPars->fConstCorr )
+    {
+        Vec_IntForEachEntry( vRefined, i, k )
+            Gia_ObjSetRepr( pAig, i, GIA_VOID );
+        return;
+    }
+    nTableSize = Abc_PrimeCudd( 100 + Vec_IntSize(vRefined) / 3 );
+    pTable = ABC_CALLOC( int, nTableSize );
+    Vec_IntForEachEntry( vRefined, i, k )
+    {
+        pSim = Cec_ResSim( p, i, f );
+        assert( !Cec_ManSimCompareConst( pSim, nWords ) );
+        Key = Cec_ManSimHashKey( pSim, nWords, nTableSize );
+        if ( pTable[Key] == 0 )
+        {
+            assert( Gia_ObjRepr(pAig, i) == 0 );
+            assert( Gia_ObjNext(pAig, i) == 0 );
+            Gia_ObjSetRepr( pAig, i, GIA_VOID );
+        }
+        else
+        {
+            Gia_ObjSetNext( pAig, pTable[Key], i );
+            Gia_ObjSetRepr( pAig, i, Gia_ObjRepr(pAig, pTable[Key]) );
+            if ( Gia_ObjRepr(pAig, i) == GIA_VOID )
+                Gia_ObjSetRepr( pAig, i, pTable[Key] );
+            assert( Gia_ObjRepr(pAig, i) > 0 );
+        }
+        pTable[Key] = i;
+    }
+    Vec_IntForEachEntry( vRefined, i, k )
+        if ( Gia_ObjIsHead( pAig, i ) )
+            Cec_ManResClassRefineOne( p, i, f, nWords );
+    ABC_FREE( pTable );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Refines the classes containing the given nodes.]
+
+  Description [If the array is NULL, refines all classes. The classes
+  are collected before refinement because refining one class may create
+  new classes that are refined recursively.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cec_ManResRefine( Cec_ManRes_t * p, Vec_Int_t * vNodes, int f, int nWords )
+{
+    Gia_Man_t * pAig = p->pSim->pAig;
+    int i, k, iHead, nNodes;
+    Vec_IntClear( p->vHeads );
+    Vec_IntClear( p->vRefinedC );
+    nNodes = vNodes ? Vec_IntSize(vNodes) : Gia_ManObjNum(pAig);
+    for ( k = vNodes ? 0 : 1; k < nNodes; k++ )
+    {
+        i = vNodes ? Vec_IntEntry(vNodes, k) : k;
+        if ( Gia_ObjIsCo(Gia_ManObj(pAig, i)) )
+            continue;
+        if ( Gia_ObjIsConst(pAig, i) )
+        {
+            if ( !Cec_ManSimCompareConst( Cec_ResSim(p, i, f), nWords ) )
+                Vec_IntPush( p->vRefinedC, i );
+            continue;
+        }
+        if ( !Gia_ObjIsClass(pAig, i) )
+            continue;
+        iHead = Gia_ObjIsHead(pAig, i) ? i : Gia_ObjRepr(pAig, i);
+        if ( Gia_ManObj(pAig, iHead)->fMark1 )
+            continue;
+        Gia_ManObj(pAig, iHead)->fMark1 = 1;
+        Vec_IntPush( p->vHeads, iHead );
+    }
+    Vec_IntForEachEntry( p->vHeads, iHead, k )
+    {
+        Gia_ManObj(pAig, iHead)->fMark1 = 0;
+        Cec_ManResClassRefineOne( p, iHead, f, nWords );
+    }
+    Cec_ManResProcessRefined( p, p->vRefinedC, f, nWords );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the event-driven simulator.]
+
+  Description [Refines the classes of the simulation manager using
+  the background sequence of the given length.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Cec_ManRes_t * Cec_ManResStart( Cec_ManSim_t * pSim, int nFrames )
+{
+    Cec_ManRes_t * p;
+    Gia_Man_t * pAig = pSim->pAig;
+    int f;
+    assert( pAig->pReprs && pAig->pNexts );
+    p = ABC_CALLOC( Cec_ManRes_t, 1 );
+    p->pSim      = pSim;
+    p->nWords    = pSim->nWords;
+    p->nFrames   = nFrames;
+    p->nObjWords = Abc_BitWordNum( Gia_ManObjNum(pAig) );
+    p->pPhase    = ABC_CALLOC( unsigned, p->nObjWords );
+    p->pRefs     = ABC_CALLOC( unsigned, p->nObjWords * nFrames );
+    p->pConsts   = ABC_ALLOC( unsigned, 4 * p->nWords );
+    p->pSlots    = ABC_FALLOC( int, Gia_ManObjNum(pAig) );
+    p->nSlotsAlloc = 1000;
+    p->pData     = ABC_ALLOC( unsigned, p->nWords * p->nSlotsAlloc );
+    p->pRis      = ABC_ALLOC( unsigned, p->nWords * Abc_MaxInt(1, Gia_ManRegNum(pAig)) );
+    p->pRisNext  = ABC_ALLOC( unsigned, p->nWords * Abc_MaxInt(1, Gia_ManRegNum(pAig)) );
+    p->vRis      = Vec_IntAlloc( 100 );
+    p->vRisNext  = Vec_IntAlloc( 100 );
+    p->vChanged  = Vec_IntAlloc( 1000 );
+    p->vHeads    = Vec_IntAlloc( 1000 );
+    p->vRefinedC = Vec_IntAlloc( 1000 );
+    Cec_ManResComputeRefs( p );
+    // the nodes are constant in every frame, so one word is enough
+    for ( f = 0; f < nFrames; f++ )
+        Cec_ManResRefine( p, NULL, f, 1 );
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the event-driven simulator.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cec_ManResStop( Cec_ManRes_t * p )
+{
+    if ( p->pSim->pPars->fVeryVerbose )
+        Abc_Print( 1, "Event-driven resimulation: Simulated %.0f nodes out of %.0f (%.2f %%).\n", 
+            (double)p->nNodesSim, (double)p->nNodesAll, 100.0 * p->nNodesSim / Abc_MaxWord(p->nNodesAll, 1) );
+    Vec_IntFree( p->vRis );
+    Vec_IntFree( p->vRisNext );
+    Vec_IntFree( p->vChanged );
+    Vec_IntFree( p->vHeads );
+    Vec_IntFree( p->vRefinedC );
+    ABC_FREE( p->pPhase );
+    ABC_FREE( p->pRefs );
+    ABC_FREE( p->pConsts );
+    ABC_FREE( p->pSlots );
+    ABC_FREE( p->pData );
+    ABC_FREE( p->pRis );
+    ABC_FREE( p->pRisNext );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the transitive fanout of the changed CIs.]
+
+  Description [Returns the nodes in the topological order. The nodes are
+  marked in one pass over the AIG, which is cheaper than sorting the nodes
+  reached through the fanouts when the TFO covers most of the AIG.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cec_ManResCollectTfo( Cec_ManRes_t * p, Vec_Ptr_t * vInfo, int f )
+{
+    Gia_Man_t * pAig = p->pSim->pAig;
+    Gia_Obj_t * pObj;
+    unsigned * pInfo;
+    int i, k, nRegs = Gia_ManRegNum(pAig), nPis = Gia_ManPiNum(pAig), Level = Util_SimdLevel();
+    Gia_ManIncrementTravId( pAig );
+    if ( f == 0 )
+    {
+        for ( k = 0; k < nRegs; k++ )
+        {
+            pInfo = (unsigned *)Vec_PtrEntry( vInfo, k );
+            if ( Util_SimdFindNeq( Level, pInfo, 0, p->nWords ) >= 0 )
+                Gia_ObjSetTravIdCurrent( pAig, Gia_ManCi(pAig, nPis + k) );
+        }
+    }
+    else
+    {
+        Vec_IntForEachEntry( p->vRis, k, i )
+            Gia_ObjSetTravIdCurrent( pAig, Gia_ManCi(pAig, nPis + k) );
+    }
+    for ( k = 0; k < nPis; k++ )
+    {
+        pInfo = (unsigned *)Vec_PtrEntry( vInfo, nRegs + f * nPis + k );
+        if ( Util_SimdFindNeq( Level, pInfo, 0, p->nWords ) >= 0 )
+            Gia_ObjSetTravIdCurrent( pAig, Gia_ManCi(pAig, k) );
+    }
+    Vec_IntClear( p->vChanged );
+    Gia_ManForEachObj1( pAig, pObj, i )
+    {
+        if ( Gia_ObjIsCi(pObj) )
+        {
+            if ( !Gia_ObjIsTravIdCurrent(pAig, pObj) )
+                continue;
+        }
+        else if ( !Gia_ObjIsTravIdCurrentId(pAig, Gia_ObjFaninId0(pObj, i)) && 
+                  (Gia_ObjIsCo(pObj) || !Gia_ObjIsTravIdCurrentId(pAig, Gia_ObjFaninId1(pObj, i))) )
+            continue;
+        Gia_ObjSetTravIdCurrent( pAig, pObj );
+        Vec_IntPush( p->vChanged, i );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Resimulates the changed nodes in one frame.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cec_ManResSimulateFrame( Cec_ManRes_t * p, Vec_Ptr_t * vInfo, int f )
+{
+    Gia_Man_t * pAig = p->pSim->pAig;
+    Gia_Obj_t * pObj;
+    unsigned * pRes, * pRes0, * pRes1;
+    int i, iObj, iCi, nRegs = Gia_ManRegNum(pAig), nPis = Gia_ManPiNum(pAig), Level = Util_SimdLevel();
+    // assign the slots
+    if ( p->nSlotsAlloc < Vec_IntSize(p->vChanged) )
+    {
+        p->nSlotsAlloc = 2 * Vec_IntSize(p->vChanged);
+        ABC_FREE( p->pData );
+        p->pData = ABC_ALLOC( unsigned, p->nWords * p->nSlotsAlloc );
+    }
+    Vec_IntForEachEntry( p->vChanged, iObj, i )
+        p->pSlots[iObj] = i;
+    // simulate the nodes
+    Vec_IntClear( p->vRisNext );
+    Vec_IntForEachEntry( p->vChanged, iObj, i )
+    {
+        pObj = Gia_ManObj( pAig, iObj );
+        pRes = p->pData + p->nWords * i;
+        if ( Gia_ObjIsCi(pObj) )
+        {
+            iCi = Gia_ObjCioId(pObj);
+            if ( iCi < nPis )
+                pRes0 = (unsigned *)Vec_PtrEntry( vInfo, nRegs + f * nPis + iCi );
+            else if ( f == 0 )
+                pRes0 = (unsigned *)Vec_PtrEntry( vInfo, iCi - nPis );
+            else
+                pRes0 = p->pRis + p->nWords * (iCi - nPis);
+            Util_SimdCopy( Level, pRes, pRes0, 0, p->nWords );
+            // make sure the first pattern is always zero
+            pRes[0] &= ~1;
+        }
+        else if ( Gia_ObjIsCo(pObj) )
+        {
+            if ( !Gia_ObjIsRi(pAig, pObj) )
+                continue;
+            pRes  = p->pRisNext + p->nWords * Vec_IntSize(p->vRisNext);
+            pRes0 = Cec_ResSim( p, Gia_ObjFaninId0(pObj, iObj), f );
+            Util_SimdCopy( Level, pRes, pRes0, Gia_ObjFaninC0(pObj), p->nWords );
+            Vec_IntPush( p->vRisNext, Gia_ObjCioId(pObj) - Gia_ManPoNum(pAig) );
+        }
+        else
+        {
+            pRes0 = Cec_ResSim( p, Gia_ObjFaninId0(pObj, iObj), f );
+            pRes1 = Cec_ResSim( p, Gia_ObjFaninId1(pObj, iObj), f );
+            Util_SimdAnd( Level, pRes, pRes0, pRes1, Gia_ObjFaninC0(pObj), Gia_ObjFaninC1(pObj), p->nWords );
+        }
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Resimulates the counter-examples and refines the classes.]
+
+  Description [The simulation info is organized as in Cec_ManSeqResimulate():
+  flop values followed by PI values for each frame. The info should be 0
+  everywhere except for the bits set by the counter-examples.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cec_ManResSimulate( Cec_ManRes_t * p, Vec_Ptr_t * vInfo )
+{
+    Gia_Man_t * pAig = p->pSim->pAig;
+    int f, i, k, iObj;
+    assert( Vec_PtrSize(vInfo) == Gia_ManRegNum(pAig) + Gia_ManPiNum(pAig) * p->nFrames );
+    assert( Vec_PtrReadWordsSimInfo(vInfo) == p->nWords );
+    Vec_IntClear( p->vRis );
+    for ( f = 0; f < p->nFrames; f++ )
+    {
+        Cec_ManResCollectTfo( p, vInfo, f );
+        Cec_ManResSimulateFrame( p, vInfo, f );
+        Cec_ManResRefine( p, p->vChanged, f, p->nWords );
+        Vec_IntForEachEntry( p->vChanged, iObj, i )
+            p->pSlots[iObj] = -1;
+        p->nNodesSim += Vec_IntSize(p->vChanged);
+        // the flop inputs become the flop outputs in the next frame
+        Vec_IntForEachEntry( p->vRisNext, k, i )
+            Util_SimdCopy( Util_SimdLevel(), p->pRis + p->nWords * k, p->pRisNext + p->nWords * i, 0, p->nWords );
+        ABC_SWAP( Vec_Int_t *, p->vRis, p->vRisNext );
+    }
+    p->nNodesAll += p->nFrames * Gia_ManObjNum(pAig);
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -353,7 +353,7 @@ void Cec_CnfNodeAddToSolver( Cec_ManSat_t * p, Gia_Obj_t * pObj )
 
 /**Function*************************************************************
 
-  Synopsis    [Recycles the SAT solver.]
+  Synopsis    [Starts a new SAT solver with the constant node.]
 
   Description []
                
@@ -362,21 +362,12 @@ void Cec_CnfNodeAddToSolver( Cec_ManSat_t * p, Gia_Obj_t * pObj )
   SeeAlso     []
 
 ***********************************************************************/
-void Cec_ManSatSolverRecycle( Cec_ManSat_t * p )
+void Cec_ManSatSolverStart( Cec_ManSat_t * p )
 {
     int Lit;
-    if ( p->pSat )
-    {
-        Gia_Obj_t * pObj;
-        int i;
-        Vec_PtrForEachEntry( Gia_Obj_t *, p->vUsedNodes, pObj, i )
-            Cec_ObjSetSatNum( p, pObj, 0 );
-        Vec_PtrClear( p->vUsedNodes );
-//        memset( p->pSatVars, 0, sizeof(int) * Gia_ManObjNumMax(p->pAigTotal) );
-        sat_solver_delete( p->pSat );
-    }
     p->pSat = sat_solver_new();
     sat_solver_setnvars( p->pSat, 1000 );
+    sat_solver_set_lbd_mode( p->pSat, p->pPars->fLbdMode );
     p->pSat->factors = ABC_CALLOC( double, p->pSat->cap );
     // var 0 is not used
     // var 1 is reserved for const0 node - add the clause
@@ -387,11 +378,170 @@ void Cec_ManSatSolverRecycle( Cec_ManSat_t * p )
 //        Lit = lit_neg( Lit );
     sat_solver_addclause( p->pSat, &Lit, &Lit + 1 );
     Cec_ObjSetSatNum( p, Gia_ManConst0(p->pAig), p->nSatVars++ );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Recycles the SAT solver.]
+
+  Description []
+               
+  SideEffects []
 
+  SeeAlso     []
+
+***********************************************************************/
+void Cec_ManSatSolverRecycle( Cec_ManSat_t * p )
+{
+    if ( p->pSat )
+    {
+        Gia_Obj_t * pObj;
+        int i;
+        Vec_PtrForEachEntry( Gia_Obj_t *, p->vUsedNodes, pObj, i )
+            Cec_ObjSetSatNum( p, pObj, 0 );
+        Vec_PtrClear( p->vUsedNodes );
+//        memset( p->pSatVars, 0, sizeof(int) * Gia_ManObjNumMax(p->pAigTotal) );
+        sat_solver_delete( p->pSat );
+    }
+    Cec_ManSatSolverStart( p );
     p->nRecycles++;
     p->nCallsSince = 0;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Marks the transitive fanin cone of the node.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cec_ManSatMarkCone_rec( Cec_ManSat_t * p, Gia_Obj_t * pObj )
+{
+    if ( Gia_ObjIsTravIdCurrent(p->pAig, pObj) )
+        return;
+    Gia_ObjSetTravIdCurrent(p->pAig, pObj);
+    if ( !Gia_ObjIsAnd(pObj) )
+        return;
+    Cec_ManSatMarkCone_rec( p, Gia_ObjFanin0(pObj) );
+    Cec_ManSatMarkCone_rec( p, Gia_ObjFanin1(pObj) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Maps the clause into the variables of the new solver.]
+
+  Description [Returns 0 if the clause has a variable that is not mapped.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_ManSatRemapClause( int * pMap, lit * pBeg, lit * pEnd, Vec_Int_t * vLits )
+{
+    lit * pLit;
+    Vec_IntClear( vLits );
+    for ( pLit = pBeg; pLit < pEnd; pLit++ )
+    {
+        if ( pMap[lit_var(*pLit)] == -1 )
+            return 0;
+        Vec_IntPush( vLits, toLitCond(pMap[lit_var(*pLit)], lit_sign(*pLit)) );
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects garbage in the SAT solver.]
+
+  Description [Used instead of recycling in the incremental mode. 
+  Keeps the CNF of the nodes in the cones of the current query and 
+  drops the rest. The top-level assignments and the learned clauses 
+  that only depend on the remaining variables are transferred into 
+  the compacted solver. This is sound because the dropped clauses 
+  define the dropped variables as functions of the remaining ones.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cec_ManSatSolverCollect( Cec_ManSat_t * p, Gia_Obj_t * pObj1, Gia_Obj_t * pObj2 )
+{
+    sat_solver * pSatOld = p->pSat;
+    Sat_Mem_t * pMem = &pSatOld->Mem;
+    Vec_Int_t * vLits;
+    Gia_Obj_t * pObj;
+    clause * pClause;
+    int * pMap, i, k, iVar, Lit, RetValue;
+    assert( pSatOld != NULL );
+    // mark the cones of the current query
+    Gia_ManIncrementTravId( p->pAig );
+    Cec_ManSatMarkCone_rec( p, pObj1 );
+    if ( pObj2 )
+        Cec_ManSatMarkCone_rec( p, pObj2 );
+    // renumber the variables of the nodes in the cones
+    pMap = ABC_FALLOC( int, p->nSatVars );
+    Cec_ManSatSolverStart( p );
+    pMap[1] = 1;
+    k = 0;
+    Vec_PtrForEachEntry( Gia_Obj_t *, p->vUsedNodes, pObj, i )
+    {
+        iVar = Cec_ObjSatNum( p, pObj );
+        if ( !Gia_ObjIsTravIdCurrent(p->pAig, pObj) )
+        {
+            Cec_ObjSetSatNum( p, pObj, 0 );
+            continue;
+        }
+        pMap[iVar] = p->nSatVars;
+        Cec_ObjSetSatNum( p, pObj, p->nSatVars++ );
+        Vec_PtrWriteEntry( p->vUsedNodes, k++, pObj );
+    }
+    Vec_PtrShrink( p->vUsedNodes, k );
+    sat_solver_setnvars( p->pSat, p->nSatVars );
+    // add the CNF of the remaining nodes (their fanins are in the cones too)
+    Vec_PtrForEachEntry( Gia_Obj_t *, p->vUsedNodes, pObj, i )
+    {
+        if ( !Gia_ObjIsAnd(pObj) )
+            continue;
+        if ( Gia_ObjIsMuxType(pObj) )
+            Cec_AddClausesMux( p, pObj );
+        else
+        {
+            Cec_CollectSuper( pObj, 1, p->vFanins );
+            Cec_AddClausesSuper( p, pObj, p->vFanins );
+        }
+    }
+    // transfer the top-level assignments and the learned clauses
+    vLits = Vec_IntAlloc( 100 );
+    for ( i = 0; i < pSatOld->qtail; i++ )
+    {
+        Lit = pSatOld->trail[i];
+        if ( !Cec_ManSatRemapClause( pMap, &Lit, &Lit + 1, vLits ) )
+            continue;
+        RetValue = sat_solver_addclause( p->pSat, Vec_IntArray(vLits), Vec_IntLimit(vLits) );
+        assert( RetValue );
+    }
+    Sat_MemForEachLearned( pMem, pClause, i, k )
+    {
+        if ( !Cec_ManSatRemapClause( pMap, clause_begin(pClause), clause_end(pClause), vLits ) )
+            continue;
+        RetValue = sat_solver_addlearnt( p->pSat, Vec_IntArray(vLits), Vec_IntLimit(vLits), pClause->lbd );
+        assert( RetValue );
+        p->nLearntsKept++;
+    }
+    Vec_IntFree( vLits );
+    ABC_FREE( pMap );
+    sat_solver_delete( pSatOld );
+    p->nSatVarsLive = p->nSatVars;
+    p->nCollects++;
+    p->nCallsSince = 0;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Sets variable activities in the cone.]
@@ -488,9 +638,14 @@ int Cec_ManSatCheckNode( Cec_ManSat_t * p, Gia_Obj_t * pObj )
     // check if SAT solver needs recycling
     if ( p->pSat == NULL || 
         (p->pPars->nSatVarMax && 
-         p->nSatVars > p->pPars->nSatVarMax && 
+         p->nSatVars > Abc_MaxInt(p->pPars->nSatVarMax, 2 * p->nSatVarsLive) && 
          p->nCallsSince > p->pPars->nCallsRecycle) )
-        Cec_ManSatSolverRecycle( p );
+    {
+        if ( p->pSat && p->pPars->fIncremental )
+            Cec_ManSatSolverCollect( p, pObjR, NULL );
+        else
+            Cec_ManSatSolverRecycle( p );
+    }
 
     // if the nodes do not have SAT variables, allocate them
 clk2 = Abc_Clock();
@@ -588,9 +743,14 @@ int Cec_ManSatCheckNodeTwo( Cec_ManSat_t * p, Gia_Obj_t * pObj1, Gia_Obj_t * pOb
     // check if SAT solver needs recycling
     if ( p->pSat == NULL || 
         (p->pPars->nSatVarMax && 
-         p->nSatVars > p->pPars->nSatVarMax && 
+         p->nSatVars > Abc_MaxInt(p->pPars->nSatVarMax, 2 * p->nSatVarsLive) && 
          p->nCallsSince > p->pPars->nCallsRecycle) )
-        Cec_ManSatSolverRecycle( p );
+    {
+        if ( p->pSat && p->pPars->fIncremental )
+            Cec_ManSatSolverCollect( p, pObjR1, pObjR2 );
+        else
+            Cec_ManSatSolverRecycle( p );
+    }
 
     // if the nodes do not have SAT variables, allocate them
 clk2 = Abc_Clock();
@@ -766,7 +926,7 @@ void Cec_ManSatSolveCSat( Cec_ManPat_t * pPat, Gia_Man_t * pAig, Cec_ParSat_t *
 {
     Vec_Str_t * vStatus;
     Vec_Int_t * vPat = Vec_IntAlloc( 1000 );
-    Vec_Int_t * vCexStore = Cbs_ManSolveMiterNc( pAig, pPars->nBTLimit, &vStatus, 0 );
+    Vec_Int_t * vCexStore = Cbs_ManSolveMiterPar( pAig, pPars->nBTLimit, pPars->nProcs, pPars->fLearnCls, &vStatus, 0 );
     Gia_Obj_t * pObj;
     int i, status, iStart = 0;
     assert( Vec_StrSize(vStatus) == Gia_ManCoNum(pAig) );
@@ -0,0 +1,508 @@
+/**CFile****************************************************************
+
+  FileName    [fraPort.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [New FRAIG package.]
+
+  Synopsis    [Portfolio of SAT solvers for combinational miters.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 30, 2007.]
+
+  Revision    [$Id: fraPort.c,v 1.00 2007/06/30 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "fra.h"
+#include "sat/cnf/cnf.h"
+#include "sat/bsat/satSolver2.h"
+#include "aig/gia/giaAig.h"
+#include "misc/util/utilPth.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The miter is solved by several solvers running concurrently on the
+// same CNF (or, for the circuit solver, on the same AIG). The first
+// solver that gets an answer raises the stop flag, which the others
+// check at their restarts. The CNF-based instances of sat_solver may
+// exchange short learned clauses through a ring buffer of slots, which
+// is written and read without locks: a writer claims a slot by changing
+// its stamp to -1 and releases it by writing the position of the clause
+// in the stream; a reader accepts a clause only if it sees the expected
+// stamp before and after copying the literals.
+
+#define FRA_PORT_SHARE_SIZE     8   // the max size of exchanged learned clauses
+#define FRA_PORT_SLOT_NUM    4096   // the number of slots in the exchange buffer
+
+enum { FRA_PORT_SAT, FRA_PORT_SAT2, FRA_PORT_CBS };
+
+typedef struct Fra_PortSlot_t_ Fra_PortSlot_t;
+struct Fra_PortSlot_t_
+{
+    volatile int     Stamp;         // the position of the clause in the stream (-1 while written)
+    int              iThread;       // the thread that learned the clause
+    int              nLits;         // the number of literals
+    int              Lbd;           // the LBD in the solver that learned the clause
+    int              pLits[FRA_PORT_SHARE_SIZE]; // the literals
+};
+
+typedef struct Fra_PortMan_t_ Fra_PortMan_t;
+typedef struct Fra_PortThr_t_ Fra_PortThr_t;
+struct Fra_PortThr_t_
+{
+    Fra_PortMan_t *  p;             // the portfolio
+    int              iThread;       // the thread number
+    int              Engine;        // the solver used by this thread
+    sat_solver *     pSat;          // CNF-based solver
+    sat_solver2 *    pSat2;         // CNF-based solver with proof logging
+    int              iRead;         // the next clause to import
+    int              nExported;     // the number of exported clauses
+    int              nImported;     // the number of imported clauses
+    int              RetValue;      // the result of this thread
+    ABC_INT64_T      nConfs;        // the number of conflicts
+    abctime          Time;          // the runtime
+};
+
+struct Fra_PortMan_t_
+{
+    // parameters
+    Aig_Man_t *      pAig;          // the miter
+    ABC_INT64_T      nConfLimit;    // conflict limit of each solver
+    int              nThreads;      // the number of threads
+    int              fShare;        // exchange learned clauses
+    int              fVerbose;      // verbose stats
+    // problem
+    Cnf_Dat_t *      pCnf;          // the CNF of the miter
+    Vec_Int_t *      vCiIds;        // the SAT variables of the CIs
+    Gia_Man_t *      pGia;          // the miter for the circuit solver
+    // solvers
+    Fra_PortThr_t    pThrs[UTIL_PROC_MAX];
+    volatile int     fStop;         // raised when the problem is solved
+    volatile int     iWinner;       // the thread that solved the problem
+    int *            pModel;        // the satisfying assignment of the CIs
+    // clause exchange
+    Fra_PortSlot_t * pSlots;        // the ring buffer
+    volatile int     nSlotsUsed;    // the number of clauses written so far
+};
+
+static char * s_FraPortNames[3] = { "bsat", "bsat2", "cbs" };
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Exports one learned clause into the exchange buffer.]
+
+  Description [The clause is dropped if another thread is writing into
+  the same slot. The LBD is passed to the importing solver, which keeps
+  the clause as a reducible learned clause.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Fra_PortExport( void * pUser, lit * pBeg, lit * pEnd, int Lbd )
+{
+    Fra_PortThr_t * pThr = (Fra_PortThr_t *)pUser;
+    Fra_PortMan_t * p = pThr->p;
+    int iPos = Util_AtomicAdd( &p->nSlotsUsed, 1 );
+    Fra_PortSlot_t * pSlot = p->pSlots + iPos % FRA_PORT_SLOT_NUM;
+    int Stamp = pSlot->Stamp;
+    assert( pEnd - pBeg <= FRA_PORT_SHARE_SIZE );
+    if ( Stamp == -1 || !Util_AtomicCas( &pSlot->Stamp, Stamp, -1 ) )
+        return;
+    pSlot->iThread = pThr->iThread;
+    pSlot->nLits   = pEnd - pBeg;
+    pSlot->Lbd     = Lbd;
+    memcpy( pSlot->pLits, pBeg, sizeof(int) * (pEnd - pBeg) );
+    Util_AtomicWrite( &pSlot->Stamp, iPos );
+    pThr->nExported++;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Imports the clauses learned by other threads.]
+
+  Description [Called by the solver at the top level. The clauses are
+  added as learned clauses, so that they can be removed when the clause
+  database is reduced. Returns 0 if the problem became UNSAT.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Fra_PortImport( void * pUser, sat_solver * pSat )
+{
+    Fra_PortThr_t * pThr = (Fra_PortThr_t *)pUser;
+    Fra_PortMan_t * p = pThr->p;
+    Fra_PortSlot_t * pSlot;
+    int pLits[FRA_PORT_SHARE_SIZE];
+    int nUsed = Util_AtomicRead( &p->nSlotsUsed );
+    int nLits, Lbd, iThread;
+    // skip the clauses that were already overwritten
+    if ( pThr->iRead < nUsed - FRA_PORT_SLOT_NUM )
+        pThr->iRead = nUsed - FRA_PORT_SLOT_NUM;
+    for ( ; pThr->iRead < nUsed; pThr->iRead++ )
+    {
+        pSlot = p->pSlots + pThr->iRead % FRA_PORT_SLOT_NUM;
+        if ( Util_AtomicRead( &pSlot->Stamp ) != pThr->iRead )
+            continue;
+        iThread = pSlot->iThread;
+        nLits   = Abc_MinInt( pSlot->nLits, FRA_PORT_SHARE_SIZE );
+        Lbd     = pSlot->Lbd;
+        memcpy( pLits, pSlot->pLits, sizeof(int) * nLits );
+        Util_AtomicBarrier();
+        // the slot could have been rewritten while it was copied
+        if ( pSlot->Stamp != pThr->iRead || iThread == pThr->iThread || nLits < 1 )
+            continue;
+        pThr->nImported++;
+        if ( !sat_solver_addlearnt( pSat, pLits, pLits + nLits, Lbd ) )
+            return 0;
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Loads the CNF of the miter into sat_solver2.]
+
+  Description [Returns NULL if the problem is found UNSAT while loading.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static sat_solver2 * Fra_PortDeriveSolver2( Cnf_Dat_t * pCnf )
+{
+    sat_solver2 * pSat;
+    Vec_Int_t * vLits;
+    Aig_Obj_t * pObj;
+    int i, RetValue = 1;
+    pSat = sat_solver2_new();
+    sat_solver2_setnvars( pSat, pCnf->nVars );
+    for ( i = 0; RetValue && i < pCnf->nClauses; i++ )
+        RetValue = sat_solver2_addclause( pSat, pCnf->pClauses[i], pCnf->pClauses[i+1], -1 );
+    // add the OR clause for the outputs
+    vLits = Vec_IntAlloc( Aig_ManCoNum(pCnf->pMan) );
+    Aig_ManForEachCo( pCnf->pMan, pObj, i )
+        Vec_IntPush( vLits, toLitCond(pCnf->pVarNums[pObj->Id], 0) );
+    if ( RetValue )
+        RetValue = sat_solver2_addclause( pSat, Vec_IntArray(vLits), Vec_IntLimit(vLits), -1 );
+    Vec_IntFree( vLits );
+    if ( RetValue )
+        RetValue = sat_solver2_simplify( pSat );
+    if ( RetValue )
+        return pSat;
+    sat_solver2_delete( pSat );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the portfolio.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Fra_PortMan_t * Fra_PortManStart( Aig_Man_t * pAig, ABC_INT64_T nConfLimit, int nThreads, int fShare, int fVerbose )
+{
+    Fra_PortMan_t * p;
+    int i;
+    p = ABC_CALLOC( Fra_PortMan_t, 1 );
+    p->pAig       = pAig;
+    p->nConfLimit = nConfLimit;
+    p->nThreads   = nThreads;
+    p->fShare     = fShare;
+    p->fVerbose   = fVerbose;
+    p->iWinner    = -1;
+    p->pCnf       = Cnf_Derive( pAig, Aig_ManCoNum(pAig) );
+    p->vCiIds     = Cnf_DataCollectPiSatNums( p->pCnf, pAig );
+    if ( fShare )
+    {
+        p->pSlots = ABC_CALLOC( Fra_PortSlot_t, FRA_PORT_SLOT_NUM );
+        for ( i = 0; i < FRA_PORT_SLOT_NUM; i++ )
+            p->pSlots[i].Stamp = -2;
+    }
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the portfolio.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Fra_PortManStop( Fra_PortMan_t * p )
+{
+    int i;
+    for ( i = 0; i < p->nThreads; i++ )
+    {
+        if ( p->pThrs[i].pSat )
+            sat_solver_delete( p->pThrs[i].pSat );
+        if ( p->pThrs[i].pSat2 )
+            sat_solver2_delete( p->pThrs[i].pSat2 );
+    }
+    if ( p->pGia )
+        Gia_ManStop( p->pGia );
+    Cnf_DataFree( p->pCnf );
+    Vec_IntFree( p->vCiIds );
+    ABC_FREE( p->pSlots );
+    ABC_FREE( p->pModel );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Creates the solver of one thread.]
+
+  Description [Threads 0 and 1 run sat_solver with the default and with
+  the LBD-based clause management; thread 2 runs the circuit solver;
+  thread 3 runs sat_solver2; other threads run sat_solver with different
+  random seeds, initial polarities and clause management. Returns 0 if
+  the problem is found UNSAT while loading the CNF.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Fra_PortThrStart( Fra_PortMan_t * p, int iThread )
+{
+    Fra_PortThr_t * pThr = p->pThrs + iThread;
+    int v;
+    pThr->p        = p;
+    pThr->iThread  = iThread;
+    pThr->RetValue = -1;
+    if ( iThread == 2 )
+        pThr->Engine = FRA_PORT_CBS;
+    else if ( iThread == 3 )
+        pThr->Engine = FRA_PORT_SAT2;
+    else
+        pThr->Engine = FRA_PORT_SAT;
+    if ( pThr->Engine == FRA_PORT_CBS )
+    {
+        p->pGia = Gia_ManFromAigSimple( p->pAig );
+        return 1;
+    }
+    if ( pThr->Engine == FRA_PORT_SAT2 )
+    {
+        pThr->pSat2 = Fra_PortDeriveSolver2( p->pCnf );
+        if ( pThr->pSat2 == NULL )
+            return 0;
+        pThr->pSat2->pStop = &p->fStop;
+        return 1;
+    }
+    pThr->pSat = (sat_solver *)Cnf_DataWriteIntoSolver( p->pCnf, 1, 0 );
+    if ( pThr->pSat == NULL || !Cnf_DataWriteOrClause( pThr->pSat, p->pCnf ) || !sat_solver_simplify(pThr->pSat) )
+        return 0;
+    pThr->pSat->pStop = &p->fStop;
+    // diversify the solvers
+    if ( iThread & 1 )
+        sat_solver_set_lbd_mode( pThr->pSat, 1 );
+    if ( iThread >= 4 )
+    {
+        pThr->pSat->random_seed += 1000003 * iThread;
+        if ( (iThread >> 1) & 1 )
+            for ( v = 0; v < pThr->pSat->size; v++ )
+                pThr->pSat->polarity[v] = 1;
+    }
+    if ( p->fShare )
+    {
+        pThr->pSat->pShare      = pThr;
+        pThr->pSat->nShareSize  = FRA_PORT_SHARE_SIZE;
+        pThr->pSat->pFuncExport = Fra_PortExport;
+        pThr->pSat->pFuncImport = Fra_PortImport;
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs the circuit solver with increasing conflict limits.]
+
+  Description [Returns the result and sets the satisfying assignment.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Fra_PortSolveCbs( Fra_PortMan_t * p, Fra_PortThr_t * pThr, int ** ppModel )
+{
+    Vec_Int_t * vCexStore;
+    Vec_Str_t * vStatus;
+    int nConfs, i, k, Out, nLits, nUnsat, RetValue = -1;
+    for ( nConfs = 1000; RetValue == -1 && !p->fStop; nConfs = Abc_MinInt( 2 * nConfs, ABC_INFINITY ) )
+    {
+        if ( p->nConfLimit && nConfs > p->nConfLimit )
+            nConfs = (int)p->nConfLimit;
+        ABC_FREE( p->pGia->pRefs );
+        vCexStore = Cbs_ManSolveMiterStop( p->pGia, nConfs, 0, &p->fStop, &vStatus, 0 );
+        pThr->nConfs += nConfs;
+        // check the status of the outputs
+        nUnsat = 0;
+        for ( i = 0; i < Vec_StrSize(vStatus); i++ )
+            nUnsat += (Vec_StrEntry(vStatus, i) == 1);
+        if ( nUnsat == Vec_StrSize(vStatus) )
+            RetValue = 1;
+        // find the first satisfiable output
+        for ( k = 0; RetValue == -1 && k < Vec_IntSize(vCexStore); k += nLits > 0 ? nLits : 0 )
+        {
+            Out   = Vec_IntEntry( vCexStore, k++ );
+            nLits = Vec_IntEntry( vCexStore, k++ );
+            if ( nLits == -1 || Vec_StrEntry(vStatus, Out) != 0 )
+                continue;
+            *ppModel = ABC_CALLOC( int, Gia_ManCiNum(p->pGia) );
+            for ( i = 0; i < nLits; i++ )
+                (*ppModel)[Abc_Lit2Var(Vec_IntEntry(vCexStore, k+i))] = !Abc_LitIsCompl(Vec_IntEntry(vCexStore, k+i));
+            RetValue = 0;
+        }
+        Vec_IntFree( vCexStore );
+        Vec_StrFree( vStatus );
+        if ( p->nConfLimit && nConfs >= p->nConfLimit )
+            break;
+    }
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs the solver of one thread.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Fra_PortSolveThread( void * pUser, int iThread )
+{
+    Fra_PortMan_t * p = (Fra_PortMan_t *)pUser;
+    Fra_PortThr_t * pThr = p->pThrs + iThread;
+    int * pModel = NULL, status;
+    abctime clk = Abc_Clock();
+    if ( pThr->Engine == FRA_PORT_SAT )
+    {
+        status = sat_solver_solve( pThr->pSat, NULL, NULL, p->nConfLimit, 0, 0, 0 );
+        pThr->RetValue = status == l_True ? 0 : (status == l_False ? 1 : -1);
+        if ( pThr->RetValue == 0 )
+            pModel = Sat_SolverGetModel( pThr->pSat, Vec_IntArray(p->vCiIds), Vec_IntSize(p->vCiIds) );
+        pThr->nConfs = pThr->pSat->stats.conflicts;
+    }
+    else if ( pThr->Engine == FRA_PORT_SAT2 )
+    {
+        status = sat_solver2_solve( pThr->pSat2, NULL, NULL, p->nConfLimit, 0, 0, 0 );
+        pThr->RetValue = status == l_True ? 0 : (status == l_False ? 1 : -1);
+        if ( pThr->RetValue == 0 )
+            pModel = Sat_Solver2GetModel( pThr->pSat2, Vec_IntArray(p->vCiIds), Vec_IntSize(p->vCiIds) );
+        pThr->nConfs = pThr->pSat2->stats.conflicts;
+    }
+    else
+        pThr->RetValue = Fra_PortSolveCbs( p, pThr, &pModel );
+    pThr->Time = Abc_Clock() - clk;
+    // the first thread with the answer stops the others
+    if ( pThr->RetValue != -1 && Util_AtomicCas( &p->iWinner, -1, iThread ) )
+    {
+        p->pModel = pModel;
+        pModel = NULL;
+        Util_AtomicWrite( &p->fStop, 1 );
+    }
+    ABC_FREE( pModel );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the combinational miter using a portfolio of solvers.]
+
+  Description [The miter is SAT if at least one output can be 1. Each
+  solver is given the conflict limit (0 = no limit). Returns 1 if UNSAT,
+  0 if SAT (the CI assignment is in pMan->pData), and -1 if undecided.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Fra_FraigSatPortfolio( Aig_Man_t * pMan, ABC_INT64_T nConfLimit, int nThreads, int fShare, int fVerbose )
+{
+    Fra_PortMan_t * p;
+    Fra_PortThr_t * pThr;
+    Util_Pool_t * pPool;
+    int i, RetValue = -1;
+    abctime clk = Abc_Clock();
+    assert( Aig_ManRegNum(pMan) == 0 );
+    assert( nThreads >= 1 && nThreads <= UTIL_PROC_MAX );
+    pMan->pData = NULL;
+    p = Fra_PortManStart( pMan, nConfLimit, nThreads, fShare, fVerbose );
+    if ( fVerbose )
+    {
+        printf( "CNF stats: Vars = %6d. Clauses = %7d. Literals = %8d. ", p->pCnf->nVars, p->pCnf->nClauses, p->pCnf->nLiterals );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    for ( i = 0; i < nThreads; i++ )
+        if ( !Fra_PortThrStart( p, i ) )
+        {
+            Fra_PortManStop( p );
+            return 1;
+        }
+    // run the solvers
+    pPool = Util_PoolStart( nThreads );
+    Util_PoolRun( pPool, Fra_PortSolveThread, p );
+    Util_PoolStop( pPool );
+    // collect the results
+    if ( p->iWinner >= 0 )
+    {
+        RetValue = p->pThrs[p->iWinner].RetValue;
+        pMan->pData = p->pModel;
+        p->pModel = NULL;
+    }
+    if ( fVerbose )
+    {
+        for ( i = 0; i < nThreads; i++ )
+        {
+            pThr = p->pThrs + i;
+            printf( "Thread %2d : %-5s  %-10s  Conf = %10.0f  ", i, s_FraPortNames[pThr->Engine],
+                pThr->RetValue == 1 ? "UNSAT" : (pThr->RetValue == 0 ? "SAT" : "UNDECIDED"), (double)pThr->nConfs );
+            if ( pThr->Engine == FRA_PORT_SAT && fShare )
+                printf( "Exp = %7d  Imp = %7d  ", pThr->nExported, pThr->nImported );
+            Abc_PrintTime( 1, "Time", pThr->Time );
+        }
+        if ( p->iWinner >= 0 )
+            printf( "The problem was solved by thread %d (%s).\n", p->iWinner, s_FraPortNames[p->pThrs[p->iWinner].Engine] );
+    }
+    Fra_PortManStop( p );
+    return RetValue;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -69,6 +69,7 @@ void Prove_ParamsSetDefault( Prove_Params_t * pParams )
     // last-gasp mitering
 //    pParams->nMiteringLimitLast   = 1000000; // final mitering limit
     pParams->nMiteringLimitLast   = 0;       // final mitering limit
+    pParams->nProcs               = 0;       // the number of portfolio solvers in final mitering
     // global SAT solver limits
     pParams->nTotalBacktrackLimit = 0;       // global limit on the number of backtracks
     pParams->nTotalInspectLimit   = 0;       // global limit on the number of clause inspects
@@ -66,6 +66,9 @@ struct Inter_ManParams_t_
     int  fDropInvar;    // dump inductive invariant into file
     int  fVerbose;      // print verbose statistics
     int  iFrameMax;     // the time frame reached
+    int  RunId;         // interpolation id in this run
+    int(*pFuncStop)(int); // callback to terminate
+    volatile int * pStop; // flag raised by another thread to stop the SAT calls
     char * pFileName;   // file name to dump interpolant
 };
 
@@ -102,7 +102,7 @@ Aig_Man_t * Inter_ManUnrollFrames( Aig_Man_t * pAig, int nFrames )
   SeeAlso     []
 
 ***********************************************************************/
-Inter_Check_t * Inter_CheckStart( Aig_Man_t * pTrans, int nFramesK )
+Inter_Check_t * Inter_CheckStart( Aig_Man_t * pTrans, int nFramesK, volatile int * pStop )
 {
     Inter_Check_t * p;
     // create solver
@@ -117,6 +117,7 @@ Inter_Check_t * Inter_CheckStart( Aig_Man_t * pTrans, int nFramesK )
     // convert to CNF
     p->pCnf = Cnf_Derive( p->pFrames, Aig_ManCoNum(p->pFrames) ); 
     p->pSat = (sat_solver *)Cnf_DataWriteIntoSolver( p->pCnf, 1, 0 );
+    p->pSat->pStop = pStop;
     // assign parameters
     p->nFramesK = nFramesK;
     p->nVars    = p->pCnf->nVars;
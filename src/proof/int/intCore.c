@@ -178,7 +178,7 @@ p->timeCnf += Abc_Clock() - clk;
         // start containment checking
         if ( !(pPars->fTransLoop || pPars->fUseBackward || pPars->nFramesK > 1) )
         {
-            pCheck = Inter_CheckStart( p->pAigTrans, pPars->nFramesK );
+            pCheck = Inter_CheckStart( p->pAigTrans, pPars->nFramesK, pPars->pStop );
             // try new containment check for the initial state
 clk = Abc_Clock();
             pCnfInter2 = Cnf_Derive( p->pInter, 1 );  
@@ -196,6 +196,15 @@ p->timeEqu += Abc_Clock() - clk;
         // iterate the interpolation procedure
         for ( i = 0; ; i++ )
         {
+            if ( pPars->pFuncStop && pPars->pFuncStop(pPars->RunId) )
+            {
+                if ( pPars->fVerbose )
+                    printf( "Interpolation was interrupted by the callback.\n" );
+                p->timeTotal = Abc_Clock() - clkTotal;
+                Inter_ManStop( p, 0 );
+                Inter_CheckStop( pCheck );
+                return -1;
+            }
             if ( pPars->nFramesMax && p->nFrames + i >= pPars->nFramesMax )
             { 
                 if ( pPars->fVerbose )
@@ -242,6 +251,7 @@ p->timeEqu += Abc_Clock() - clk;
                         pParsBmc->nConfLimit = 100000000;
                         pParsBmc->nStart     = p->nFrames;
                         pParsBmc->fVerbose   = pPars->fVerbose;
+                        pParsBmc->pStop      = pPars->pStop;
                         RetValue = Saig_ManBmcScalable( pAig, pParsBmc );
                         if ( RetValue == 1 )
                             printf( "Error: The problem should be SAT but it is UNSAT.\n" );
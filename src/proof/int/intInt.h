@@ -68,6 +68,7 @@ struct Inter_Man_t_
     int              nFrames;      // the number of timeframes
     int              nConfCur;     // the current number of conflicts
     int              nConfLimit;   // the limit on the number of conflicts
+    volatile int *   pStop;        // flag raised by another thread to stop the SAT calls
     int              fVerbose;     // the verbosiness flag
     char *           pFileName;
     // runtime
@@ -92,7 +93,7 @@ typedef struct Inter_Check_t_ Inter_Check_t;
 ////////////////////////////////////////////////////////////////////////
 
 /*=== intCheck.c ============================================================*/
-extern Inter_Check_t * Inter_CheckStart( Aig_Man_t * pTrans, int nFramesK );
+extern Inter_Check_t * Inter_CheckStart( Aig_Man_t * pTrans, int nFramesK, volatile int * pStop );
 extern void            Inter_CheckStop( Inter_Check_t * p );
 extern int             Inter_CheckPerform( Inter_Check_t * p, Cnf_Dat_t * pCnf, abctime nTimeNewOut );
 
@@ -55,6 +55,7 @@ void Llb_ManSetDefaultParams( Gia_ParLlb_t * p )
     p->nVolumeMax    =      100;  // max volume
     p->nVolumeMin    =       30;  // min volume
     p->nPartValue    =        5;  // partitioning value
+    p->nProcs        =        1;  // one thread
     p->fBackward     =        0;  // forward by default
     p->fReorder      =        1;
     p->fIndConstr    =        0;
@@ -69,6 +70,7 @@ void Llb_ManSetDefaultParams( Gia_ParLlb_t * p )
 //    p->TimeLimit     =        0;
     p->TimeLimitGlo  =        0;
     p->TimeTarget    =        0;
+    p->TimeTargetWall=        0;
     p->iFrame        =       -1;
 }
 
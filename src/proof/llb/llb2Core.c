@@ -145,7 +145,7 @@ Abc_Cex_t * Llb_CoreDeriveCex( Llb_Img_t * p )
             continue;
         // compute the next states
         bImage = Llb_ImgComputeImage( p->pAig, p->vDdMans, p->dd, bState, 
-            vQuant0, vQuant1, p->vDriRefs, p->pPars->TimeTarget, 1, 0, 0 );
+            vQuant0, vQuant1, p->vDriRefs, p->pPars->TimeTarget, 0, 1, 0, 1, 0 );
         assert( bImage != NULL );
         Cudd_Ref( bImage );
         Cudd_RecursiveDeref( p->dd, bState );
@@ -288,7 +288,7 @@ int Llb_CoreReachability_int( Llb_Img_t * p, Vec_Ptr_t * vQuant0, Vec_Ptr_t * vQ
     { 
         clk2 = Abc_Clock();
         // check the runtime limit
-        if ( p->pPars->TimeLimit && Abc_Clock() > p->pPars->TimeTarget )
+        if ( p->pPars->TimeLimit && (Abc_Clock() > p->pPars->TimeTarget || Util_WallClock() > p->pPars->TimeTargetWall) )
         {
             if ( !p->pPars->fSilent )
                 printf( "Reached timeout (%d seconds) during image computation.\n",  p->pPars->TimeLimit );
@@ -334,8 +334,8 @@ int Llb_CoreReachability_int( Llb_Img_t * p, Vec_Ptr_t * vQuant0, Vec_Ptr_t * vQ
 
         // compute the next states
         bNext = Llb_ImgComputeImage( p->pAig, p->vDdMans, p->dd, bCurrent, 
-            vQuant0, vQuant1, p->vDriRefs, p->pPars->TimeTarget, 
-            p->pPars->fBackward, p->pPars->fReorder, p->pPars->fVeryVerbose );
+            vQuant0, vQuant1, p->vDriRefs, p->pPars->TimeTarget, p->pPars->TimeTargetWall, 
+            p->pPars->fBackward, p->pPars->fReorder, p->pPars->nProcs, p->pPars->fVeryVerbose );
         if ( bNext == NULL )
         {
             if ( !p->pPars->fSilent )
@@ -732,6 +732,8 @@ int Llb_ManReachMinCut( Aig_Man_t * pAig, Gia_ParLlb_t * pPars )
 
     // compute time to stop
     pPars->TimeTarget = pPars->TimeLimit ? pPars->TimeLimit * CLOCKS_PER_SEC + Abc_Clock(): 0;
+    // the threads of image computation do not use the CPU time of this thread
+    pPars->TimeTargetWall = pPars->TimeLimit ? pPars->TimeLimit * CLOCKS_PER_SEC + Util_WallClock(): 0;
 
     p = Aig_ManDupFlopsOnly( pAig );
 //Aig_ManShow( p, 0, NULL );
@@ -30,6 +30,21 @@ ABC_NAMESPACE_IMPL_START
 extern Vec_Ptr_t * Llb_ManCutNodes( Aig_Man_t * p, Vec_Ptr_t * vLower, Vec_Ptr_t * vUpper );
 extern Vec_Ptr_t * Llb_ManCutRange( Aig_Man_t * p, Vec_Ptr_t * vLower, Vec_Ptr_t * vUpper );
 
+// the task of computing the product of a cluster of partitions
+typedef struct Llb_ImgTask_t_ Llb_ImgTask_t;
+struct Llb_ImgTask_t_
+{
+    Aig_Man_t *     pAig;          // the AIG
+    DdManager *     dd;            // the manager, in which the product is computed
+    DdNode *        bRes;          // the product (referenced in dd)
+    int             iFirst;        // the first partition of the cluster
+    int             iLast;         // the last partition of the cluster
+    Vec_Ptr_t *     vMans;         // the managers of the functions to conjoin
+    Vec_Ptr_t *     vFuncs;        // the functions to conjoin
+    Vec_Ptr_t *     vQuants;       // the variables to quantify after each conjunction
+    abctime         TimeStop;      // the wall-clock deadline (0 = no limit)
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -350,6 +365,315 @@ void Llb_ImgQuantifyReset( Vec_Ptr_t * vDdMans )
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Starts the task of computing the product in the manager.]
+
+  Description [The product is initialized to constant 1.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Llb_ImgTask_t * Llb_ImgTaskStart( Aig_Man_t * pAig, DdManager * dd, int iFirst, int iLast, abctime TimeStop )
+{
+    Llb_ImgTask_t * p;
+    p = ABC_CALLOC( Llb_ImgTask_t, 1 );
+    p->pAig       = pAig;
+    p->dd         = dd;
+    p->bRes       = Cudd_ReadOne( dd );  Cudd_Ref( p->bRes );
+    p->iFirst     = iFirst;
+    p->iLast      = iLast;
+    p->vMans      = Vec_PtrAlloc( 16 );
+    p->vFuncs     = Vec_PtrAlloc( 16 );
+    p->vQuants    = Vec_PtrAlloc( 16 );
+    p->TimeStop   = TimeStop;
+    return p;
+}
+void Llb_ImgTaskClean( Llb_ImgTask_t * p )
+{
+    Vec_Int_t * vQuant;
+    int i;
+    Vec_PtrForEachEntry( Vec_Int_t *, p->vQuants, vQuant, i )
+        Vec_IntFree( vQuant );
+    Vec_PtrClear( p->vMans );
+    Vec_PtrClear( p->vFuncs );
+    Vec_PtrClear( p->vQuants );
+}
+void Llb_ImgTaskStop( Llb_ImgTask_t * p )
+{
+    Llb_ImgTaskClean( p );
+    if ( p->bRes )
+        Cudd_RecursiveDeref( p->dd, p->bRes );
+    Vec_PtrFree( p->vMans );
+    Vec_PtrFree( p->vFuncs );
+    Vec_PtrFree( p->vQuants );
+    ABC_FREE( p );
+}
+void Llb_ImgTaskAdd( Llb_ImgTask_t * p, DdManager * dd, DdNode * bFunc, Vec_Int_t * vQuant )
+{
+    Vec_PtrPush( p->vMans, dd );
+    Vec_PtrPush( p->vFuncs, bFunc );
+    Vec_PtrPush( p->vQuants, vQuant );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs the task.]
+
+  Description [Transfers the functions into the task's manager, conjoins
+  them with the product and quantifies the variables. Only the task's
+  manager is modified; the managers of the functions are only read. 
+  Returns 0 if the product could not be computed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Llb_ImgTaskPerform( Llb_ImgTask_t * p )
+{
+    DdManager * ddFunc;
+    DdNode * bFunc, * bCube, * bTemp;
+    int i;
+    if ( p->bRes == NULL )
+        return 0;
+    // CUDD measures the CPU time of this thread, so it gets the wall-clock time left
+    if ( p->TimeStop && Util_WallClock() >= p->TimeStop )
+    {
+        Llb_ImgTaskClean( p );
+        Cudd_RecursiveDeref( p->dd, p->bRes );
+        p->bRes = NULL;
+        return 0;
+    }
+    p->dd->TimeStop = p->TimeStop ? Abc_Clock() + (p->TimeStop - Util_WallClock()) : 0;
+    // CUDD serializes dynamic reordering in the managers of different threads
+    Cudd_AutodynEnable( p->dd, CUDD_REORDER_SYMM_SIFT );
+    Vec_PtrForEachEntry( DdManager *, p->vMans, ddFunc, i )
+    {
+        bFunc = (DdNode *)Vec_PtrEntry( p->vFuncs, i );
+        if ( ddFunc != p->dd )
+            bFunc = Cudd_bddTransfer( ddFunc, p->dd, bFunc );
+        if ( bFunc == NULL )
+        {
+            Cudd_RecursiveDeref( p->dd, p->bRes );
+            p->bRes = NULL;
+            break;
+        }
+        Cudd_Ref( bFunc );
+        bCube   = Llb_ImgComputeCube( p->pAig, (Vec_Int_t *)Vec_PtrEntry(p->vQuants, i), p->dd );  Cudd_Ref( bCube );
+        p->bRes = Cudd_bddAndAbstract( p->dd, bTemp = p->bRes, bFunc, bCube );
+        if ( p->bRes )
+            Cudd_Ref( p->bRes );
+        Cudd_RecursiveDeref( p->dd, bTemp );
+        Cudd_RecursiveDeref( p->dd, bCube );
+        Cudd_RecursiveDeref( p->dd, bFunc );
+        if ( p->bRes == NULL )
+            break;
+    }
+    Cudd_AutodynDisable( p->dd );
+    p->dd->TimeStop = 0;
+    Llb_ImgTaskClean( p );
+    return p->bRes != NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs the tasks of one level of the tree.]
+
+  Description [Each task works in its own manager, so the threads of 
+  the pool take the tasks one by one until none is left.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Llb_ImgTasks_t_ Llb_ImgTasks_t;
+struct Llb_ImgTasks_t_
+{
+    Vec_Ptr_t *     vTasks;        // the tasks of the level
+    volatile int    iNext;         // the next task to perform
+};
+void Llb_ImgTaskThread( void * pUser, int iThread )
+{
+    Llb_ImgTasks_t * p = (Llb_ImgTasks_t *)pUser;
+    int iTask;
+    while ( (iTask = Util_AtomicAdd(&p->iNext, 1)) < Vec_PtrSize(p->vTasks) )
+        Llb_ImgTaskPerform( (Llb_ImgTask_t *)Vec_PtrEntry(p->vTasks, iTask) );
+}
+int Llb_ImgTasksPerform( Util_Pool_t * pPool, Vec_Ptr_t * vTasks )
+{
+    Llb_ImgTasks_t Tasks;
+    Llb_ImgTask_t * pTask;
+    int i, RetValue = 1;
+    Tasks.vTasks = vTasks;
+    Tasks.iNext  = 0;
+    Util_PoolRun( pPool, Llb_ImgTaskThread, &Tasks );
+    Vec_PtrForEachEntry( Llb_ImgTask_t *, vTasks, pTask, i )
+        RetValue &= (pTask->bRes != NULL);
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects variables to quantify in a cluster.]
+
+  Description [Collects variables, whose last occurrence is in partitions
+  iStart to iStop, and which do not occur in partitions before iFirst.
+  Unless pSuppS is NULL, the variables of the state set are skipped,
+  because the state set is conjoined with every cluster.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Llb_ImgCollectQuant( Vec_Ptr_t * vQuant1, int iStart, int iStop, int iFirst, Vec_Int_t * vFirst, int * pSuppS, int nSuppS )
+{
+    Vec_Int_t * vRes, * vQuant;
+    int i, k, Var;
+    vRes = Vec_IntAlloc( 16 );
+    for ( i = iStart; i <= iStop; i++ )
+    {
+        vQuant = (Vec_Int_t *)Vec_PtrEntry( vQuant1, i+1 );
+        Vec_IntForEachEntry( vQuant, Var, k )
+        {
+            if ( Vec_IntEntry(vFirst, Var) >= 0 && Vec_IntEntry(vFirst, Var) < iFirst )
+                continue;
+            if ( pSuppS && Var < nSuppS && pSuppS[Var] )
+                continue;
+            Vec_IntPush( vRes, Var );
+        }
+    }
+    return vRes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the product of the state set and the partitions.]
+
+  Description [Divides the partitions into nProcs clusters of consecutive
+  partitions. The partial image of each cluster (the product of the state 
+  set and the partitions of the cluster) is computed on a separate thread
+  in the manager of the first partition of the cluster, while quantifying
+  the variables that do not occur outside of the cluster. The partial 
+  images are then conjoined pairwise in a tree reduction. The result is 
+  the same as the one produced by the loop in Llb_ImgComputeImage().]
+               
+  SideEffects [The partition managers are used as the scratch space.]
+
+  SeeAlso     []
+
+***********************************************************************/
+DdNode * Llb_ImgComputeProductPar( Aig_Man_t * pAig, Vec_Ptr_t * vDdMans, DdManager * dd, DdNode * bState, 
+    Vec_Ptr_t * vQuant1, abctime TimeTarget, abctime TimeTargetWall, int nProcs, int fVerbose )
+{
+    Vec_Ptr_t * vTasks, * vNext, * vDone;
+    Vec_Int_t * vFirst;
+    Llb_ImgTask_t * pTask, * pTask2;
+    Util_Pool_t * pPool;
+    DdManager * ddPart;
+    DdNode * bRes = NULL;
+    int * pSupp, * pSuppS;
+    int i, k, iFirst, iLast, nSize, nParts = Vec_PtrSize(vDdMans);
+    int nClusters = Abc_MinInt( Abc_MinInt(nProcs, UTIL_PROC_MAX), nParts ), nLevels = 0;
+    abctime clk = Util_WallClock(), TimeStop = dd->TimeStop;
+    assert( nClusters > 1 );
+    if ( TimeTarget && Abc_Clock() > TimeTarget )
+        return NULL;
+    if ( TimeTargetWall && Util_WallClock() > TimeTargetWall )
+        return NULL;
+    // the main manager is only read by the threads
+    dd->TimeStop = 0;
+    // find the first partition, in which each variable occurs
+    nSize = Cudd_ReadSize( dd );
+    Vec_PtrForEachEntry( DdManager *, vDdMans, ddPart, i )
+        nSize = Abc_MaxInt( nSize, Cudd_ReadSize(ddPart) );
+    vFirst = Vec_IntStartFull( nSize );
+    Vec_PtrForEachEntry( DdManager *, vDdMans, ddPart, i )
+    {
+        pSupp = Cudd_SupportIndex( ddPart, ddPart->bFunc );
+        for ( k = 0; k < Cudd_ReadSize(ddPart); k++ )
+            if ( pSupp[k] && Vec_IntEntry(vFirst, k) == -1 )
+                Vec_IntWriteEntry( vFirst, k, i );
+        ABC_FREE( pSupp );
+    }
+    pSuppS = Cudd_SupportIndex( dd, bState );
+    // create the clusters
+    vTasks = Vec_PtrAlloc( nClusters );
+    for ( i = 0; i < nClusters; i++ )
+    {
+        iFirst = i * nParts / nClusters;
+        iLast  = (i + 1) * nParts / nClusters - 1;
+        pTask  = Llb_ImgTaskStart( pAig, (DdManager *)Vec_PtrEntry(vDdMans, iFirst), iFirst, iLast, TimeTargetWall );
+        Llb_ImgTaskAdd( pTask, dd, bState, Vec_IntAlloc(0) );
+        for ( k = iFirst; k <= iLast; k++ )
+        {
+            ddPart = (DdManager *)Vec_PtrEntry( vDdMans, k );
+            Llb_ImgTaskAdd( pTask, ddPart, ddPart->bFunc, Llb_ImgCollectQuant(vQuant1, k, k, iFirst, vFirst, pSuppS, Cudd_ReadSize(dd)) );
+        }
+        Vec_PtrPush( vTasks, pTask );
+    }
+    // perform the tree reduction
+    pPool = Util_PoolStart( nClusters );
+    vNext = Vec_PtrAlloc( nClusters );
+    vDone = Vec_PtrAlloc( nClusters );
+    while ( Llb_ImgTasksPerform( pPool, vTasks ) )
+    {
+        if ( fVerbose )
+        {
+            printf( "   Level %d : ", nLevels );
+            Vec_PtrForEachEntry( Llb_ImgTask_t *, vTasks, pTask, i )
+                printf( "%d-%d =%6d  ", pTask->iFirst, pTask->iLast, Cudd_DagSize(pTask->bRes) );
+            Abc_PrintTime( 1, "T", Util_WallClock() - clk );
+        }
+        nLevels++;
+        Vec_PtrForEachEntry( Llb_ImgTask_t *, vDone, pTask, i )
+            Llb_ImgTaskStop( pTask );
+        Vec_PtrClear( vDone );
+        if ( Vec_PtrSize(vTasks) == 1 )
+        {
+            pTask = (Llb_ImgTask_t *)Vec_PtrEntry( vTasks, 0 );
+            bRes  = Cudd_bddTransfer( pTask->dd, dd, pTask->bRes );
+            if ( bRes )
+                Cudd_Ref( bRes );
+            break;
+        }
+        // conjoin the neighboring clusters in the manager of the first one
+        Vec_PtrClear( vNext );
+        for ( i = 0; i < Vec_PtrSize(vTasks); i += 2 )
+        {
+            pTask = (Llb_ImgTask_t *)Vec_PtrEntry( vTasks, i );
+            Vec_PtrPush( vNext, pTask );
+            if ( i + 1 == Vec_PtrSize(vTasks) )
+                continue;
+            pTask2 = (Llb_ImgTask_t *)Vec_PtrEntry( vTasks, i + 1 );
+            // the state variables can be quantified only when all partitions are conjoined
+            Llb_ImgTaskAdd( pTask, pTask2->dd, pTask2->bRes, Llb_ImgCollectQuant(vQuant1, pTask->iFirst, pTask2->iLast, pTask->iFirst, vFirst, 
+                (pTask->iFirst == 0 && pTask2->iLast == nParts - 1) ? NULL : pSuppS, Cudd_ReadSize(dd)) );
+            pTask->iLast = pTask2->iLast;
+            Vec_PtrPush( vDone, pTask2 );
+        }
+        ABC_SWAP( Vec_Ptr_t *, vTasks, vNext );
+    }
+    Vec_PtrForEachEntry( Llb_ImgTask_t *, vDone, pTask, i )
+        Llb_ImgTaskStop( pTask );
+    Vec_PtrForEachEntry( Llb_ImgTask_t *, vTasks, pTask, i )
+        Llb_ImgTaskStop( pTask );
+    Util_PoolStop( pPool );
+    Vec_PtrFree( vTasks );
+    Vec_PtrFree( vNext );
+    Vec_PtrFree( vDone );
+    Vec_IntFree( vFirst );
+    ABC_FREE( pSuppS );
+    dd->TimeStop = TimeStop;
+    if ( bRes )
+        Cudd_Deref( bRes );
+    return bRes;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Computes image of the initial set of states.]
@@ -363,7 +687,7 @@ void Llb_ImgQuantifyReset( Vec_Ptr_t * vDdMans )
 ***********************************************************************/
 DdNode * Llb_ImgComputeImage( Aig_Man_t * pAig, Vec_Ptr_t * vDdMans, DdManager * dd, DdNode * bInit, 
     Vec_Ptr_t * vQuant0, Vec_Ptr_t * vQuant1, Vec_Int_t * vDriRefs, 
-    abctime TimeTarget, int fBackward, int fReorder, int fVerbose )
+    abctime TimeTarget, abctime TimeTargetWall, int fBackward, int fReorder, int nProcs, int fVerbose )
 {
 //    int fCheckSupport = 0;
     DdManager * ddPart;
@@ -396,7 +720,15 @@ DdNode * Llb_ImgComputeImage( Aig_Man_t * pAig, Vec_Ptr_t * vDdMans, DdManager *
         Cudd_RecursiveDeref( dd, bCube );
     }
     // perform image computation
-    Vec_PtrForEachEntry( DdManager *, vDdMans, ddPart, i )
+    if ( nProcs > 1 && Vec_PtrSize(vDdMans) > 1 )
+    {
+        bImage = Llb_ImgComputeProductPar( pAig, vDdMans, dd, bTemp = bImage, vQuant1, TimeTarget, TimeTargetWall, nProcs, fVerbose );
+        Cudd_RecursiveDeref( dd, bTemp );
+        if ( bImage == NULL )
+            return NULL;
+        Cudd_Ref( bImage );
+    }
+    else Vec_PtrForEachEntry( DdManager *, vDdMans, ddPart, i )
     {
         clk = Abc_Clock();
 if ( fVerbose )
@@ -31,6 +31,7 @@
 #include "aig/saig/saig.h"
 #include "proof/ssw/ssw.h"
 #include "misc/extra/extraBdd.h"
+#include "misc/util/utilPth.h"
 #include "llb.h"
 
 ////////////////////////////////////////////////////////////////////////
@@ -171,7 +172,7 @@ extern void            Llb_ImgQuantifyFirst( Aig_Man_t * pAig, Vec_Ptr_t * vDdMa
 extern void            Llb_ImgQuantifyReset( Vec_Ptr_t * vDdMans );
 extern DdNode *        Llb_ImgComputeImage( Aig_Man_t * pAig, Vec_Ptr_t * vDdMans, DdManager * dd, DdNode * bInit, 
                            Vec_Ptr_t * vQuant0, Vec_Ptr_t * vQuant1, Vec_Int_t * vDriRefs, 
-                           abctime TimeTarget, int fBackward, int fReorder, int fVerbose );
+                           abctime TimeTarget, abctime TimeTargetWall, int fBackward, int fReorder, int nProcs, int fVerbose );
 
 extern DdManager *     Llb_NonlinImageStart( Aig_Man_t * pAig, Vec_Ptr_t * vLeaves, Vec_Ptr_t * vRoots, int * pVars2Q, int * pOrder, int fFirst, abctime TimeTarget );
 extern DdNode *        Llb_NonlinImageCompute( DdNode * bCurrent, int fReorder, int fDrop, int fVerbose, int * pOrder );
@@ -48,6 +48,7 @@ struct Pdr_Par_t_
     int nTimeOut;         // timeout in seconds
     int nTimeOutGap;      // approximate timeout in seconds since the last change
     int nTimeOutOne;      // approximate timeout in seconds per one output
+    int nProcs;           // the number of threads
     int fTwoRounds;       // use two rounds for generalization
     int fMonoCnf;         // monolythic CNF
     int fDumpInv;         // dump inductive invariant
@@ -55,11 +56,13 @@ struct Pdr_Par_t_
     int fShiftStart;      // allows clause pushing to start from an intermediate frame
     int fReuseProofOblig; // reuses proof-obligationgs in the last timeframe
     int fSkipGeneral;     // skips expensive generalization step
+    int fLbdMode;         // use LBD-based clause management and restarts
     int fVerbose;         // verbose output`
     int fVeryVerbose;     // very verbose output
     int fNotVerbose;      // not printing line by line progress
     int fSilent;          // totally silent execution
     int fSolveAll;        // do not stop when found a SAT output
+    int fProveEach;       // prove outputs individually as soon as possible (in the MO mode)
     int fStoreCex;        // enable storing counter-examples in MO mode
     int fUseBridge;       // use bridge interface
     int nFailOuts;        // the number of failed outputs
@@ -70,6 +73,8 @@ struct Pdr_Par_t_
     int(*pFuncStop)(int); // callback to terminate
     int(*pFuncOnFail)(int,Abc_Cex_t*); // called for a failed output in MO mode
     abctime timeLastSolved; // the time when the last output was solved
+    char * pDumpFile;     // file name to write the clauses of all frames
+    char * pLoadFile;     // file name to read the clauses for warm-start
     Vec_Int_t * vOutMap;  // in the multi-output mode, contains status for each PO (0 = sat; 1 = unsat; negative = undecided)
 };
 
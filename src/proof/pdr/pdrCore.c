@@ -55,13 +55,16 @@ void Pdr_ManSetDefaultParams( Pdr_Par_t * pPars )
     pPars->nTimeOutGap    =       0;  // timeout in seconds since the last solved
     pPars->nConfLimit     =       0;  // limit on SAT solver conflicts
     pPars->nRestLimit     =       0;  // limit on the number of proof-obligations
+    pPars->nProcs         =       1;  // the number of threads
     pPars->fTwoRounds     =       0;  // use two rounds for generalization
     pPars->fMonoCnf       =       0;  // monolythic CNF
     pPars->fDumpInv       =       0;  // dump inductive invariant
     pPars->fShortest      =       0;  // forces bug traces to be shortest
+    pPars->fLbdMode       =       0;  // LBD-based clause management and restarts
     pPars->fVerbose       =       0;  // verbose output
     pPars->fVeryVerbose   =       0;  // very verbose output
     pPars->fNotVerbose    =       0;  // not printing line-by-line progress
+    pPars->fProveEach     =       0;  // prove outputs individually as soon as possible
     pPars->iFrame         =      -1;  // explored up to this frame
     pPars->nFailOuts      =       0;  // the number of disproved outputs
     pPars->nDropOuts      =       0;  // the number of timed out outputs
@@ -243,10 +246,15 @@ int Pdr_ManCheckContainment( Pdr_Man_t * p, int k, Pdr_Set_t * pSet )
     Pdr_Set_t * pThis;
     Vec_Ptr_t * vArrayK;
     int i, j, kMax = Vec_PtrSize(p->vSolvers)-1;
+    Util_LockRead( p->pLockDb );
     Vec_VecForEachLevelStartStop( p->vClauses, vArrayK, i, k, kMax+1 )
         Vec_PtrForEachEntry( Pdr_Set_t *, vArrayK, pThis, j )
             if ( Pdr_SetContains( pSet, pThis ) )
+            {
+                Util_LockUnlock( p->pLockDb );
                 return 1;
+            }
+    Util_LockUnlock( p->pLockDb );
     return 0;
 }
 
@@ -516,6 +524,7 @@ int Pdr_ManBlockCube( Pdr_Man_t * p, Pdr_Set_t * pCube )
                 assert( (pCubeMin->Lits[i] / 2) < Aig_ManRegNum(p->pAig) );
                 Vec_IntAddToEntry( p->vPrio, pCubeMin->Lits[i] / 2, 1 );
             }
+            pCubeMin->iOut = p->iOutCur;
             Vec_VecPush( p->vClauses, k, pCubeMin );   // consume ref
             p->nCubes++;
             // add clause
@@ -570,10 +579,11 @@ int Pdr_ManBlockCube( Pdr_Man_t * p, Pdr_Set_t * pCube )
 int Pdr_ManSolveInt( Pdr_Man_t * p )
 {
     int fPrintClauses = 0;
-    Pdr_Set_t * pCube = NULL;
+    Pdr_Set_t * pCube = NULL, * pTemp;
+    Vec_Ptr_t * vLoaded;
     Aig_Obj_t * pObj;
     Abc_Cex_t * pCexNew;
-    int k, RetValue = -1;
+    int i, k, RetValue = -1;
     int nOutDigits = Abc_Base10Log( Saig_ManPoNum(p->pAig) );
     abctime clkStart = Abc_Clock(), clkOne = 0;
     p->timeToStop = p->pPars->nTimeOut ? p->pPars->nTimeOut * CLOCKS_PER_SEC + Abc_Clock(): 0;
@@ -604,6 +614,9 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
             // skip output whose time has run out
             if ( p->pTime4Outs && p->pTime4Outs[p->iOutCur] == 0 )
                 continue;
+            // skip proved outputs, so that they do not use up their time and get dropped
+            if ( p->pTime4Outs && p->pPars->vOutMap && Vec_IntEntry(p->pPars->vOutMap, p->iOutCur) == 1 )
+                continue;
             // check if the output is trivially solved
             if ( Aig_ObjChild0(pObj) == Aig_ManConst0(p->pAig) )
                 continue;
@@ -621,7 +634,7 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
                 if ( p->pPars->vOutMap ) Vec_IntWriteEntry( p->pPars->vOutMap, p->iOutCur, 0 );
                 if ( !p->pPars->fNotVerbose )
                 Abc_Print( 1, "Output %*d was trivially asserted in frame %2d (solved %*d out of %*d outputs).\n",
-                    nOutDigits, p->iOutCur, k, nOutDigits, p->pPars->nFailOuts, nOutDigits, Saig_ManPoNum(p->pAig) );
+                    nOutDigits, p->iOutCur, k, nOutDigits, p->pPars->nFailOuts + p->pPars->nProveOuts, nOutDigits, Saig_ManPoNum(p->pAig) );
                 assert( Vec_PtrEntry(p->vCexes, p->iOutCur) == NULL );
                 if ( p->pPars->fUseBridge )
                     Gia_ManToBridgeResult( stdout, 0, pCexNew, pCexNew->iPo );
@@ -739,7 +752,7 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
                         }
                         if ( !p->pPars->fNotVerbose )
                             Abc_Print( 1, "Output %*d was asserted in frame %2d (%2d) (solved %*d out of %*d outputs).\n",
-                                nOutDigits, p->iOutCur, k, k, nOutDigits, p->pPars->nFailOuts, nOutDigits, Saig_ManPoNum(p->pAig) );
+                                nOutDigits, p->iOutCur, k, k, nOutDigits, p->pPars->nFailOuts + p->pPars->nProveOuts, nOutDigits, Saig_ManPoNum(p->pAig) );
                         if ( p->pPars->nFailOuts == Saig_ManPoNum(p->pAig) )
                             return 0; // all SAT
                         Pdr_QueueClean( p );
@@ -774,6 +787,16 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
         assert( pCube == NULL );
         Pdr_ManSetPropertyOutput( p, k );
         Pdr_ManCreateSolver( p, ++k );
+        // add the clauses of the previous run, which are still inductive
+        if ( k == 1 && p->pPars->pLoadFile && (vLoaded = Pdr_ManLoadFrames(p, p->pPars->pLoadFile)) )
+        {
+            Vec_PtrForEachEntry( Pdr_Set_t *, vLoaded, pTemp, i )
+            {
+                Vec_VecPush( p->vClauses, k, pTemp );   // consume ref
+                Pdr_ManSolverAddClause( p, k, pTemp );
+            }
+            Vec_PtrFree( vLoaded );
+        }
         if ( fPrintClauses )
         {
             Abc_Print( 1, "*** Clauses after frame %d:\n", k );
@@ -821,6 +844,20 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
                 return 0; // SAT
             return -1;
         }
+        // in the multi-output mode, prove the outputs implied by the inductive subset of the last frame
+        if ( p->pPars->fSolveAll && p->pPars->fProveEach && Pdr_ManProveOutputs(p, k) > 0 )
+        {
+            p->pPars->timeLastSolved = Abc_Clock();
+            if ( p->pPars->nFailOuts + p->pPars->nProveOuts + p->pPars->nDropOuts == Saig_ManPoNum(p->pAig) )
+            {
+                if ( p->pPars->fVerbose )
+                    Pdr_ManPrintProgress( p, 1, Abc_Clock() - clkStart );
+                p->pPars->iFrame = k;
+                if ( p->pPars->nFailOuts > 0 )
+                    return 0; // SAT
+                return p->pPars->nDropOuts ? -1 : 1;
+            }
+        }
         if ( p->pPars->fVerbose )
             Pdr_ManPrintProgress( p, 0, Abc_Clock() - clkStart );
 
@@ -900,14 +937,18 @@ int Pdr_ManSolve( Aig_Man_t * pAig, Pdr_Par_t * pPars )
             pPars->nFrameMax,
             pPars->nRestLimit,
             pPars->nTimeOut );
-        Abc_Print( 1, "MonoCNF = %s. SkipGen = %s. SolveAll = %s.\n",
+        Abc_Print( 1, "MonoCNF = %s. SkipGen = %s. SolveAll = %s. ProveEach = %s.\n",
             pPars->fMonoCnf ?     "yes" : "no",
             pPars->fSkipGeneral ? "yes" : "no",
-            pPars->fSolveAll ?    "yes" : "no" );
+            pPars->fSolveAll ?    "yes" : "no",
+            pPars->fProveEach ?   "yes" : "no" );
     }
     ABC_FREE( pAig->pSeqModel );
     p = Pdr_ManStart( pAig, pPars, NULL );
-    RetValue = Pdr_ManSolveInt( p );
+    if ( pPars->nProcs > 1 && Util_PoolIsParallel() && !pPars->fSolveAll && !pPars->nTimeOutGap && !pPars->nRestLimit && !pPars->fUseBridge )
+        RetValue = Pdr_ManSolvePth( p );
+    else
+        RetValue = Pdr_ManSolveInt( p );
     if ( RetValue == 0 )
         assert( pAig->pSeqModel != NULL || p->vCexes != NULL );
     if ( p->vCexes )
@@ -918,6 +959,8 @@ int Pdr_ManSolve( Aig_Man_t * pAig, Pdr_Par_t * pPars )
     }
     if ( p->pPars->fDumpInv )
         Pdr_ManDumpClauses( p, (char *)"inv.pla", RetValue==1 );
+    if ( p->pPars->pDumpFile )
+        Pdr_ManDumpFrames( p, p->pPars->pDumpFile, RetValue==1 );
     p->tTotal += Abc_Clock() - clk;
     Pdr_ManStop( p );
     pPars->iFrame--;
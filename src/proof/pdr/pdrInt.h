@@ -29,6 +29,7 @@
 #include "misc/vec/vecWec.h"
 #include "sat/cnf/cnf.h"
 #include "sat/bsat/satSolver.h"
+#include "misc/util/utilPth.h"
 #include "pdr.h" 
 
 ABC_NAMESPACE_HEADER_START
@@ -48,6 +49,7 @@ struct Pdr_Set_t_
     int         nRefs;     // ref counter
     int         nTotal;    // total literals
     int         nLits;     // num flop literals
+    int         iOut;      // the output, for which the clause was derived (-1 if none)
     int         Lits[0];
 };
 
@@ -72,6 +74,7 @@ struct Pdr_Man_t_
     Cnf_Man_t * pCnfMan;   // CNF manager
     Cnf_Dat_t * pCnf1;     // CNF for this AIG
     Vec_Int_t * vVar2Reg;  // mapping of SAT var into registers
+    Cnf_Dat_t * pCnfInd;   // CNF for checking inductive subsets of clauses
     // dynamic CNF representation
     Cnf_Dat_t * pCnf2;     // CNF for this AIG
     Vec_Int_t * pvId2Vars; // for each used ObjId, maps frame into SAT var
@@ -86,6 +89,7 @@ struct Pdr_Man_t_
     int *       pOrder;    // ordering of the lits
     Vec_Int_t * vActVars;  // the counter of activation variables
     int         iUseFrame; // the first used frame
+    Util_Lock_t * pLockDb; // lock of the clause database shared by the threads
     // internal use
     Vec_Int_t * vPrio;     // priority flops
     Vec_Int_t * vLits;     // array of literals
@@ -94,9 +98,11 @@ struct Pdr_Man_t_
     Vec_Int_t * vCiVals;   // cone leaf values
     Vec_Int_t * vCoVals;   // cone root values
     Vec_Int_t * vNodes;    // cone nodes
-    Vec_Int_t * vUndo;     // cone undos
     Vec_Int_t * vVisits;   // intermediate
     Vec_Int_t * vCi2Rem;   // CIs to be removed
+    Vec_Int_t * vCands;    // CIs to be tried for removal
+    Vec_Wrd_t * vCiXs;     // lanes, in which CIs are undefined
+    Saig_Tsw_t* pTsw;      // bit-sliced ternary simulator
     Vec_Int_t * vRes;      // final result
     Vec_Int_t * vSuppLits; // support literals
     Pdr_Set_t * pCubeJust; // justification
@@ -161,17 +167,24 @@ extern int             Pdr_ObjRegNum( Pdr_Man_t * p, int k, int iSatVar );
 extern int             Pdr_ManFreeVar( Pdr_Man_t * p, int k );
 extern sat_solver *    Pdr_ManNewSolver( sat_solver * pSat, Pdr_Man_t * p, int k, int fInit );
 /*=== pdrCore.c ==========================================================*/
+extern Pdr_Set_t *     Pdr_ManReduceClause( Pdr_Man_t * p, int k, Pdr_Set_t * pCube );
 extern int             Pdr_ManCheckContainment( Pdr_Man_t * p, int k, Pdr_Set_t * pSet );
+extern int             Pdr_ManGeneralize( Pdr_Man_t * p, int k, Pdr_Set_t * pCube, Pdr_Set_t ** ppPred, Pdr_Set_t ** ppCubeMin );
 /*=== pdrInv.c ==========================================================*/
 extern void            Pdr_ManPrintProgress( Pdr_Man_t * p, int fClose, abctime Time );
 extern void            Pdr_ManPrintClauses( Pdr_Man_t * p, int kStart );
 extern void            Pdr_ManDumpClauses( Pdr_Man_t * p, char * pFileName, int fProved );
 extern void            Pdr_ManReportInvariant( Pdr_Man_t * p );
 extern void            Pdr_ManVerifyInvariant( Pdr_Man_t * p );
+extern int             Pdr_ManProveOutputs( Pdr_Man_t * p, int kStart );
+extern void            Pdr_ManDumpFrames( Pdr_Man_t * p, char * pFileName, int fProved );
+extern Vec_Ptr_t *     Pdr_ManLoadFrames( Pdr_Man_t * p, char * pFileName );
 /*=== pdrMan.c ==========================================================*/
 extern Pdr_Man_t *     Pdr_ManStart( Aig_Man_t * pAig, Pdr_Par_t * pPars, Vec_Int_t * vPrioInit );
 extern void            Pdr_ManStop( Pdr_Man_t * p );
 extern Abc_Cex_t *     Pdr_ManDeriveCex( Pdr_Man_t * p );
+/*=== pdrPth.c ==========================================================*/
+extern int             Pdr_ManSolvePth( Pdr_Man_t * p );
 /*=== pdrSat.c ==========================================================*/
 extern sat_solver *    Pdr_ManCreateSolver( Pdr_Man_t * p, int k );
 extern sat_solver *    Pdr_ManFetchSolver( Pdr_Man_t * p, int k );
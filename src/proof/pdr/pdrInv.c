@@ -22,6 +22,7 @@
 #include "base/abc/abc.h"      // for Abc_NtkCollectCioNames()
 #include "base/main/main.h"    // for Abc_FrameReadGlobalFrame()
 #include "aig/ioa/ioa.h"
+#include "misc/util/utilNam.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -30,6 +31,8 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+extern int Gia_ManToBridgeResult( FILE * pFile, int Result, Abc_Cex_t * pCex, int iPoProved );
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -449,6 +452,415 @@ void Pdr_ManVerifyInvariant( Pdr_Man_t * p )
     Vec_PtrFree( vCubes );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Finds the largest subset of clauses that is inductive.]
+
+  Description [Iteratively drops the clauses that are not inductive relative
+  to the remaining ones. The remaining clauses form an inductive invariant,
+  which does not depend on the property constraints used when the clauses 
+  were derived. The clauses should not be satisfied by the initial state.
+  Returns the SAT solver, in which clause i is enabled by activation literal 
+  i in vActs, or NULL if the solver cannot be created. The literals of the
+  dropped clauses are complemented. Sets the number of remaining clauses.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static sat_solver * Pdr_ManInductiveSubset( Pdr_Man_t * p, Vec_Ptr_t * vCubes, Vec_Int_t * vActs, int * pnAlive )
+{
+    sat_solver * pSat;
+    Vec_Int_t * vLits;
+    Pdr_Set_t * pCube, * pTemp;
+    Aig_Obj_t * pObj;
+    int i, j, n, Lit, iVar, RetValue, fChange, nAlive;
+    // derive CNF with variables for the register inputs and outputs
+    if ( p->pCnfInd == NULL )
+    {
+        int nRegs = p->pAig->nRegs;
+        p->pAig->nRegs = Aig_ManCoNum(p->pAig);
+        p->pCnfInd = Cnf_DeriveWithMan( p->pCnfMan, p->pAig, Aig_ManCoNum(p->pAig) );
+        p->pAig->nRegs = nRegs;
+    }
+    pSat = (sat_solver *)Cnf_DataWriteIntoSolver( p->pCnfInd, 1, 0 );
+    if ( pSat == NULL )
+        return NULL;
+    sat_solver_set_runtime_limit( pSat, p->timeToStop );
+    // add the clauses in terms of register outputs controlled by activation variables
+    vLits = Vec_IntAlloc( 100 );
+    Vec_IntClear( vActs );
+    Vec_PtrForEachEntry( Pdr_Set_t *, vCubes, pCube, i )
+    {
+        assert( !Pdr_SetIsInit(pCube, -1) );
+        iVar = sat_solver_nvars( pSat );
+        sat_solver_setnvars( pSat, iVar + 1 );
+        Vec_IntPush( vActs, toLit(iVar) );
+        Vec_IntClear( vLits );
+        Vec_IntPush( vLits, toLitCond(iVar, 1) );
+        for ( n = 0; n < pCube->nLits; n++ )
+        {
+            pObj = Saig_ManLo( p->pAig, lit_var(pCube->Lits[n]) );
+            Vec_IntPush( vLits, toLitCond(p->pCnfInd->pVarNums[Aig_ObjId(pObj)], !lit_sign(pCube->Lits[n])) );
+        }
+        RetValue = sat_solver_addclause( pSat, Vec_IntArray(vLits), Vec_IntLimit(vLits) );
+        assert( RetValue );
+    }
+    // remove the clauses, which do not hold in the next state
+    nAlive = Vec_PtrSize(vCubes);
+    do {
+        fChange = 0;
+        Vec_PtrForEachEntry( Pdr_Set_t *, vCubes, pCube, i )
+        {
+            if ( lit_sign(Vec_IntEntry(vActs, i)) )
+                continue;
+            Vec_IntClear( vLits );
+            Vec_IntForEachEntry( vActs, Lit, j )
+                if ( !lit_sign(Lit) )
+                    Vec_IntPush( vLits, Lit );
+            for ( n = 0; n < pCube->nLits; n++ )
+            {
+                pObj = Saig_ManLi( p->pAig, lit_var(pCube->Lits[n]) );
+                Vec_IntPush( vLits, toLitCond(p->pCnfInd->pVarNums[Aig_ObjId(pObj)], lit_sign(pCube->Lits[n])) );
+            }
+            RetValue = sat_solver_solve( pSat, Vec_IntArray(vLits), Vec_IntLimit(vLits), (ABC_INT64_T)p->pPars->nConfLimit, 0, 0, 0 );
+            if ( RetValue == l_False )
+                continue;
+            // drop this clause and other clauses failing in the next state
+            Vec_PtrForEachEntry( Pdr_Set_t *, vCubes, pTemp, j )
+            {
+                if ( lit_sign(Vec_IntEntry(vActs, j)) )
+                    continue;
+                if ( j != i )
+                {
+                    if ( RetValue != l_True )
+                        continue;
+                    for ( n = 0; n < pTemp->nLits; n++ )
+                    {
+                        pObj = Saig_ManLi( p->pAig, lit_var(pTemp->Lits[n]) );
+                        if ( sat_solver_var_value(pSat, p->pCnfInd->pVarNums[Aig_ObjId(pObj)]) == lit_sign(pTemp->Lits[n]) )
+                            break;
+                    }
+                    if ( n < pTemp->nLits ) // the clause holds in the next state
+                        continue;
+                }
+                Vec_IntWriteEntry( vActs, j, Abc_LitNot(Vec_IntEntry(vActs, j)) );
+                nAlive--;
+            }
+            fChange = 1;
+        }
+    } while ( fChange );
+    Vec_IntFree( vLits );
+    *pnAlive = nAlive;
+    return pSat;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Proves individual outputs using inductive subset of clauses.]
+
+  Description [Collects the clauses of frames starting from kStart and
+  finds their largest inductive subset. The undecided outputs implied by 
+  this subset are marked as proved in the output map. Returns the number 
+  of outputs proved.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManProveOutputs( Pdr_Man_t * p, int kStart )
+{
+    sat_solver * pSat;
+    Vec_Ptr_t * vCubes;
+    Vec_Int_t * vActs, * vLits, * vTags;
+    Pdr_Set_t * pCube;
+    Aig_Obj_t * pObj;
+    int i, j, Lit, RetValue, nAlive, nProved = 0;
+    int nOutDigits = Abc_Base10Log( Saig_ManPoNum(p->pAig) );
+    abctime clk = Abc_Clock();
+    assert( p->pPars->fSolveAll && p->pPars->vOutMap );
+    vCubes = Pdr_ManCollectCubes( p, kStart );
+    // skip clauses that are not valid in the initial state
+    j = 0;
+    Vec_PtrForEachEntry( Pdr_Set_t *, vCubes, pCube, i )
+        if ( !Pdr_SetIsInit(pCube, -1) )
+            Vec_PtrWriteEntry( vCubes, j++, pCube );
+    Vec_PtrShrink( vCubes, j );
+    vActs = Vec_IntAlloc( Vec_PtrSize(vCubes) );
+    pSat = Pdr_ManInductiveSubset( p, vCubes, vActs, &nAlive );
+    if ( pSat == NULL )
+    {
+        Vec_IntFree( vActs );
+        Vec_PtrFree( vCubes );
+        return 0;
+    }
+    // check the undecided outputs against the inductive subset
+    vLits = Vec_IntAlloc( nAlive + 1 );
+    Vec_IntForEachEntry( vActs, Lit, j )
+        if ( !lit_sign(Lit) )
+            Vec_IntPush( vLits, Lit );
+    Saig_ManForEachPo( p->pAig, pObj, i )
+    {
+        if ( Vec_IntEntry(p->pPars->vOutMap, i) != -2 )
+            continue;
+        if ( p->vCexes && Vec_PtrEntry(p->vCexes, i) )
+            continue;
+        Vec_IntPush( vLits, toLit(p->pCnfInd->pVarNums[Aig_ObjId(pObj)]) );
+        RetValue = sat_solver_solve( pSat, Vec_IntArray(vLits), Vec_IntLimit(vLits), (ABC_INT64_T)p->pPars->nConfLimit, 0, 0, 0 );
+        Vec_IntPop( vLits );
+        if ( RetValue != l_False )
+            continue;
+        Vec_IntWriteEntry( p->pPars->vOutMap, i, 1 ); // unsat
+        p->pPars->nProveOuts++;
+        nProved++;
+        if ( p->pPars->fUseBridge )
+            Gia_ManToBridgeResult( stdout, 1, NULL, i );
+        if ( !p->pPars->fNotVerbose )
+            Abc_Print( 1, "Output %*d was proved in frame %2d (solved %*d out of %*d outputs).\n",
+                nOutDigits, i, Vec_PtrSize(p->vSolvers)-1, nOutDigits, p->pPars->nFailOuts + p->pPars->nProveOuts, nOutDigits, Saig_ManPoNum(p->pAig) );
+    }
+    if ( p->pPars->fVerbose )
+    {
+        // count the outputs, for which the clauses of the inductive subset were derived
+        vTags = Vec_IntStart( Saig_ManPoNum(p->pAig) + 1 );
+        Vec_PtrForEachEntry( Pdr_Set_t *, vCubes, pCube, i )
+            if ( !lit_sign(Vec_IntEntry(vActs, i)) )
+                Vec_IntWriteEntry( vTags, pCube->iOut + 1, 1 );
+        Abc_Print( 1, "Inductive subset of F[%d] : %d clauses (out of %d) derived for %d outputs. Proved %d outputs.  ", 
+            kStart, nAlive, Vec_PtrSize(vCubes), Vec_IntSum(vTags) - Vec_IntEntry(vTags, 0), nProved );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+        Vec_IntFree( vTags );
+    }
+    sat_solver_delete( pSat );
+    Vec_IntFree( vActs );
+    Vec_IntFree( vLits );
+    Vec_PtrFree( vCubes );
+    return nProved;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the names of flops if they match the AIG.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char ** Pdr_ManCollectFlopNames( Pdr_Man_t * p )
+{
+    Abc_Ntk_t * pNtk = Abc_FrameReadNtk( Abc_FrameReadGlobalFrame() );
+    if ( pNtk == NULL || Abc_NtkPiNum(pNtk) != Saig_ManPiNum(p->pAig) || Abc_NtkLatchNum(pNtk) != Aig_ManRegNum(p->pAig) )
+        return NULL;
+    return Abc_NtkCollectCioNames( pNtk, 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the clauses of all timeframes into a file.]
+
+  Description [Each clause is written on a separate line starting with 
+  the last frame, in which it holds, followed by the literals in terms 
+  of 1-based flop numbers (negative when the flop is 0) and ending with 0.
+  If flop names are available, they are listed after ".n" and used to map 
+  the clauses when the design changes.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManDumpFrames( Pdr_Man_t * p, char * pFileName, int fProved )
+{
+    FILE * pFile;
+    Vec_Ptr_t * vArrayK;
+    Pdr_Set_t * pCube;
+    char ** pNamesCi;
+    int i, k, n, nCubes = 0, kStart = fProved ? Pdr_ManFindInvariantStart(p) : 0;
+    pFile = fopen( pFileName, "w" );
+    if ( pFile == NULL )
+    {
+        Abc_Print( 1, "Cannot open file \"%s\" for writing clauses.\n", pFileName );
+        return;
+    }
+    Vec_VecForEachLevelStart( p->vClauses, vArrayK, k, 1 )
+        nCubes += Vec_PtrSize(vArrayK);
+    fprintf( pFile, "# Clauses of PDR timeframes for \"%s\"\n", p->pAig->pName );
+    fprintf( pFile, "# generated by PDR in ABC on %s\n", Aig_TimeStamp() );
+    fprintf( pFile, ".r %d\n", Aig_ManRegNum(p->pAig) );
+    fprintf( pFile, ".k %d\n", kStart );
+    fprintf( pFile, ".c %d\n", nCubes );
+    pNamesCi = Pdr_ManCollectFlopNames( p );
+    if ( pNamesCi )
+    {
+        fprintf( pFile, ".n" );
+        for ( i = 0; i < Aig_ManRegNum(p->pAig); i++ )
+            fprintf( pFile, " %s", pNamesCi[Saig_ManPiNum(p->pAig) + i] );
+        fprintf( pFile, "\n" );
+        ABC_FREE( pNamesCi );
+    }
+    Vec_VecForEachLevelStart( p->vClauses, vArrayK, k, 1 )
+        Vec_PtrForEachEntry( Pdr_Set_t *, vArrayK, pCube, i )
+        {
+            fprintf( pFile, "%d", k );
+            for ( n = 0; n < pCube->nLits; n++ )
+                if ( pCube->Lits[n] != -1 )
+                    fprintf( pFile, " %d", lit_sign(pCube->Lits[n]) ? lit_var(pCube->Lits[n]) + 1 : -lit_var(pCube->Lits[n]) - 1 );
+            fprintf( pFile, " 0\n" );
+        }
+    fprintf( pFile, ".e\n" );
+    fclose( pFile );
+    Abc_Print( 1, "Clauses of %d timeframes were written into file \"%s\".\n", Vec_VecSize(p->vClauses)-1, pFileName );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the clauses of all timeframes from a file.]
+
+  Description [Maps the clauses into the current AIG using flop names
+  (if present) or flop numbers. Skips the clauses that refer to unknown 
+  flops or are satisfied by the initial state and returns the remaining
+  ones. Returns NULL if the file cannot be read.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Vec_Ptr_t * Pdr_ManReadFrames( Pdr_Man_t * p, char * pFileName )
+{
+    Vec_Ptr_t * vCubes;
+    Vec_Int_t * vMap = NULL, * vLits, * vTemp;
+    Abc_Nam_t * pNames = NULL;
+    char ** pNamesCi;
+    char * pContents, * pToken, * pSeps = " \t\r\n";
+    int i, Lit, iFlop, nRegs = -1, fSkip = 0;
+    pContents = Extra_FileReadContents( pFileName );
+    if ( pContents == NULL )
+    {
+        Abc_Print( 1, "Cannot open file \"%s\" with clauses.\n", pFileName );
+        return NULL;
+    }
+    // remove the comments
+    for ( pToken = pContents; *pToken; pToken++ )
+        if ( *pToken == '#' )
+            while ( *pToken && *pToken != '\n' )
+                *pToken++ = ' ';
+    vCubes = Vec_PtrAlloc( 100 );
+    vLits  = Vec_IntAlloc( 100 );
+    vTemp  = Vec_IntAlloc( 0 );
+    for ( pToken = strtok(pContents, pSeps); pToken; pToken = strtok(NULL, pSeps) )
+    {
+        if ( !strcmp(pToken, ".r") )
+            nRegs = (pToken = strtok(NULL, pSeps)) ? atoi(pToken) : -1;
+        else if ( !strcmp(pToken, ".k") || !strcmp(pToken, ".c") )
+            strtok( NULL, pSeps );
+        else if ( !strcmp(pToken, ".n") )
+        {
+            if ( nRegs < 0 )
+                break;
+            // map the flops by name
+            pNamesCi = Pdr_ManCollectFlopNames( p );
+            if ( pNamesCi )
+            {
+                pNames = Abc_NamStart( Aig_ManRegNum(p->pAig), 20 );
+                for ( i = 0; i < Aig_ManRegNum(p->pAig); i++ )
+                    Abc_NamStrFindOrAdd( pNames, pNamesCi[Saig_ManPiNum(p->pAig) + i], NULL );
+                ABC_FREE( pNamesCi );
+            }
+            vMap = Vec_IntStartFull( nRegs );
+            for ( i = 0; i < nRegs && (pToken = strtok(NULL, pSeps)); i++ )
+                Vec_IntWriteEntry( vMap, i, pNames ? Abc_NamStrFind(pNames, pToken) - 1 : -1 );
+        }
+        else if ( !strcmp(pToken, ".e") )
+            break;
+        else if ( nRegs < 0 )
+            break;
+        else
+        {
+            // the frame number is followed by the literals
+            if ( vMap == NULL )
+            {
+                if ( nRegs != Aig_ManRegNum(p->pAig) )
+                    break;
+                vMap = Vec_IntStartNatural( nRegs );
+            }
+            Vec_IntClear( vLits );
+            fSkip = 0;
+            while ( (pToken = strtok(NULL, pSeps)) && (Lit = atoi(pToken)) != 0 )
+            {
+                iFlop = Abc_AbsInt(Lit) - 1;
+                if ( iFlop >= nRegs || Vec_IntEntry(vMap, iFlop) == -1 )
+                    fSkip = 1;
+                else
+                    Vec_IntPush( vLits, Abc_Var2Lit(Vec_IntEntry(vMap, iFlop), Lit > 0) );
+            }
+            if ( fSkip || Vec_IntSize(vLits) == 0 )
+                continue;
+            Vec_PtrPush( vCubes, Pdr_SetCreate(vLits, vTemp) );
+            if ( Pdr_SetIsInit((Pdr_Set_t *)Vec_PtrEntryLast(vCubes), -1) )
+                Pdr_SetDeref( (Pdr_Set_t *)Vec_PtrPop(vCubes) );
+        }
+    }
+    if ( pNames )
+        Abc_NamStop( pNames );
+    Vec_IntFreeP( &vMap );
+    Vec_IntFree( vLits );
+    Vec_IntFree( vTemp );
+    ABC_FREE( pContents );
+    return vCubes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Loads the clauses of the previous run for warm-start.]
+
+  Description [Reads the clauses written by Pdr_ManDumpFrames() and keeps
+  those of them that are inductive relative to each other in the current 
+  AIG. These clauses hold in all reachable states and are returned to be
+  added to the first frame, from which they are pushed forward. Returns
+  NULL if the file cannot be read.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Ptr_t * Pdr_ManLoadFrames( Pdr_Man_t * p, char * pFileName )
+{
+    sat_solver * pSat;
+    Vec_Ptr_t * vCubes, * vRes;
+    Vec_Int_t * vActs;
+    Pdr_Set_t * pCube;
+    int i, nAlive = 0;
+    abctime clk = Abc_Clock();
+    vCubes = Pdr_ManReadFrames( p, pFileName );
+    if ( vCubes == NULL )
+        return NULL;
+    vActs = Vec_IntAlloc( Vec_PtrSize(vCubes) );
+    pSat = Pdr_ManInductiveSubset( p, vCubes, vActs, &nAlive );
+    vRes = Vec_PtrAlloc( nAlive );
+    Vec_PtrForEachEntry( Pdr_Set_t *, vCubes, pCube, i )
+        if ( pSat && !lit_sign(Vec_IntEntry(vActs, i)) )
+            Vec_PtrPush( vRes, pCube );
+        else
+            Pdr_SetDeref( pCube );
+    if ( pSat )
+        sat_solver_delete( pSat );
+    if ( !p->pPars->fSilent )
+    {
+        Abc_Print( 1, "Warm-start: Kept %d inductive clauses (out of %d) from file \"%s\".  ", Vec_PtrSize(vRes), Vec_PtrSize(vCubes), pFileName );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    Vec_IntFree( vActs );
+    Vec_PtrFree( vCubes );
+    return vRes;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
@@ -63,18 +63,18 @@ Pdr_Man_t * Pdr_ManStart( Aig_Man_t * pAig, Pdr_Par_t * pPars, Vec_Int_t * vPrio
     p->vCiVals  = Vec_IntAlloc( 100 );  // cone leaf values
     p->vCoVals  = Vec_IntAlloc( 100 );  // cone root values
     p->vNodes   = Vec_IntAlloc( 100 );  // cone nodes
-    p->vUndo    = Vec_IntAlloc( 100 );  // cone undos
     p->vVisits  = Vec_IntAlloc( 100 );  // intermediate
     p->vCi2Rem  = Vec_IntAlloc( 100 );  // CIs to be removed
+    p->vCands   = Vec_IntAlloc( 100 );  // CIs to be tried for removal
+    p->vCiXs    = Vec_WrdAlloc( 100 );  // lanes, in which CIs are undefined
     p->vRes     = Vec_IntAlloc( 100 );  // final result
     p->vSuppLits= Vec_IntAlloc( 100 );  // support literals
     p->pCubeJust= Pdr_SetAlloc( Saig_ManRegNum(pAig) );
     p->pCnfMan  = Cnf_ManStart();
     // additional AIG data-members
-    if ( pAig->pFanData == NULL )
-        Aig_ManFanoutStart( pAig );
     if ( pAig->pTerSimData == NULL )
         pAig->pTerSimData = ABC_CALLOC( unsigned, 1 + (Aig_ManObjNumMax(pAig) / 16) );
+    p->pTsw = Saig_TswStart( pAig, 4 );
     // time spent on each outputs
     if ( pPars->nTimeOutOne )
     {
@@ -137,6 +137,7 @@ void Pdr_ManStop( Pdr_Man_t * p )
     // static CNF
     Cnf_DataFree( p->pCnf1 );
     Vec_IntFreeP( &p->vVar2Reg );
+    Cnf_DataFree( p->pCnfInd );
     // dynamic CNF
     Cnf_DataFree( p->pCnf2 );
     if ( p->pvId2Vars )
@@ -158,9 +159,10 @@ void Pdr_ManStop( Pdr_Man_t * p )
     Vec_IntFree( p->vCiVals   );  // cone leaf values
     Vec_IntFree( p->vCoVals   );  // cone root values
     Vec_IntFree( p->vNodes    );  // cone nodes
-    Vec_IntFree( p->vUndo     );  // cone undos
     Vec_IntFree( p->vVisits   );  // intermediate
     Vec_IntFree( p->vCi2Rem   );  // CIs to be removed
+    Vec_IntFree( p->vCands    );  // CIs to be tried for removal
+    Vec_WrdFree( p->vCiXs     );  // lanes, in which CIs are undefined
     Vec_IntFree( p->vRes      );  // final result
     Vec_IntFree( p->vSuppLits );  // support literals
     ABC_FREE( p->pCubeJust );
@@ -168,10 +170,9 @@ void Pdr_ManStop( Pdr_Man_t * p )
     if ( p->vCexes )
         Vec_PtrFreeFree( p->vCexes );
     // additional AIG data-members
-    if ( p->pAig->pFanData != NULL )
-        Aig_ManFanoutStop( p->pAig );
     if ( p->pAig->pTerSimData != NULL )
         ABC_FREE( p->pAig->pTerSimData );
+    Saig_TswStop( p->pTsw );
     ABC_FREE( p );
 }
 
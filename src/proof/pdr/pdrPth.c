@@ -0,0 +1,842 @@
+/**CFile****************************************************************
+
+  FileName    [pdrPth.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Property driven reachability.]
+
+  Synopsis    [Multi-threaded PDR with the shared clause database.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - November 20, 2010.]
+
+  Revision    [$Id: pdrPth.c,v 1.00 2010/11/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "pdrInt.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// Each thread owns a PDR manager with a private copy of the AIG, its own
+// CNF and its own SAT solvers for every timeframe. The clauses by timeframe
+// (vClauses of the main manager) and the proof-obligation queue (pQueue of
+// the main manager) are shared. A clause added by one thread is appended
+// to the log, from which the other threads load it into their solvers
+// before processing the next proof obligation. A clause learned using
+// fewer clauses than the database has is still valid for the database,
+// so the threads never wait for each other, except between the rounds.
+
+typedef struct Pdr_Pth_t_ Pdr_Pth_t;
+struct Pdr_Pth_t_
+{
+    Pdr_Man_t *      pMan;          // the main manager (owns the clauses and the queue)
+    Pdr_Man_t *      pMans[UTIL_PROC_MAX]; // the managers of the threads (pMans[0] == pMan)
+    Util_Pool_t *    pPool;         // the pool of threads
+    int              nProcs;        // the number of threads
+    int              kMax;          // the last timeframe
+    int              Prio;          // the priority of the next proof obligation
+    abctime          timeToStop;    // the wall-clock timeout
+    // shared clauses
+    Util_Lock_t *    pLockDb;       // the lock of the clauses and the log
+    Vec_Ptr_t *      vLog;          // clauses in the order of their addition
+    Vec_Int_t *      vLogData;      // the first/last frame and the thread for each clause
+    int              iLogs[UTIL_PROC_MAX]; // the number of log entries seen by each thread
+    // shared proof obligations
+    Util_Lock_t *    pLockQue;      // the lock of the queue
+    volatile int     nBusy;         // the number of obligations being processed
+    volatile int     Status;        // -2 = running; 0 = CEX found; -1 = resource limit
+    volatile int     fStop;         // the flag to interrupt the SAT solvers
+    Pdr_Obl_t *      pCexObl;       // the obligation reaching the initial state
+    // clause pushing
+    int              kPush;         // the frame whose clauses are pushed
+    Vec_Ptr_t *      vPushCubes;    // the clauses to push
+    Vec_Ptr_t *      vPushRes;      // the pushed clauses (or NULL)
+    volatile int     iPushNext;     // the next clause to push
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Records the outcome and interrupts the other threads.]
+
+  Description [Only the first outcome is recorded.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Pdr_PthSetStatus( Pdr_Pth_t * p, int Status )
+{
+    if ( !Util_AtomicCas(&p->Status, -2, Status) )
+        return 0;
+    Util_AtomicWrite( &p->fStop, 1 );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Creates the managers of the threads.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Pdr_Pth_t * Pdr_PthStart( Pdr_Man_t * pMan )
+{
+    Pdr_Pth_t * p;
+    Pdr_Par_t * pPars;
+    int i;
+    p = ABC_CALLOC( Pdr_Pth_t, 1 );
+    p->pMan       = pMan;
+    p->nProcs     = Abc_MinInt( pMan->pPars->nProcs, UTIL_PROC_MAX );
+    p->timeToStop = pMan->pPars->nTimeOut ? Util_WallClock() + (abctime)pMan->pPars->nTimeOut * CLOCKS_PER_SEC : 0;
+    p->Status     = -2;
+    p->vLog       = Vec_PtrAlloc( 1000 );
+    p->vLogData   = Vec_IntAlloc( 3000 );
+    p->vPushCubes = Vec_PtrAlloc( 1000 );
+    p->vPushRes   = Vec_PtrAlloc( 1000 );
+    p->pLockDb    = Util_LockStart();
+    p->pLockQue   = Util_LockStart();
+    p->pMans[0]   = pMan;
+    pMan->pLockDb = p->pLockDb;
+    for ( i = 1; i < p->nProcs; i++ )
+    {
+        pPars = ABC_ALLOC( Pdr_Par_t, 1 );
+        memcpy( pPars, pMan->pPars, sizeof(Pdr_Par_t) );
+        pPars->fVerbose     = 0;
+        pPars->fVeryVerbose = 0;
+        pPars->fDumpInv     = 0;
+        pPars->pFuncStop    = NULL;
+        pPars->vOutMap      = NULL;
+        p->pMans[i] = Pdr_ManStart( Aig_ManDupSimple(pMan->pAig), pPars, NULL );
+        // share the clauses of the main manager
+        Vec_VecFree( p->pMans[i]->vClauses );
+        p->pMans[i]->vClauses = pMan->vClauses;
+        p->pMans[i]->pLockDb  = p->pLockDb;
+    }
+    p->pPool = Util_PoolStart( p->nProcs );
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Deletes the managers of the threads.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_PthStop( Pdr_Pth_t * p )
+{
+    Pdr_Man_t * pMan;
+    Pdr_Par_t * pPars;
+    Aig_Man_t * pAig;
+    Pdr_Set_t * pCube;
+    int i;
+    Util_PoolStop( p->pPool );
+    for ( i = 1; i < p->nProcs; i++ )
+    {
+        pMan = p->pMans[i];
+        p->pMan->nCubes  += pMan->nCubes;
+        p->pMan->nCalls  += pMan->nCalls;
+        p->pMan->nCallsS += pMan->nCallsS;
+        p->pMan->nCallsU += pMan->nCallsU;
+        p->pMan->nStarts += pMan->nStarts;
+        pMan->vClauses = Vec_VecAlloc( 0 );
+        pPars = pMan->pPars;
+        pAig  = pMan->pAig;
+        Pdr_ManStop( pMan );
+        Aig_ManStop( pAig );
+        ABC_FREE( pPars );
+    }
+    // restore the sequential solvers of the main manager
+    for ( i = 0; i < Vec_PtrSize(p->pMan->vSolvers); i++ )
+        ((sat_solver *)Vec_PtrEntry(p->pMan->vSolvers, i))->pStop = NULL;
+    p->pMan->pLockDb = NULL;
+    Vec_PtrForEachEntry( Pdr_Set_t *, p->vLog, pCube, i )
+        Pdr_SetDeref( pCube );
+    Vec_PtrFree( p->vLog );
+    Vec_IntFree( p->vLogData );
+    Vec_PtrFree( p->vPushCubes );
+    Vec_PtrFree( p->vPushRes );
+    Util_LockStop( p->pLockDb );
+    Util_LockStop( p->pLockQue );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Creates the SAT solvers of all threads for the new timeframe.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_PthCreateSolvers( Pdr_Pth_t * p, int k )
+{
+    Pdr_Man_t * pMan;
+    sat_solver * pSat;
+    Aig_Obj_t * pObj;
+    int i, j;
+    for ( i = 0; i < p->nProcs; i++ )
+    {
+        pMan = p->pMans[i];
+        if ( i == 0 )
+            pSat = Pdr_ManCreateSolver( pMan, k );
+        else
+        {
+            // the shared clauses are already expanded by the main manager
+            assert( Vec_PtrSize(pMan->vSolvers) == k );
+            pSat = sat_solver_new();
+            sat_solver_set_lbd_mode( pSat, pMan->pPars->fLbdMode );
+            pSat = Pdr_ManNewSolver( pSat, pMan, k, (int)(k == 0) );
+            Vec_PtrPush( pMan->vSolvers, pSat );
+            Vec_IntPush( pMan->vActVars, 0 );
+            Saig_ManForEachPo( pMan->pAig, pObj, j )
+                Pdr_ObjSatVar( pMan, k, 1, pObj );
+        }
+        pSat->pStop = &p->fStop;
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the clause to the shared database.]
+
+  Description [The clause is added to frames iStart to iStop of all threads
+  except iThread. Consumes the reference if fConsume is set.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_PthAddClause( Pdr_Pth_t * p, int iThread, int iStart, int iStop, Pdr_Set_t * pCube, int fConsume )
+{
+    Util_LockWrite( p->pLockDb );
+    if ( fConsume )
+        Vec_VecPush( p->pMan->vClauses, iStop, pCube );
+    Vec_PtrPush( p->vLog, Pdr_SetRef(pCube) );
+    Vec_IntPush( p->vLogData, iStart );
+    Vec_IntPush( p->vLogData, iStop );
+    Vec_IntPush( p->vLogData, iThread );
+    Util_LockUnlock( p->pLockDb );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Loads the clauses added by other threads into the solvers.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_PthSyncClauses( Pdr_Pth_t * p, int iThread )
+{
+    Pdr_Man_t * pMan = p->pMans[iThread];
+    Pdr_Set_t * pCube;
+    int i, k, iStart, iStop;
+    Util_LockRead( p->pLockDb );
+    for ( i = p->iLogs[iThread]; i < Vec_PtrSize(p->vLog); i++ )
+    {
+        if ( Vec_IntEntry(p->vLogData, 3*i+2) == iThread )
+            continue;
+        pCube  = (Pdr_Set_t *)Vec_PtrEntry( p->vLog, i );
+        iStart = Vec_IntEntry( p->vLogData, 3*i+0 );
+        iStop  = Abc_MinInt( Vec_IntEntry(p->vLogData, 3*i+1), Vec_PtrSize(pMan->vSolvers)-1 );
+        for ( k = iStart; k <= iStop; k++ )
+            Pdr_ManSolverAddClause( pMan, k, pCube );
+    }
+    p->iLogs[iThread] = Vec_PtrSize(p->vLog);
+    Util_LockUnlock( p->pLockDb );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Clears the log after all threads have seen it.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_PthCleanLog( Pdr_Pth_t * p )
+{
+    Pdr_Set_t * pCube;
+    int i;
+    for ( i = 0; i < p->nProcs; i++ )
+        if ( p->iLogs[i] < Vec_PtrSize(p->vLog) )
+            return;
+    Vec_PtrForEachEntry( Pdr_Set_t *, p->vLog, pCube, i )
+        Pdr_SetDeref( pCube );
+    Vec_PtrClear( p->vLog );
+    Vec_IntClear( p->vLogData );
+    for ( i = 0; i < p->nProcs; i++ )
+        p->iLogs[i] = 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the obligation to the shared queue.]
+
+  Description [Pushes pThis (and the new obligation for the predecessor
+  pPred, if given) into the queue, or releases pThis if fRelease is set.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_PthReturnObl( Pdr_Pth_t * p, Pdr_Obl_t * pThis, Pdr_Set_t * pPred, int fRelease )
+{
+    Util_LockWrite( p->pLockQue );
+    if ( fRelease )
+        Pdr_OblDeref( pThis );
+    else
+    {
+        pThis->prio = p->Prio--;
+        Pdr_QueuePush( p->pMan, pThis );
+        if ( pPred )
+        {
+            pThis = Pdr_OblStart( pThis->iFrame-1, p->Prio--, pPred, Pdr_OblRef(pThis) );
+            Pdr_QueuePush( p->pMan, pThis );
+        }
+    }
+    p->nBusy--;
+    Util_LockUnlock( p->pLockQue );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Processes one proof obligation.]
+
+  Description [Mirrors one iteration of Pdr_ManBlockCube().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_PthBlockOne( Pdr_Pth_t * p, int iThread, Pdr_Obl_t * pThis )
+{
+    Pdr_Man_t * pMan = p->pMans[iThread];
+    Pdr_Set_t * pPred, * pCubeMin;
+    int i, k, RetValue, kMax = p->kMax;
+    abctime clk;
+    assert( pThis->iFrame > 0 );
+    assert( !Pdr_SetIsInit(pThis->pState, -1) );
+    Pdr_PthSyncClauses( p, iThread );
+    pMan->iUseFrame = Abc_MinInt( pMan->iUseFrame, pThis->iFrame );
+    clk = Abc_Clock();
+    RetValue = Pdr_ManCheckContainment( pMan, pThis->iFrame, pThis->pState );
+    pMan->tContain += Abc_Clock() - clk;
+    if ( RetValue )
+    {
+        Pdr_PthReturnObl( p, pThis, NULL, 1 );
+        return 1;
+    }
+    // check if the cube is already contained
+    RetValue = Pdr_ManCheckCubeCs( pMan, pThis->iFrame, pThis->pState );
+    if ( RetValue ) // blocked by clauses in this frame or resource limit
+    {
+        Pdr_PthReturnObl( p, pThis, NULL, 1 );
+        return RetValue;
+    }
+    // check if the cube holds with relative induction
+    pCubeMin = NULL;
+    RetValue = Pdr_ManGeneralize( pMan, pThis->iFrame-1, pThis->pState, &pPred, &pCubeMin );
+    if ( RetValue == -1 ) // resource limit is reached
+    {
+        Pdr_PthReturnObl( p, pThis, NULL, 1 );
+        return -1;
+    }
+    if ( RetValue == 0 ) // the predecessor is found
+    {
+        assert( pCubeMin == NULL );
+        assert( pPred != NULL );
+        Pdr_PthReturnObl( p, pThis, pPred, 0 );
+        return 1;
+    }
+    // k is the last frame where pCubeMin holds
+    assert( pCubeMin != NULL );
+    assert( pPred == NULL );
+    for ( k = pThis->iFrame; k < kMax; k++ )
+    {
+        RetValue = Pdr_ManCheckCube( pMan, k, pCubeMin, NULL, 0 );
+        if ( RetValue == -1 )
+        {
+            Pdr_SetDeref( pCubeMin );
+            Pdr_PthReturnObl( p, pThis, NULL, 1 );
+            return -1;
+        }
+        if ( !RetValue )
+            break;
+    }
+    // set priority flops
+    for ( i = 0; i < pCubeMin->nLits; i++ )
+    {
+        assert( pCubeMin->Lits[i] >= 0 );
+        assert( (pCubeMin->Lits[i] / 2) < Aig_ManRegNum(pMan->pAig) );
+        Vec_IntAddToEntry( pMan->vPrio, pCubeMin->Lits[i] / 2, 1 );
+    }
+    // add new clause to the database and to the solvers of this thread
+    Pdr_PthAddClause( p, iThread, 1, k, pCubeMin, 1 ); // consume ref
+    pMan->nCubes++;
+    for ( i = 1; i <= k; i++ )
+        Pdr_ManSolverAddClause( pMan, i, pCubeMin );
+    // schedule proof obligation
+    if ( (k < kMax || pMan->pPars->fReuseProofOblig) && !pMan->pPars->fShortest )
+    {
+        pThis->iFrame = k+1;
+        Pdr_PthReturnObl( p, pThis, NULL, 0 );
+    }
+    else
+        Pdr_PthReturnObl( p, pThis, NULL, 1 );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Processes proof obligations from the shared queue.]
+
+  Description [Quits when the queue has no obligations for the current
+  timeframes and no other thread is processing one, or when a thread
+  has reached the initial state or a resource limit.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_PthBlockThread( void * pUser, int iThread )
+{
+    Pdr_Pth_t * p = (Pdr_Pth_t *)pUser;
+    Pdr_Man_t * pMan = p->pMans[iThread];
+    Pdr_Obl_t * pThis;
+    int nBusy;
+    while ( Util_AtomicRead(&p->Status) == -2 )
+    {
+        // check termination
+        if ( p->timeToStop && Util_WallClock() > p->timeToStop )
+        {
+            Pdr_PthSetStatus( p, -1 );
+            break;
+        }
+        if ( iThread == 0 && pMan->pPars->pFuncStop && pMan->pPars->pFuncStop(pMan->pPars->RunId) )
+        {
+            Pdr_PthSetStatus( p, -1 );
+            break;
+        }
+        // get the next obligation
+        Util_LockWrite( p->pLockQue );
+        pThis = Pdr_QueueHead( p->pMan );
+        if ( pThis == NULL || pThis->iFrame > p->kMax )
+        {
+            nBusy = p->nBusy;
+            Util_LockUnlock( p->pLockQue );
+            if ( nBusy == 0 ) // finished this level
+                break;
+            Util_ThreadSleep( 1000 );
+            continue;
+        }
+        if ( pThis->iFrame == 0 ) // SAT
+        {
+            if ( Pdr_PthSetStatus( p, 0 ) )
+                p->pCexObl = Pdr_OblRef( pThis );
+            Util_LockUnlock( p->pLockQue );
+            break;
+        }
+        pThis = Pdr_QueuePop( p->pMan );
+        p->nBusy++;
+        Util_LockUnlock( p->pLockQue );
+        // process it
+        if ( Pdr_PthBlockOne( p, iThread, pThis ) == -1 )
+            Pdr_PthSetStatus( p, -1 );
+    }
+    Pdr_PthSyncClauses( p, iThread );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Blocks the bad state using all threads.]
+
+  Description [Returns 1 if the state is blocked, 0 if the counter-example
+  is found (its obligation is in p->pCexObl), -1 if a resource limit is
+  reached.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_PthBlockCube( Pdr_Pth_t * p, Pdr_Set_t * pCube )
+{
+    p->pMan->nBlocks++;
+    p->kMax = Vec_PtrSize(p->pMan->vSolvers)-1;
+    p->Prio = ABC_INFINITY;
+    // create first proof obligation
+    Pdr_QueuePush( p->pMan, Pdr_OblStart( p->kMax, p->Prio--, pCube, NULL ) ); // consume ref
+    Util_PoolRun( p->pPool, Pdr_PthBlockThread, p );
+    Pdr_PthCleanLog( p );
+    return p->Status == -2 ? 1 : p->Status;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Tries to push the clauses of one frame.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_PthPushThread( void * pUser, int iThread )
+{
+    Pdr_Pth_t * p = (Pdr_Pth_t *)pUser;
+    Pdr_Man_t * pMan = p->pMans[iThread];
+    Pdr_Set_t * pCube, * pCubeMin;
+    int i, RetValue;
+    Pdr_PthSyncClauses( p, iThread );
+    while ( Util_AtomicRead(&p->Status) == -2 )
+    {
+        i = Util_AtomicAdd( &p->iPushNext, 1 );
+        if ( i >= Vec_PtrSize(p->vPushCubes) )
+            break;
+        if ( p->timeToStop && Util_WallClock() > p->timeToStop )
+        {
+            Pdr_PthSetStatus( p, -1 );
+            break;
+        }
+        // check if the clause can be moved to the next frame
+        pCube = (Pdr_Set_t *)Vec_PtrEntry( p->vPushCubes, i );
+        RetValue = Pdr_ManCheckCube( pMan, p->kPush, pCube, NULL, 0 );
+        if ( RetValue == -1 )
+        {
+            Pdr_PthSetStatus( p, -1 );
+            break;
+        }
+        if ( !RetValue )
+            continue;
+        pCubeMin = Pdr_ManReduceClause( pMan, p->kPush, pCube );
+        Vec_PtrWriteEntry( p->vPushRes, i, pCubeMin ? pCubeMin : pCube );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Pushes the clauses forward using all threads.]
+
+  Description [Mirrors Pdr_ManPushClauses(). The clauses of each frame
+  are checked in parallel; the frames are processed in order.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_PthPushClauses( Pdr_Pth_t * p )
+{
+    Pdr_Man_t * pMan = p->pMan;
+    Pdr_Set_t * pTemp, * pCubeK, * pCubeK1, * pCubePushed;
+    Vec_Ptr_t * vArrayK, * vArrayK1;
+    int i, j, k, m, RetValue = 0, kMax = Vec_PtrSize(pMan->vSolvers)-1;
+    int iStartFrame = pMan->pPars->fShiftStart ? pMan->iUseFrame : 1;
+    abctime clk = Abc_Clock();
+    assert( pMan->iUseFrame > 0 );
+    Vec_VecForEachLevelStartStop( pMan->vClauses, vArrayK, k, iStartFrame, kMax )
+    {
+        Vec_PtrSort( vArrayK, (int (*)(void))Pdr_SetCompare );
+        vArrayK1 = Vec_VecEntry( pMan->vClauses, k+1 );
+        // remove cubes in the same frame that are contained by other cubes
+        Vec_PtrForEachEntry( Pdr_Set_t *, vArrayK, pCubeK, j )
+            Vec_PtrForEachEntryStart( Pdr_Set_t *, vArrayK, pTemp, m, j+1 )
+            {
+                if ( !Pdr_SetContains( pTemp, pCubeK ) ) // pCubeK contains pTemp
+                    continue;
+                Pdr_SetDeref( pTemp );
+                Vec_PtrWriteEntry( vArrayK, m, Vec_PtrEntryLast(vArrayK) );
+                Vec_PtrPop(vArrayK);
+                m--;
+            }
+        // check which clauses can be moved to the next frame
+        p->kPush = k;
+        p->iPushNext = 0;
+        Vec_PtrCopy( p->vPushCubes, vArrayK );
+        Vec_PtrFill( p->vPushRes, Vec_PtrSize(vArrayK), NULL );
+        Util_PoolRun( p->pPool, Pdr_PthPushThread, p );
+        Pdr_PthCleanLog( p );
+        // move them
+        Vec_PtrClear( vArrayK );
+        Vec_PtrForEachEntry( Pdr_Set_t *, p->vPushCubes, pCubeK, j )
+        {
+            pCubePushed = (Pdr_Set_t *)Vec_PtrEntry( p->vPushRes, j );
+            if ( pCubePushed == NULL )
+            {
+                Vec_PtrPush( vArrayK, pCubeK );
+                continue;
+            }
+            if ( pCubePushed != pCubeK )
+            {
+                Pdr_SetDeref( pCubeK );
+                pCubeK = pCubePushed;
+            }
+            // add it to the next frame of all solvers
+            Pdr_PthAddClause( p, -1, k+1, k+1, pCubeK, 0 );
+            // check if the clause subsumes others
+            Vec_PtrForEachEntry( Pdr_Set_t *, vArrayK1, pCubeK1, i )
+            {
+                if ( !Pdr_SetContains( pCubeK1, pCubeK ) ) // pCubeK contains pCubeK1
+                    continue;
+                Pdr_SetDeref( pCubeK1 );
+                Vec_PtrWriteEntry( vArrayK1, i, Vec_PtrEntryLast(vArrayK1) );
+                Vec_PtrPop(vArrayK1);
+                i--;
+            }
+            // add the last clause
+            Vec_PtrPush( vArrayK1, pCubeK );
+        }
+        if ( p->Status == -1 )
+        {
+            pMan->tPush += Abc_Clock() - clk;
+            return -1;
+        }
+        if ( Vec_PtrSize(vArrayK) == 0 )
+            RetValue = 1;
+    }
+
+    // clean up the last one
+    vArrayK = Vec_VecEntry( pMan->vClauses, kMax );
+    Vec_PtrSort( vArrayK, (int (*)(void))Pdr_SetCompare );
+    Vec_PtrForEachEntry( Pdr_Set_t *, vArrayK, pCubeK, j )
+    {
+        // remove cubes in the same frame that are contained by pCubeK
+        Vec_PtrForEachEntryStart( Pdr_Set_t *, vArrayK, pTemp, m, j+1 )
+        {
+            if ( !Pdr_SetContains( pTemp, pCubeK ) ) // pCubeK contains pTemp
+                continue;
+            Pdr_SetDeref( pTemp );
+            Vec_PtrWriteEntry( vArrayK, m, Vec_PtrEntryLast(vArrayK) );
+            Vec_PtrPop(vArrayK);
+            m--;
+        }
+    }
+    pMan->tPush += Abc_Clock() - clk;
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints the message when the resource limit is reached.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_PthPrintLimit( Pdr_Pth_t * p )
+{
+    Pdr_Par_t * pPars = p->pMan->pPars;
+    if ( pPars->fSilent )
+        return;
+    if ( p->timeToStop && Util_WallClock() > p->timeToStop )
+        Abc_Print( 1, "Reached timeout (%d seconds).\n",  pPars->nTimeOut );
+    else if ( pPars->nConfLimit )
+        Abc_Print( 1, "Reached conflict limit (%d).\n",  pPars->nConfLimit );
+    else if ( pPars->fVerbose )
+        Abc_Print( 1, "Computation cancelled by the callback.\n" );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Multi-threaded version of Pdr_ManSolveInt().]
+
+  Description [Supports the default mode, in which the computation stops
+  after the first failed output.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManSolvePth( Pdr_Man_t * pMan )
+{
+    Pdr_Pth_t * p;
+    Pdr_Set_t * pCube = NULL, * pTemp;
+    Vec_Ptr_t * vLoaded;
+    Pdr_Obl_t * pQueue;
+    Aig_Obj_t * pObj;
+    int i, k, RetValue = -1;
+    abctime clkStart = Util_WallClock();
+    assert( !pMan->pPars->fSolveAll );
+    assert( Vec_PtrSize(pMan->vSolvers) == 0 );
+    p = Pdr_PthStart( pMan );
+    if ( pMan->pPars->fVerbose )
+        Abc_Print( 1, "Using %d threads.\n", p->nProcs );
+    // create the first timeframe
+    Pdr_PthCreateSolvers( p, (k = 0) );
+    while ( 1 )
+    {
+        pMan->nFrames = k;
+        assert( k == Vec_PtrSize(pMan->vSolvers)-1 );
+        for ( i = 0; i < p->nProcs; i++ )
+            p->pMans[i]->iUseFrame = Abc_MaxInt(k, 1);
+        Saig_ManForEachPo( pMan->pAig, pObj, pMan->iOutCur )
+        {
+            // check if the output is trivially solved
+            if ( Aig_ObjChild0(pObj) == Aig_ManConst0(pMan->pAig) )
+                continue;
+            // check if the output is trivially solved
+            if ( Aig_ObjChild0(pObj) == Aig_ManConst1(pMan->pAig) )
+            {
+                pMan->pAig->pSeqModel = Abc_CexMakeTriv( Aig_ManRegNum(pMan->pAig), Saig_ManPiNum(pMan->pAig), Saig_ManPoNum(pMan->pAig), k*Saig_ManPoNum(pMan->pAig)+pMan->iOutCur );
+                RetValue = 0; // SAT
+                goto finish;
+            }
+            for ( i = 1; i < p->nProcs; i++ )
+                p->pMans[i]->iOutCur = pMan->iOutCur;
+            while ( 1 )
+            {
+                Pdr_PthSyncClauses( p, 0 );
+                RetValue = Pdr_ManCheckCube( pMan, k, NULL, &pCube, pMan->pPars->nConfLimit );
+                if ( RetValue == 1 )
+                    break;
+                if ( RetValue == 0 )
+                    RetValue = Pdr_PthBlockCube( p, pCube );
+                if ( RetValue == -1 )
+                {
+                    if ( pMan->pPars->fVerbose )
+                        Pdr_ManPrintProgress( pMan, 1, Util_WallClock() - clkStart );
+                    Pdr_PthPrintLimit( p );
+                    pMan->pPars->iFrame = k;
+                    goto finish;
+                }
+                if ( RetValue == 0 )
+                {
+                    if ( pMan->pPars->fVerbose )
+                        Pdr_ManPrintProgress( pMan, 1, Util_WallClock() - clkStart );
+                    pMan->pPars->iFrame = k;
+                    // derive the counter-example from the obligation that reached the initial state
+                    pQueue = pMan->pQueue;
+                    pMan->pQueue = p->pCexObl;
+                    pMan->pAig->pSeqModel = Pdr_ManDeriveCex( pMan );
+                    pMan->pQueue = pQueue;
+                    Pdr_OblDeref( p->pCexObl );
+                    goto finish;
+                }
+                if ( pMan->pPars->fVerbose )
+                    Pdr_ManPrintProgress( pMan, 0, Util_WallClock() - clkStart );
+            }
+        }
+
+        if ( pMan->pPars->fVerbose )
+            Pdr_ManPrintProgress( pMan, 1, Util_WallClock() - clkStart );
+        // open a new timeframe
+        for ( i = 0; i < p->nProcs; i++ )
+        {
+            Pdr_ManSetPropertyOutput( p->pMans[i], k );
+            pMan->iUseFrame = Abc_MinInt( pMan->iUseFrame, p->pMans[i]->iUseFrame );
+        }
+        Pdr_PthCreateSolvers( p, ++k );
+        // add the clauses of the previous run, which are still inductive
+        if ( k == 1 && pMan->pPars->pLoadFile && (vLoaded = Pdr_ManLoadFrames(pMan, pMan->pPars->pLoadFile)) )
+        {
+            Vec_PtrForEachEntry( Pdr_Set_t *, vLoaded, pTemp, i )
+                Pdr_PthAddClause( p, -1, k, k, pTemp, 1 ); // consume ref
+            Vec_PtrFree( vLoaded );
+        }
+        // push clauses into this timeframe
+        RetValue = Pdr_PthPushClauses( p );
+        if ( RetValue == -1 )
+        {
+            if ( pMan->pPars->fVerbose )
+                Pdr_ManPrintProgress( pMan, 1, Util_WallClock() - clkStart );
+            Pdr_PthPrintLimit( p );
+            pMan->pPars->iFrame = k;
+            goto finish;
+        }
+        if ( RetValue )
+        {
+            if ( pMan->pPars->fVerbose )
+                Pdr_ManPrintProgress( pMan, 1, Util_WallClock() - clkStart );
+            if ( !pMan->pPars->fSilent )
+                Pdr_ManReportInvariant( pMan );
+            if ( !pMan->pPars->fSilent )
+                Pdr_ManVerifyInvariant( pMan );
+            pMan->pPars->iFrame = k;
+            pMan->pPars->nProveOuts = Saig_ManPoNum(pMan->pAig);
+            RetValue = 1; // UNSAT
+            goto finish;
+        }
+        if ( pMan->pPars->fVerbose )
+            Pdr_ManPrintProgress( pMan, 0, Util_WallClock() - clkStart );
+
+        // check termination
+        RetValue = -1;
+        if ( pMan->pPars->pFuncStop && pMan->pPars->pFuncStop(pMan->pPars->RunId) )
+        {
+            pMan->pPars->iFrame = k;
+            goto finish;
+        }
+        if ( p->timeToStop && Util_WallClock() > p->timeToStop )
+        {
+            if ( pMan->pPars->fVerbose )
+                Pdr_ManPrintProgress( pMan, 1, Util_WallClock() - clkStart );
+            if ( !pMan->pPars->fSilent )
+                Abc_Print( 1, "Reached timeout (%d seconds).\n",  pMan->pPars->nTimeOut );
+            pMan->pPars->iFrame = k;
+            goto finish;
+        }
+        if ( pMan->pPars->nFrameMax && k >= pMan->pPars->nFrameMax )
+        {
+            if ( pMan->pPars->fVerbose )
+                Pdr_ManPrintProgress( pMan, 1, Util_WallClock() - clkStart );
+            if ( !pMan->pPars->fSilent )
+                Abc_Print( 1, "Reached limit on the number of timeframes (%d).\n", pMan->pPars->nFrameMax );
+            pMan->pPars->iFrame = k;
+            goto finish;
+        }
+    }
+finish:
+    Pdr_PthStop( p );
+    return RetValue;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -52,6 +52,7 @@ sat_solver * Pdr_ManCreateSolver( Pdr_Man_t * p, int k )
     assert( Vec_IntSize(p->vActVars) == k );
     // create new solver
     pSat = sat_solver_new();
+    sat_solver_set_lbd_mode( pSat, p->pPars->fLbdMode );
     pSat = Pdr_ManNewSolver( pSat, p, k, (int)(k == 0) );
     Vec_PtrPush( p->vSolvers, pSat );
     Vec_VecExpand( p->vClauses, k );
@@ -95,9 +96,11 @@ sat_solver * Pdr_ManFetchSolver( Pdr_Man_t * p, int k )
     // set the property output
     Pdr_ManSetPropertyOutput( p, k );
     // add the clauses
+    Util_LockRead( p->pLockDb );
     Vec_VecForEachLevelStart( p->vClauses, vArrayK, i, k )
         Vec_PtrForEachEntry( Pdr_Set_t *, vArrayK, pCube, j )
             Pdr_ManSolverAddClause( p, k, pCube );
+    Util_LockUnlock( p->pLockDb );
     return pSat;
 }
 
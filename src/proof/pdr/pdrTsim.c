@@ -19,6 +19,7 @@
 ***********************************************************************/
 
 #include "pdrInt.h"
+#include "misc/util/utilTruth.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -187,77 +188,106 @@ int Pdr_ManSimDataInit( Aig_Man_t * pAig,
 
 /**Function*************************************************************
 
-  Synopsis    [Tries to assign ternary value to one of the CIs.]
-
-  Description []
+  Synopsis    [Sets up the lanes, in which the CIs are undefined.]
 
+  Description [CIs marked in vMark are undefined in all lanes. Candidate
+  j (the j-th entry of vCands, starting from iStart) is undefined in lane j
+  only, if fPrefix is 0, or in lanes j, j+1, ..., if fPrefix is 1.]
+               
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-int Pdr_ManExtendOne( Aig_Man_t * pAig, Aig_Obj_t * pObj, Vec_Int_t * vUndo, Vec_Int_t * vVis )
+static void Pdr_ManExtendSetLanes( Vec_Wrd_t * vCiXs, int nCis, int nWords, Vec_Int_t * vMark, Vec_Int_t * vCands, int iStart, int nLanes, int fPrefix )
 {
-    Aig_Obj_t * pFanout;
-    int i, k, iFanout = -1, Value, Value2;
-    assert( Saig_ObjIsLo(pAig, pObj) );
-    assert( Aig_ObjIsTravIdCurrent(pAig, pObj) );
-    // save original value
-    Value = Pdr_ManSimInfoGet( pAig, pObj );
-    assert( Value == PDR_ZER || Value == PDR_ONE );
-    Vec_IntPush( vUndo, Aig_ObjId(pObj) );
-    Vec_IntPush( vUndo, Value );
-    // update original value
-    Pdr_ManSimInfoSet( pAig, pObj, PDR_UND );
-    // traverse
-    Vec_IntClear( vVis );
-    Vec_IntPush( vVis, Aig_ObjId(pObj) );
-    Aig_ManForEachObjVec( vVis, pAig, pObj, i )
+    word * pMask;
+    int i, j, w;
+    Vec_WrdFill( vCiXs, nCis * nWords, 0 );
+    for ( i = 0; i < nCis; i++ )
+        if ( Vec_IntEntry(vMark, i) )
+            for ( w = 0, pMask = Vec_WrdEntryP(vCiXs, i * nWords); w < nWords; w++ )
+                pMask[w] = ~(word)0;
+    for ( j = 0; j < nLanes; j++ )
     {
-        Aig_ObjForEachFanout( pAig, pObj, pFanout, iFanout, k )
+        pMask = Vec_WrdEntryP( vCiXs, Vec_IntEntry(vCands, iStart + j) * nWords );
+        if ( fPrefix )
         {
-            if ( !Aig_ObjIsTravIdCurrent(pAig, pFanout) )
-                continue;
-            assert( Aig_ObjId(pObj) < Aig_ObjId(pFanout) );
-            Value = Pdr_ManSimInfoGet( pAig, pFanout );
-            if ( Value == PDR_UND )
-                continue;
-            Value2 = Pdr_ManExtendOneEval( pAig, pFanout );
-            if ( Value2 == Value )
-                continue;
-            assert( Value2 == PDR_UND );
-            Vec_IntPush( vUndo, Aig_ObjId(pFanout) );
-            Vec_IntPush( vUndo, Value );
-            if ( Aig_ObjIsCo(pFanout) )
-                return 0;
-            assert( Aig_ObjIsNode(pFanout) );
-            Vec_IntPushOrder( vVis, Aig_ObjId(pFanout) );
+            pMask[j >> 6] = ~(word)0 << (j & 63);
+            for ( w = (j >> 6) + 1; w < nWords; w++ )
+                pMask[w] = ~(word)0;
         }
+        else
+            pMask[j >> 6] = (word)1 << (j & 63);
     }
-    return 1;
 }
 
 /**Function*************************************************************
 
-  Synopsis    [Undoes the partial results of ternary simulation.]
-
-  Description []
+  Synopsis    [Tries to assign ternary values to the candidate CIs.]
+
+  Description [Produces the same result as trying the candidates one at a 
+  time in the given order, while simulating many of them in parallel using 
+  bit-sliced ternary simulation. First, each candidate is tried alone, and 
+  the candidates, which cannot be removed alone, are dropped (ternary 
+  simulation is monotone, so they cannot be removed with other CIs either). 
+  Next, the remaining candidates are tried in the order: lane j has 
+  candidates 0, 1, ..., j undefined. If lane j is the first one failing, 
+  candidates 0, ..., j-1 are removed, candidate j is dropped, and the 
+  process continues with the next candidate. The CI objects to be removed 
+  are added to vCi2Rem.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void Pdr_ManExtendUndo( Aig_Man_t * pAig, Vec_Int_t * vUndo )
+void Pdr_ManExtendMany( Pdr_Man_t * p, Vec_Int_t * vCands, Vec_Int_t * vCi2Rem )
 {
-    Aig_Obj_t * pObj;
-    int i, Value;
-    Aig_ManForEachObjVec( vUndo, pAig, pObj, i )
+    Vec_Int_t * vCiObjs = p->vCiObjs;
+    Vec_Int_t * vMark   = p->vVisits;  // CIs to be removed (marks by CI index)
+    int nCis = Vec_IntSize(vCiObjs);
+    int nLanesMax = 64 * Saig_TswWordNum(p->pTsw);
+    int i, j, k, w, nLanes, nWords, iStart;
+    word pRes[16];
+    assert( Saig_TswWordNum(p->pTsw) <= 16 );
+    Vec_IntFill( vMark, nCis, 0 );
+    Saig_TswSetCone( p->pTsw, vCiObjs, p->vNodes, p->vCoObjs );
+    // drop the candidates, which cannot be removed alone
+    for ( iStart = k = 0; iStart < Vec_IntSize(vCands); iStart += nLanes )
+    {
+        nLanes = Abc_MinInt( Vec_IntSize(vCands) - iStart, nLanesMax );
+        nWords = Abc_Bit6WordNum( nLanes );
+        Pdr_ManExtendSetLanes( p->vCiXs, nCis, nWords, vMark, vCands, iStart, nLanes, 0 );
+        Saig_TswSimulate( p->pTsw, nWords, p->vCiVals, p->vCiXs );
+        Saig_TswCheckCos( p->pTsw, nWords, p->vCoVals, pRes );
+        for ( j = 0; j < nLanes; j++ )
+            if ( (pRes[j >> 6] >> (j & 63)) & 1 )
+                Vec_IntWriteEntry( vCands, k++, Vec_IntEntry(vCands, iStart + j) );
+    }
+    Vec_IntShrink( vCands, k );
+    // try the remaining candidates in the given order
+    for ( iStart = 0; iStart < Vec_IntSize(vCands); iStart += nLanes )
     {
-        Value  = Vec_IntEntry(vUndo, ++i);
-        assert( Pdr_ManSimInfoGet(pAig, pObj) == PDR_UND );
-        Pdr_ManSimInfoSet( pAig, pObj, Value );
+        nLanes = Abc_MinInt( Vec_IntSize(vCands) - iStart, nLanesMax );
+        nWords = Abc_Bit6WordNum( nLanes );
+        Pdr_ManExtendSetLanes( p->vCiXs, nCis, nWords, vMark, vCands, iStart, nLanes, 1 );
+        Saig_TswSimulate( p->pTsw, nWords, p->vCiVals, p->vCiXs );
+        Saig_TswCheckCos( p->pTsw, nWords, p->vCoVals, pRes );
+        // find the first failing lane
+        for ( w = 0; w < nWords; w++ )
+            if ( ~pRes[w] )
+                break;
+        j = (w == nWords) ? nLanes : Abc_MinInt( 64 * w + Abc_Tt6FirstBit(~pRes[w]), nLanes );
+        for ( i = 0; i < j; i++ )
+            Vec_IntWriteEntry( vMark, Vec_IntEntry(vCands, iStart + i), 1 );
+        if ( j < nLanes )
+            nLanes = j + 1;
     }
+    // collect the removed CIs
+    for ( i = 0; i < nCis; i++ )
+        if ( Vec_IntEntry(vMark, i) )
+            Vec_IntPush( vCi2Rem, Vec_IntEntry(vCiObjs, i) );
 }
 
 /**Function*************************************************************
@@ -358,9 +388,8 @@ Pdr_Set_t * Pdr_ManTernarySim( Pdr_Man_t * p, int k, Pdr_Set_t * pCube )
     Vec_Int_t * vCiVals = p->vCiVals;  // cone leaf values (0/1 CI values)
     Vec_Int_t * vCoVals = p->vCoVals;  // cone root values (0/1 CO values)
     Vec_Int_t * vNodes  = p->vNodes;   // cone nodes (node obj IDs)
-    Vec_Int_t * vUndo   = p->vUndo;    // cone undos (node obj IDs)
-    Vec_Int_t * vVisits = p->vVisits;  // intermediate (obj IDs)
     Vec_Int_t * vCi2Rem = p->vCi2Rem;  // CIs to be removed (CI obj IDs)
+    Vec_Int_t * vCands  = p->vCands;   // CIs to be tried (CI indexes)
     Vec_Int_t * vRes    = p->vRes;     // final result (flop literals)
     Aig_Obj_t * pObj;
     int i, Entry, RetValue;
@@ -404,9 +433,8 @@ Pdr_ManPrintCex( p->pAig, vCiObjs, vCiVals, NULL );
     RetValue = Pdr_ManSimDataInit( p->pAig, vCiObjs, vCiVals, vNodes, vCoObjs, vCoVals, NULL );
     assert( RetValue );
 
-#if 1
-    // try removing high-priority flops
-    Vec_IntClear( vCi2Rem );
+    // collect the flops to try (high-priority flops first)
+    Vec_IntClear( vCands );
     Aig_ManForEachObjVec( vCiObjs, p->pAig, pObj, i )
     {
         if ( !Saig_ObjIsLo( p->pAig, pObj ) )
@@ -414,57 +442,21 @@ Pdr_ManPrintCex( p->pAig, vCiObjs, vCiVals, NULL );
         Entry = Aig_ObjCioId(pObj) - Saig_ManPiNum(p->pAig);
         if ( vPrio != NULL && Vec_IntEntry( vPrio, Entry ) != 0 )
             continue;
-        Vec_IntClear( vUndo );
-        if ( Pdr_ManExtendOne( p->pAig, pObj, vUndo, vVisits ) )
-            Vec_IntPush( vCi2Rem, Aig_ObjId(pObj) );
-        else
-            Pdr_ManExtendUndo( p->pAig, vUndo );
+        Vec_IntPush( vCands, i );
     }
-    // try removing low-priority flops
+    if ( vPrio != NULL )
     Aig_ManForEachObjVec( vCiObjs, p->pAig, pObj, i )
     {
         if ( !Saig_ObjIsLo( p->pAig, pObj ) )
             continue;
         Entry = Aig_ObjCioId(pObj) - Saig_ManPiNum(p->pAig);
-        if ( vPrio == NULL || Vec_IntEntry( vPrio, Entry ) == 0 )
+        if ( Vec_IntEntry( vPrio, Entry ) == 0 )
             continue;
-        Vec_IntClear( vUndo );
-        if ( Pdr_ManExtendOne( p->pAig, pObj, vUndo, vVisits ) )
-            Vec_IntPush( vCi2Rem, Aig_ObjId(pObj) );
-        else
-            Pdr_ManExtendUndo( p->pAig, vUndo );
+        Vec_IntPush( vCands, i );
     }
-#else
-    // try removing low-priority flops
-    Aig_ManForEachObjVec( vCiObjs, p->pAig, pObj, i )
-    {
-        if ( !Saig_ObjIsLo( p->pAig, pObj ) )
-            continue;
-        Entry = Aig_ObjCioId(pObj) - Saig_ManPiNum(p->pAig);
-        if ( vPrio == NULL || Vec_IntEntry( vPrio, Entry ) == 0 )
-            continue;
-        Vec_IntClear( vUndo );
-        if ( Pdr_ManExtendOne( p->pAig, pObj, vUndo, vVisits ) )
-            Vec_IntPush( vCi2Rem, Aig_ObjId(pObj) );
-        else
-            Pdr_ManExtendUndo( p->pAig, vUndo );
-    }
-    // try removing high-priority flops
+    // try removing the flops
     Vec_IntClear( vCi2Rem );
-    Aig_ManForEachObjVec( vCiObjs, p->pAig, pObj, i )
-    {
-        if ( !Saig_ObjIsLo( p->pAig, pObj ) )
-            continue;
-        Entry = Aig_ObjCioId(pObj) - Saig_ManPiNum(p->pAig);
-        if ( vPrio != NULL && Vec_IntEntry( vPrio, Entry ) != 0 )
-            continue;
-        Vec_IntClear( vUndo );
-        if ( Pdr_ManExtendOne( p->pAig, pObj, vUndo, vVisits ) )
-            Vec_IntPush( vCi2Rem, Aig_ObjId(pObj) );
-        else
-            Pdr_ManExtendUndo( p->pAig, vUndo );
-    }
-#endif
+    Pdr_ManExtendMany( p, vCands, vCi2Rem );
 
 if ( p->pPars->fVeryVerbose )
 Pdr_ManPrintCex( p->pAig, vCiObjs, vCiVals, vCi2Rem );
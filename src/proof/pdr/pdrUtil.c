@@ -72,6 +72,7 @@ Pdr_Set_t * Pdr_SetCreate( Vec_Int_t * vLits, Vec_Int_t * vPiLits )
     p->nTotal = Vec_IntSize(vLits) + Vec_IntSize(vPiLits);
     p->nRefs  = 1;
     p->Sign   = 0;
+    p->iOut   = -1;
     for ( i = 0; i < p->nLits; i++ )
     {
         p->Lits[i] = Vec_IntEntry(vLits, i);
@@ -105,6 +106,7 @@ Pdr_Set_t * Pdr_SetCreateFrom( Pdr_Set_t * pSet, int iRemove )
     p->nTotal = pSet->nTotal - 1;
     p->nRefs  = 1;
     p->Sign   = 0;
+    p->iOut   = pSet->iOut;
     for ( i = 0; i < pSet->nTotal; i++ )
     {
         if ( i == iRemove )
@@ -139,6 +141,7 @@ Pdr_Set_t * Pdr_SetCreateSubset( Pdr_Set_t * pSet, int * pLits, int nLits )
     p->nTotal = nLits + pSet->nTotal - pSet->nLits;
     p->nRefs  = 1;
     p->Sign   = 0;
+    p->iOut   = pSet->iOut;
     for ( i = 0; i < nLits; i++ )
     {
         assert( pLits[i] >= 0 );
@@ -172,6 +175,7 @@ Pdr_Set_t * Pdr_SetDup( Pdr_Set_t * pSet )
     p->nTotal = pSet->nTotal;
     p->nRefs  = 1;
     p->Sign   = pSet->Sign;
+    p->iOut   = pSet->iOut;
     for ( i = 0; i < pSet->nTotal; i++ )
         p->Lits[i] = pSet->Lits[i];
     return p;
@@ -539,6 +543,7 @@ void Pdr_QueuePush( Pdr_Man_t * p, Pdr_Obl_t * pObl )
     if ( p->pQueue == NULL )
     {
         p->pQueue = pObl;
+        pObl->pLink = NULL;
         return;
     }
     for ( ppPrev = &p->pQueue, pTemp = p->pQueue; pTemp; ppPrev = &pTemp->pLink, pTemp = pTemp->pLink )
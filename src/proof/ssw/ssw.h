@@ -67,6 +67,7 @@ struct Ssw_Pars_t_
     int              nIsleDist;     // extends islands by the given distance
     int              fScorrGia;     // new signal correspondence implementation
     int              fUseCSat;      // new SAT solver using when fScorrGia is selected
+    int              fLbdMode;      // use LBD-based clause management and restarts
     int              fVerbose;      // verbose stats
     int              fFlopVerbose;  // verbose printout of redundant flops
     int              fEquivDump;    // enables dumping equivalences
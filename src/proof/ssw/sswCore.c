@@ -64,6 +64,7 @@ void Ssw_ManSetDefaultParams( Ssw_Pars_t * p )
     p->fSemiFormal    =       0;  // enable semiformal filtering
     p->fDynamic       =       0;  // dynamic partitioning
     p->fLocalSim      =       0;  // local simulation
+    p->fLbdMode       =       0;  // LBD-based clause management and restarts
     p->fVerbose       =       0;  // verbose stats
     p->fEquivDump     =       0;  // enables dumping equivalences
 
@@ -250,6 +251,7 @@ Aig_Man_t * Ssw_SignalCorrespondenceRefine( Ssw_Man_t * p )
     if ( !p->pPars->fLatchCorr )
     {
         p->pMSat = Ssw_SatStart( 0 );
+        sat_solver_set_lbd_mode( p->pMSat->pSat, p->pPars->fLbdMode );
         if ( p->pPars->fConstrs )
             Ssw_ManSweepBmcConstr( p );
         else
@@ -308,6 +310,7 @@ Aig_Man_t * Ssw_SignalCorrespondenceRefine( Ssw_Man_t * p )
 
 clk = Abc_Clock();
         p->pMSat = Ssw_SatStart( 0 );
+        sat_solver_set_lbd_mode( p->pMSat->pSat, p->pPars->fLbdMode );
         if ( p->pPars->fLatchCorrOpt )
         {
             RetValue = Ssw_ManSweepLatch( p );
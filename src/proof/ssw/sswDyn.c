@@ -452,6 +452,7 @@ p->timeReduce += Abc_Clock() - clk;
                 p->nRecycleCalls = 0;
             }
             p->pMSat = Ssw_SatStart( 0 );
+            sat_solver_set_lbd_mode( p->pMSat->pSat, p->pPars->fLbdMode );
             assert( p->nPatterns == 0 );
         }
         // resimulate
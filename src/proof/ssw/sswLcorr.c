@@ -309,6 +309,7 @@ int Ssw_ManSweepLatch( Ssw_Man_t * p )
             p->nCallsMax = Abc_MaxInt( p->nCallsMax, p->pMSat->nSolverCalls );
             Ssw_SatStop( p->pMSat );
             p->pMSat = Ssw_SatStart( 0 );
+            sat_solver_set_lbd_mode( p->pMSat->pSat, p->pPars->fLbdMode );
             p->nRecycles++;
             p->nRecycleCalls = 0;
         }
@@ -22,6 +22,7 @@
 #include "aig/gia/giaAig.h"
 #include "base/main/main.h"
 #include "sat/bmc/bmc.h"
+#include "misc/util/utilSimd.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -484,12 +485,7 @@ int Ssw_RarManObjIsConst( void * pMan, Aig_Obj_t * pObj )
 {
     Ssw_RarMan_t * p = (Ssw_RarMan_t *)pMan;
     word * pSim = Ssw_RarObjSim( p, Aig_ObjId(pObj) );
-    word Flip = pObj->fPhase ? ~(word)0 : 0;
-    int w;
-    for ( w = 0; w < p->pPars->nWords; w++ )
-        if ( pSim[w] ^ Flip )
-            return 0;
-    return 1;
+    return Util_SimdFindNeqW( Util_SimdLevel(), pSim, pObj->fPhase, p->pPars->nWords ) == -1;
 }
 
 /**Function*************************************************************
@@ -508,12 +504,7 @@ int Ssw_RarManObjsAreEqual( void * pMan, Aig_Obj_t * pObj0, Aig_Obj_t * pObj1 )
     Ssw_RarMan_t * p = (Ssw_RarMan_t *)pMan;
     word * pSim0 = Ssw_RarObjSim( p, pObj0->Id );
     word * pSim1 = Ssw_RarObjSim( p, pObj1->Id );
-    word Flip = (pObj0->fPhase != pObj1->fPhase) ? ~(word)0 : 0;
-    int w;
-    for ( w = 0; w < p->pPars->nWords; w++ )
-        if ( pSim0[w] ^ pSim1[w] ^ Flip )
-            return 0;
-    return 1;
+    return Util_SimdFindDiffW( Util_SimdLevel(), pSim0, pSim1, pObj0->fPhase != pObj1->fPhase, p->pPars->nWords ) == -1;
 }
 
 /**Function*************************************************************
@@ -652,8 +643,7 @@ void Ssw_RarManSimulate( Ssw_RarMan_t * p, Vec_Int_t * vInit, int fUpdate, int f
 {
     Aig_Obj_t * pObj, * pRepr;
     word * pSim, * pSim0, * pSim1;
-    word Flip, Flip0, Flip1;
-    int w, i;
+    int i, Level = Util_SimdLevel();
     // initialize
     Ssw_RarManInitialize( p, vInit );
     Vec_PtrClear( p->vUpdConst );
@@ -683,10 +673,7 @@ void Ssw_RarManSimulate( Ssw_RarMan_t * p, Vec_Int_t * vInit, int fUpdate, int f
         pSim  = Ssw_RarObjSim( p, Aig_ObjId(pObj) );
         pSim0 = Ssw_RarObjSim( p, Aig_ObjFaninId0(pObj) );
         pSim1 = Ssw_RarObjSim( p, Aig_ObjFaninId1(pObj) );
-        Flip0 = Aig_ObjFaninC0(pObj) ? ~(word)0 : 0;
-        Flip1 = Aig_ObjFaninC1(pObj) ? ~(word)0 : 0;
-        for ( w = 0; w < p->pPars->nWords; w++ )
-            pSim[w] = (Flip0 ^ pSim0[w]) & (Flip1 ^ pSim1[w]);
+        Util_SimdAndW( Level, pSim, pSim0, pSim1, Aig_ObjFaninC0(pObj), Aig_ObjFaninC1(pObj), p->pPars->nWords );
 
 
         if ( !fUpdate )
@@ -711,9 +698,7 @@ void Ssw_RarManSimulate( Ssw_RarMan_t * p, Vec_Int_t * vInit, int fUpdate, int f
     {
         pSim  = Ssw_RarObjSim( p, Aig_ObjId(pObj) );
         pSim0 = Ssw_RarObjSim( p, Aig_ObjFaninId0(pObj) );
-        Flip  = Aig_ObjFaninC0(pObj) ? ~(word)0 : 0;
-        for ( w = 0; w < p->pPars->nWords; w++ )
-            pSim[w] = Flip ^ pSim0[w];
+        Util_SimdCopyW( Level, pSim, pSim0, Aig_ObjFaninC0(pObj), p->pPars->nWords );
     }
     // refine classes
     if ( fUpdate )
@@ -281,6 +281,7 @@ int Ssw_FilterUsingSemi( Ssw_Man_t * pMan, int fCheckTargets, int nConfMax, int
     {
 clk = Abc_Clock();
         pMan->pMSat = Ssw_SatStart( 0 );
+        sat_solver_set_lbd_mode( pMan->pMSat->pSat, pMan->pPars->fLbdMode );
         Frames = Ssw_ManFilterBmc( p, Iter, fCheckTargets );
         if ( fVerbose )
         {
@@ -63,6 +63,9 @@ struct Saig_ParBmc_t_
     int         nLearnedStart;  // starting learned clause limit
     int         nLearnedDelta;  // delta of learned clause limit
     int         nLearnedPerce;  // ratio of learned clause limit
+    int         fLbdMode;       // use LBD-based clause management and restarts
+    int         nProcs;         // the number of threads solving groups of outputs
+    int         fPipeline;      // unroll the next frames while solving the current one
     int         fVerbose;       // verbose 
     int         fNotVerbose;    // skip line-by-line print-out 
     char *      pLogFileName;   // log file name
@@ -72,6 +75,10 @@ struct Saig_ParBmc_t_
     int         nDropOuts;      // the number of dropped outputs
     abctime     timeLastSolved; // the time when the last output was solved
     int(*pFuncOnFail)(int,Abc_Cex_t*); // called for a failed output in MO mode
+    int         RunId;          // BMC id in this run
+    int(*pFuncStop)(int);       // callback to terminate
+    volatile int * pStop;       // flag raised by another thread to stop the SAT calls
+    int(*pFuncOnFrameDone)(int,int,int); // callback on each frame status (frame, po, status)
 };
 
  
@@ -87,6 +94,7 @@ struct Bmc_AndPar_t_
     int         fDumpFrames;    // dump unrolled timeframes
     int         fUseSynth;      // use synthesis
     int         fUseOldCnf;     // use old CNF construction
+    int         fPipeline;      // unroll the next frames while solving the current one
     int         fVerbose;       // verbose 
     int         fVeryVerbose;   // very verbose 
     int         fNotVerbose;    // skip line-by-line print-out 
@@ -158,6 +166,8 @@ extern int               Saig_BmcPerform( Aig_Man_t * pAig, int nStart, int nFra
 /*=== bmcBmc3.c ==========================================================*/
 extern void              Saig_ParBmcSetDefaultParams( Saig_ParBmc_t * p );
 extern int               Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars );
+extern int               Saig_ManBmcScalablePar( Aig_Man_t * pAig, Saig_ParBmc_t * pPars );
+extern int               Saig_ManBmcScalablePipe( Aig_Man_t * pAig, Saig_ParBmc_t * pPars );
 /*=== bmcBmcAnd.c ==========================================================*/
 extern int               Gia_ManBmcPerform( Gia_Man_t * p, Bmc_AndPar_t * pPars );
 /*=== bmcCexCare.c ==========================================================*/
@@ -23,6 +23,7 @@
 #include "sat/bsat/satStore.h"
 #include "misc/vec/vecHsh.h"
 #include "misc/vec/vecWec.h"
+#include "misc/util/utilPth.h"
 #include "bmc.h"
 
 ABC_NAMESPACE_IMPL_START
@@ -64,6 +65,9 @@ struct Gia_ManBmc_t_
     int               nObjNums;    // SAT objects
     int               nWordNum;    // unsigned words for ternary simulation
     char * pSopSizes, ** pSops;    // CNF representation
+    // pipelined mode (the CNF is passed to the solver by another thread)
+    Vec_Int_t *       vClauses;    // new clauses (the number of literals followed by the literals)
+    Vec_Int_t *       vPiLits;     // pairs (unrolled PI, literal) for the PIs that received literals
 };
 
 extern int Gia_ManToBridgeResult( FILE * pFile, int Result, Abc_Cex_t * pCex, int iPoProved );
@@ -989,7 +993,12 @@ static inline void Saig_ManBmcAddClauses( Gia_ManBmc_t * p, int uTruth, int Lits
                 }
                 CutLit = CutLit / 3;
             }
-            if ( !sat_solver_addclause( p->pSat, ClaLits, ClaLits+nClaLits ) )
+            if ( p->vClauses )
+            {
+                Vec_IntPush( p->vClauses, nClaLits );
+                Vec_IntPushArray( p->vClauses, ClaLits, nClaLits );
+            }
+            else if ( !sat_solver_addclause( p->pSat, ClaLits, ClaLits+nClaLits ) )
                 assert( 0 );
         }
     }
@@ -1017,7 +1026,11 @@ int Saig_ManBmcCreateCnf_rec( Gia_ManBmc_t * p, Aig_Obj_t * pObj, int iFrame )
     if ( Aig_ObjIsCi(pObj) )
     {
         if ( Saig_ObjIsPi(p->pAig, pObj) )
+        {
             iLit = toLit( p->nSatVars++ );
+            if ( p->vPiLits )
+                Vec_IntPushTwo( p->vPiLits, iFrame * Saig_ManPiNum(p->pAig) + Aig_ObjCioId(pObj), iLit );
+        }
         else
             iLit = Saig_ManBmcCreateCnf_rec( p, Saig_ObjLoToLi(p->pAig, pObj), iFrame-1 );
         return Saig_ManBmcSetLiteral( p, pObj, iFrame, iLit );
@@ -1237,7 +1250,7 @@ int Saig_ManBmcCreateCnf( Gia_ManBmc_t * p, Aig_Obj_t * pObj, int iFrame )
             Saig_ManBmcCreateCnf_rec( p, pTemp, iFrame-f );
     Lit = Saig_ManBmcLiteral( p, pObj, iFrame );
     // extend the SAT solver
-    if ( p->nSatVars > sat_solver_nvars(p->pSat) )
+    if ( p->vClauses == NULL && p->nSatVars > sat_solver_nvars(p->pSat) )
         sat_solver_setnvars( p->pSat, p->nSatVars );
     return Lit;
 }
@@ -1297,6 +1310,9 @@ void Saig_ParBmcSetDefaultParams( Saig_ParBmc_t * p )
     p->nLearnedStart  = 10000;    // starting learned clause limit
     p->nLearnedDelta  =  2000;    // delta of learned clause limit
     p->nLearnedPerce  =    80;    // ratio of learned clause limit
+    p->fLbdMode       =     0;    // LBD-based clause management and restarts
+    p->nProcs         =     1;    // the number of threads solving groups of outputs
+    p->fPipeline      =     0;    // unroll the next frames while solving the current one
     p->fVerbose       =     0;    // verbose 
     p->fNotVerbose    =     0;    // skip line-by-line print-out 
     p->iFrame         =    -1;    // explored up to this frame
@@ -1376,6 +1392,82 @@ int Saig_ManCallSolver( Gia_ManBmc_t * p, int Lit )
     return sat_solver_solve( p->pSat, &Lit, &Lit + 1, (ABC_INT64_T)p->pPars->nConfLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Prepares the manager for solving in the given frame.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Saig_ManBmcStartFrame( Gia_ManBmc_t * p, int f )
+{
+    Aig_Obj_t * pObj;
+    unsigned * pInfo;
+    int i;
+    // map nodes of this section
+    Vec_PtrPush( p->vId2Var, Vec_IntStartFull(p->nObjNums) );
+    Vec_PtrPush( p->vTerInfo, (pInfo = ABC_CALLOC(unsigned, p->nWordNum)) );
+/*
+    // cannot remove mapping of frame values for any timeframes
+    // because with constant propagation they may be needed arbitrarily far
+    if ( f > 2*Vec_VecSize(p->vSects) )
+    {
+        int iFrameOld = f - 2*Vec_VecSize( p->vSects );
+        void * pMemory = Vec_IntReleaseArray( Vec_PtrEntry(p->vId2Var, iFrameOld) );
+        ABC_FREE( pMemory );
+    } 
+*/
+    // prepare some nodes
+    Saig_ManBmcSetLiteral( p, Aig_ManConst1(p->pAig), f, 1 );
+    Saig_ManBmcSimInfoSet( pInfo, Aig_ManConst1(p->pAig), SAIG_TER_ONE );
+    Saig_ManForEachPi( p->pAig, pObj, i )
+        Saig_ManBmcSimInfoSet( pInfo, pObj, SAIG_TER_UND );
+    if ( f == 0 )
+    {
+        Saig_ManForEachLo( p->pAig, pObj, i )
+        {
+            Saig_ManBmcSetLiteral( p, pObj, 0, 0 );
+            Saig_ManBmcSimInfoSet( pInfo, pObj, SAIG_TER_ZER );
+        }
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Asserts the output proved UNSAT in the current frame.]
+
+  Description [Also adds the units learned by the solver.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Saig_ManBmcAddUnsatOutput( Gia_ManBmc_t * p, int Lit )
+{
+    int k, status;
+    if ( Lit == 0 )
+        return;
+    // add final unit clause
+    Lit = lit_neg( Lit );
+    status = sat_solver_addclause( p->pSat, &Lit, &Lit + 1 );
+    assert( status );
+    // add learned units
+    for ( k = 0; k < veci_size(&p->pSat->unit_lits); k++ )
+    {
+        Lit = veci_begin(&p->pSat->unit_lits)[k];
+        status = sat_solver_addclause( p->pSat, &Lit, &Lit + 1 );
+        assert( status );
+    }
+    veci_resize(&p->pSat->unit_lits, 0);
+    // propagate units
+    sat_solver_compress( p->pSat );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Bounded model checking engine.]
@@ -1393,13 +1485,20 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
     Aig_Obj_t * pObj;
     Abc_Cex_t * pCexNew, * pCexNew0;
     FILE * pLogFile = NULL;
-    unsigned * pInfo;
     int RetValue = -1, fFirst = 1, nJumpFrame = 0, fUnfinished = 0;
     int nOutDigits = Abc_Base10Log( Saig_ManPoNum(pAig) );
     int i, f, k, Lit, status;
     abctime clk, clk2, clkSatRun, clkOther = 0, clkTotal = Abc_Clock();
     abctime nTimeUnsat = 0, nTimeSat = 0, nTimeUndec = 0, clkOne = 0;
     abctime nTimeToStopNG, nTimeToStop;
+    // unroll and solve on two threads
+    if ( pPars->fPipeline )
+        return Saig_ManBmcScalablePipe( pAig, pPars );
+    // solve groups of outputs on several threads
+    if ( pPars->nProcs > 1 && Util_PoolIsParallel() && Saig_ManPoNum(pAig) > 1 && 
+         !pPars->nFramesJump && !pPars->nTimeOutOne && !pPars->nTimeOutGap && !pPars->pLogFileName &&
+         !pPars->pFuncStop && !pPars->pStop && !pPars->pFuncOnFrameDone )
+        return Saig_ManBmcScalablePar( pAig, pPars );
     if ( pPars->pLogFileName )
         pLogFile = fopen( pPars->pLogFileName, "wb" );
     if ( pPars->nTimeOutOne && pPars->nTimeOut == 0 )
@@ -1415,6 +1514,8 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
     p->pSat->nLearntDelta = p->pPars->nLearnedDelta;
     p->pSat->nLearntRatio = p->pPars->nLearnedPerce;
     p->pSat->nLearntMax   = p->pSat->nLearntStart;
+    p->pSat->pStop        = pPars->pStop;
+    sat_solver_set_lbd_mode( p->pSat, p->pPars->fLbdMode );
     if ( pPars->fSolveAll && p->vCexes == NULL )
         p->vCexes = Vec_PtrStart( Saig_ManPoNum(pAig) );
     if ( pPars->fVerbose )
@@ -1437,6 +1538,7 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
         // stop BMC after exploring all reachable states
         if ( !pPars->nFramesJump && Aig_ManRegNum(pAig) < 30 && f == (1 << Aig_ManRegNum(pAig)) )
         {
+            if ( !pPars->fSilent )
             Abc_Print( 1, "Stopping BMC because all 2^%d reachable states are visited.\n", Aig_ManRegNum(pAig) );
             if ( p->pPars->fUseBridge )
                 Saig_ManForEachPo( pAig, pObj, i )
@@ -1456,31 +1558,7 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
         if ( (RetValue == -1 || pPars->fSolveAll) && pPars->nStart == 0 && !nJumpFrame )
             pPars->iFrame = f-1;
         // map nodes of this section
-        Vec_PtrPush( p->vId2Var, Vec_IntStartFull(p->nObjNums) );
-        Vec_PtrPush( p->vTerInfo, (pInfo = ABC_CALLOC(unsigned, p->nWordNum)) );
-/*
-        // cannot remove mapping of frame values for any timeframes
-        // because with constant propagation they may be needed arbitrarily far
-        if ( f > 2*Vec_VecSize(p->vSects) )
-        {
-            int iFrameOld = f - 2*Vec_VecSize( p->vSects );
-            void * pMemory = Vec_IntReleaseArray( Vec_PtrEntry(p->vId2Var, iFrameOld) );
-            ABC_FREE( pMemory );
-        } 
-*/
-        // prepare some nodes
-        Saig_ManBmcSetLiteral( p, Aig_ManConst1(pAig), f, 1 );
-        Saig_ManBmcSimInfoSet( pInfo, Aig_ManConst1(pAig), SAIG_TER_ONE );
-        Saig_ManForEachPi( pAig, pObj, i )
-            Saig_ManBmcSimInfoSet( pInfo, pObj, SAIG_TER_UND );
-        if ( f == 0 )
-        {
-            Saig_ManForEachLo( p->pAig, pObj, i )
-            {
-                Saig_ManBmcSetLiteral( p, pObj, 0, 0 );
-                Saig_ManBmcSimInfoSet( pInfo, pObj, SAIG_TER_ZER );
-            }
-        }
+        Saig_ManBmcStartFrame( p, f );
         if ( (pPars->nStart && f < pPars->nStart) || (nJumpFrame && f < nJumpFrame) )
             continue;
         // create CNF upfront
@@ -1532,6 +1610,12 @@ clkOther += Abc_Clock() - clk2;
                     Abc_Print( 1, "Reached timeout (%d seconds).\n",  pPars->nTimeOut );
                 goto finish;
             }
+            if ( pPars->pFuncStop && pPars->pFuncStop(pPars->RunId) )
+            {
+                if ( !pPars->fSilent )
+                    Abc_Print( 1, "Bmc3 was interrupted by the callback.\n" );
+                goto finish;
+            }
             // skip solved outputs
             if ( p->vCexes && Vec_PtrEntry(p->vCexes, i) )
                 continue;
@@ -1569,25 +1653,11 @@ clkSatRun = Abc_Clock() - clk2;
             if ( status == l_False )
             {
 nTimeUnsat += clkSatRun;
-                if ( Lit != 0 )
-                {
-                    // add final unit clause
-                    Lit = lit_neg( Lit );
-                    status = sat_solver_addclause( p->pSat, &Lit, &Lit + 1 );
-                    assert( status );
-                    // add learned units
-                    for ( k = 0; k < veci_size(&p->pSat->unit_lits); k++ )
-                    {
-                        Lit = veci_begin(&p->pSat->unit_lits)[k];
-                        status = sat_solver_addclause( p->pSat, &Lit, &Lit + 1 );
-                        assert( status );
-                    }
-                    veci_resize(&p->pSat->unit_lits, 0);
-                    // propagate units
-                    sat_solver_compress( p->pSat );
-                }
+                Saig_ManBmcAddUnsatOutput( p, Lit );
                 if ( p->pPars->fUseBridge )
                     Gia_ManReportProgress( stdout, i, f );
+                if ( pPars->pFuncOnFrameDone )
+                    pPars->pFuncOnFrameDone( f, i, 1 );
             }
             else if ( status == l_True )
             {
@@ -1749,6 +1819,962 @@ finish:
     return RetValue;
 }
 
+////////////////////////////////////////////////////////////////////////
+///                    MULTI-THREADED SOLVING                        ///
+////////////////////////////////////////////////////////////////////////
+
+// The outputs are partitioned into groups of consecutive outputs. Each group
+// has its own copy of the cone of influence of its outputs, together with
+// its own unrolling, structural hash table and SAT solver, so the outputs
+// of the same group share the time-frame logic. The frames are solved one
+// at a time: in each frame, the groups are taken by the threads from a 
+// shared queue, and the next frame starts when all groups are done, so a 
+// group that is solved quickly waits for the slowest group of the frame.
+// This keeps the frame-by-frame reporting of the single-threaded engine.
+// Without solving all outputs, the run stops in the first frame with a 
+// failed output; the groups containing smaller outputs finish the frame,
+// so the reported output is the smallest one failed in that frame, 
+// independently of the number of threads and their timing. When solving 
+// all outputs, the results are reported (printed, sent to the bridge, 
+// passed to the callback) in the order in which they are found, under a lock.
+
+typedef struct Saig_Bmc3Grp_t_ Saig_Bmc3Grp_t;
+struct Saig_Bmc3Grp_t_
+{
+    Gia_ManBmc_t *    pMan;        // BMC manager working on the cone of the group
+    Vec_Int_t *       vOuts;       // the original indexes of the group outputs
+    abctime           timeCnf;     // runtime of CNF generation
+    abctime           timeUnsat;   // runtime of UNSAT calls
+    abctime           timeSat;     // runtime of SAT calls
+    abctime           timeUndec;   // runtime of undecided calls
+    volatile int      fStop;       // stops the solver of this group
+};
+
+typedef struct Saig_Bmc3Par_t_ Saig_Bmc3Par_t;
+struct Saig_Bmc3Par_t_
+{
+    Aig_Man_t *       pAig;        // user AIG
+    Saig_ParBmc_t *   pPars;       // user parameters
+    Saig_ParBmc_t     ParsGrp;     // parameters used by the group managers
+    Vec_Ptr_t *       vGroups;     // groups of outputs
+    Vec_Ptr_t *       vCexes;      // counter-examples of the outputs (when solving all)
+    abctime           nTimeToStop; // wall-clock time to stop
+    int               nOutDigits;  // the number of digits in the output number
+    int               iFrame;      // the current frame
+    int               RetValue;    // the result
+    int               fTimeout;    // the runtime limit is reached
+    int               fCallback;   // the callback asked to quit
+    volatile int      iNext;       // the next group to be taken in this frame
+    volatile int      fStop;       // stops all threads
+    volatile int      iOutBest;    // the smallest failed output (when not solving all)
+    Util_Lock_t *     pLock;       // serializes reporting the results
+};
+
+/**Function*************************************************************
+
+  Synopsis    [Duplicates the cone of influence of the given outputs.]
+
+  Description [Keeps all PIs in their original order, so that the values
+  of PIs in the counter-examples are the same as in the original AIG.
+  Keeps only the flops in the cone, in their original order.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Saig_ManBmcDupOutputs_rec( Aig_Man_t * p, Aig_Obj_t * pObj, Vec_Ptr_t * vNodes, Vec_Int_t * vFlops )
+{
+    if ( Aig_ObjIsTravIdCurrent(p, pObj) )
+        return;
+    Aig_ObjSetTravIdCurrent(p, pObj);
+    if ( Aig_ObjIsNode(pObj) )
+    {
+        Saig_ManBmcDupOutputs_rec( p, Aig_ObjFanin0(pObj), vNodes, vFlops );
+        Saig_ManBmcDupOutputs_rec( p, Aig_ObjFanin1(pObj), vNodes, vFlops );
+        Vec_PtrPush( vNodes, pObj );
+    }
+    else if ( Aig_ObjIsCo(pObj) )
+        Saig_ManBmcDupOutputs_rec( p, Aig_ObjFanin0(pObj), vNodes, vFlops );
+    else if ( Saig_ObjIsLo(p, pObj) )
+        Vec_IntPush( vFlops, Aig_ObjCioId(pObj) - Saig_ManPiNum(p) );
+    else assert( Saig_ObjIsPi(p, pObj) );
+}
+Aig_Man_t * Saig_ManBmcDupOutputs( Aig_Man_t * p, Vec_Int_t * vOuts )
+{
+    Aig_Man_t * pNew;
+    Vec_Ptr_t * vNodes;
+    Vec_Int_t * vFlops;
+    Aig_Obj_t * pObj;
+    int i, iFlop;
+    // collect the nodes and the flops in the cone
+    vNodes = Vec_PtrAlloc( 100 );
+    vFlops = Vec_IntAlloc( 100 );
+    Aig_ManIncrementTravId( p );
+    Aig_ObjSetTravIdCurrent( p, Aig_ManConst1(p) );
+    Saig_ManForEachPi( p, pObj, i )
+        Aig_ObjSetTravIdCurrent( p, pObj );
+    Vec_IntForEachEntry( vOuts, iFlop, i )
+        Saig_ManBmcDupOutputs_rec( p, Aig_ManCo(p, iFlop), vNodes, vFlops );
+    Vec_IntForEachEntry( vFlops, iFlop, i )
+        Saig_ManBmcDupOutputs_rec( p, Saig_ManLi(p, iFlop), vNodes, vFlops );
+    Vec_IntSort( vFlops, 0 );
+    // create the new manager
+    pNew = Aig_ManStart( Vec_PtrSize(vNodes) );
+    pNew->pName = Abc_UtilStrsav( p->pName );
+    Aig_ManConst1(p)->pData = Aig_ManConst1( pNew );
+    Saig_ManForEachPi( p, pObj, i )
+        pObj->pData = Aig_ObjCreateCi( pNew );
+    Vec_IntForEachEntry( vFlops, iFlop, i )
+        Saig_ManLo(p, iFlop)->pData = Aig_ObjCreateCi( pNew );
+    Vec_PtrForEachEntry( Aig_Obj_t *, vNodes, pObj, i )
+        pObj->pData = Aig_And( pNew, Aig_ObjChild0Copy(pObj), Aig_ObjChild1Copy(pObj) );
+    Vec_IntForEachEntry( vOuts, iFlop, i )
+        Aig_ObjCreateCo( pNew, Aig_ObjChild0Copy(Aig_ManCo(p, iFlop)) );
+    Vec_IntForEachEntry( vFlops, iFlop, i )
+        Aig_ObjCreateCo( pNew, Aig_ObjChild0Copy(Saig_ManLi(p, iFlop)) );
+    Aig_ManSetRegNum( pNew, Vec_IntSize(vFlops) );
+    Vec_PtrFree( vNodes );
+    Vec_IntFree( vFlops );
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the groups whose outputs are all larger than iOutMin.]
+
+  Description [If iOutMin is -1, stops all groups and the frame loop.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Saig_ManBmcGroupStop( Saig_Bmc3Par_t * p, int iOutMin )
+{
+    Saig_Bmc3Grp_t * pGrp;
+    int g;
+    if ( iOutMin == -1 )
+        Util_AtomicWrite( &p->fStop, 1 );
+    Vec_PtrForEachEntry( Saig_Bmc3Grp_t *, p->vGroups, pGrp, g )
+        if ( Vec_IntEntry(pGrp->vOuts, 0) > iOutMin )
+            Util_AtomicWrite( &pGrp->fStop, 1 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the counter-example of the original AIG.]
+
+  Description [Takes the values of PIs from the solver of the group.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Cex_t * Saig_ManBmcGroupCex( Saig_Bmc3Par_t * p, Saig_Bmc3Grp_t * pGrp, int f, int iOut )
+{
+    Aig_Obj_t * pObjPi;
+    Abc_Cex_t * pCex = Abc_CexMakeTriv( Aig_ManRegNum(p->pAig), Saig_ManPiNum(p->pAig), Saig_ManPoNum(p->pAig), f*Saig_ManPoNum(p->pAig)+iOut );
+    int j, k, iBit = Saig_ManRegNum(p->pAig);
+    for ( j = 0; j <= f; j++, iBit += Saig_ManPiNum(p->pAig) )
+        Saig_ManForEachPi( pGrp->pMan->pAig, pObjPi, k )
+        {
+            int iLit = Saig_ManBmcLiteral( pGrp->pMan, pObjPi, j );
+            if ( iLit != ~0 && sat_solver_var_value(pGrp->pMan->pSat, lit_var(iLit)) )
+                Abc_InfoSetBit( pCex->pData, iBit + k );
+        }
+    return pCex;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Records the outputs of the group failed in this frame.]
+
+  Description [The first entry of vFails is the output whose SAT call 
+  succeeded, the others are the outputs failed by the same assignment.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Saig_ManBmcGroupReport( Saig_Bmc3Par_t * p, Saig_Bmc3Grp_t * pGrp, int f, Vec_Int_t * vFails )
+{
+    Saig_ParBmc_t * pPars = p->pPars;
+    Abc_Cex_t * pCexNew, * pCexNew0 = NULL;
+    int i, iOut;
+    Util_LockWrite( p->pLock );
+    if ( !pPars->fSolveAll )
+    {
+        // keep the smallest output failed in this frame and stop the groups 
+        // with larger outputs, while the groups with smaller outputs continue
+        iOut = Vec_IntEntry( vFails, 0 );
+        if ( p->iOutBest == -1 || iOut < p->iOutBest )
+        {
+            ABC_FREE( p->pAig->pSeqModel );
+            p->pAig->pSeqModel = Saig_ManBmcGroupCex( p, pGrp, f, iOut );
+            Util_AtomicWrite( &p->iOutBest, iOut );
+            Saig_ManBmcGroupStop( p, iOut );
+        }
+        p->RetValue = 0;
+        Util_LockUnlock( p->pLock );
+        return;
+    }
+    pCexNew = (pPars->fUseBridge || pPars->fStoreCex) ? Saig_ManBmcGroupCex( p, pGrp, f, Vec_IntEntry(vFails, 0) ) : (Abc_Cex_t *)(ABC_PTRINT_T)1;
+    if ( pPars->fUseBridge )
+    {
+        pCexNew0 = pCexNew;
+        pCexNew = (Abc_Cex_t *)(ABC_PTRINT_T)1;
+    }
+    p->RetValue = 0;
+    Vec_IntForEachEntry( vFails, iOut, i )
+    {
+        pPars->nFailOuts++;
+        if ( !pPars->fNotVerbose )
+            Abc_Print( 1, "Output %*d was asserted in frame %2d (solved %*d out of %*d outputs).\n",  
+                p->nOutDigits, iOut, f, p->nOutDigits, pPars->nFailOuts, p->nOutDigits, Saig_ManPoNum(p->pAig) );
+        if ( pPars->fUseBridge )
+        {
+            pCexNew0->iPo = iOut;
+            Gia_ManToBridgeResult( stdout, 0, pCexNew0, pCexNew0->iPo );
+        }
+        Vec_PtrWriteEntry( p->vCexes, iOut, Abc_CexDup(pCexNew, Saig_ManRegNum(p->pAig)) );
+        if ( i == 0 && pPars->pFuncOnFail && pPars->pFuncOnFail(iOut, pPars->fStoreCex ? (Abc_Cex_t *)Vec_PtrEntry(p->vCexes, iOut) : NULL) )
+        {
+            p->fCallback = 1;
+            Saig_ManBmcGroupStop( p, -1 );
+            break;
+        }
+    }
+    pPars->timeLastSolved = Abc_Clock();
+    Abc_CexFreeP( &pCexNew0 );
+    Abc_CexFree( pCexNew );
+    Util_LockUnlock( p->pLock );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the outputs of one group in the current frame.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Saig_ManBmcGroupSolve( Saig_Bmc3Par_t * p, Saig_Bmc3Grp_t * pGrp )
+{
+    Saig_ParBmc_t * pPars = p->pPars;
+    Gia_ManBmc_t * pMan = pGrp->pMan;
+    Vec_Int_t * vFails;
+    Aig_Obj_t * pObj, * pObj2;
+    int i, k, Lit, status, f = p->iFrame;
+    abctime clk, clkSatRun;
+    if ( Util_AtomicRead(&pGrp->fStop) )
+        return;
+    clk = Abc_Clock();
+    Saig_ManBmcStartFrame( pMan, f );
+    if ( pPars->nStart && f < pPars->nStart )
+        return;
+    // create CNF upfront
+    if ( pPars->fSolveAll )
+        Saig_ManForEachPo( pMan->pAig, pObj, i )
+            if ( !Vec_PtrEntry(p->vCexes, Vec_IntEntry(pGrp->vOuts, i)) )
+                Saig_ManBmcCreateCnf( pMan, pObj, f );
+    pGrp->timeCnf += Abc_Clock() - clk;
+    // solve SAT
+    Saig_ManForEachPo( pMan->pAig, pObj, i )
+    {
+        if ( Util_AtomicRead(&pGrp->fStop) )
+            return;
+        // skip the outputs larger than the smallest failed one
+        if ( !pPars->fSolveAll && Util_AtomicRead(&p->iOutBest) >= 0 && Vec_IntEntry(pGrp->vOuts, i) > Util_AtomicRead(&p->iOutBest) )
+            return;
+        // check for timeout
+        if ( p->nTimeToStop && Util_WallClock() >= p->nTimeToStop )
+        {
+            p->fTimeout = 1;
+            Saig_ManBmcGroupStop( p, -1 );
+            return;
+        }
+        // skip solved outputs
+        if ( p->vCexes && Vec_PtrEntry(p->vCexes, Vec_IntEntry(pGrp->vOuts, i)) )
+            continue;
+        // add constraints for this output
+        clk = Abc_Clock();
+        Lit = Saig_ManBmcCreateCnf( pMan, pObj, f );
+        pGrp->timeCnf += Abc_Clock() - clk;
+        // solve this output
+        sat_solver_compress( pMan->pSat );
+        clk = Abc_Clock();
+        status = Saig_ManCallSolver( pMan, Lit );
+        clkSatRun = Abc_Clock() - clk;
+        if ( status == l_False )
+        {
+            pGrp->timeUnsat += clkSatRun;
+            Saig_ManBmcAddUnsatOutput( pMan, Lit );
+            if ( pPars->fUseBridge )
+            {
+                Util_LockWrite( p->pLock );
+                Gia_ManReportProgress( stdout, Vec_IntEntry(pGrp->vOuts, i), f );
+                Util_LockUnlock( p->pLock );
+            }
+        }
+        else if ( status == l_True )
+        {
+            pGrp->timeSat += clkSatRun;
+            // collect the outputs failed under the same counter-example
+            vFails = Vec_IntAlloc( 1 );
+            Vec_IntPush( vFails, Vec_IntEntry(pGrp->vOuts, i) );
+            if ( pPars->fSolveAll )
+                Saig_ManForEachPo( pMan->pAig, pObj2, k )
+                {
+                    if ( k == i || Vec_PtrEntry(p->vCexes, Vec_IntEntry(pGrp->vOuts, k)) )
+                        continue;
+                    Lit = Saig_ManBmcCreateCnf( pMan, pObj2, f );
+                    if ( sat_solver_var_value(pMan->pSat, lit_var(Lit)) == Abc_LitIsCompl(Lit) )
+                        continue;
+                    Vec_IntPush( vFails, Vec_IntEntry(pGrp->vOuts, k) );
+                }
+            Saig_ManBmcGroupReport( p, pGrp, f, vFails );
+            Vec_IntFree( vFails );
+            // the remaining outputs of the group are larger
+            if ( !pPars->fSolveAll )
+                return;
+        }
+        else 
+        {
+            pGrp->timeUndec += clkSatRun;
+            assert( status == l_Undef );
+            // the solver was stopped because a smaller output failed
+            if ( !pPars->fSolveAll && Util_AtomicRead(&p->iOutBest) >= 0 && Vec_IntEntry(pGrp->vOuts, i) > Util_AtomicRead(&p->iOutBest) )
+                return;
+            if ( p->nTimeToStop && Util_WallClock() >= p->nTimeToStop )
+                p->fTimeout = 1;
+            Saig_ManBmcGroupStop( p, -1 );
+            return;
+        }
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the groups taken from the shared queue.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Saig_ManBmcGroupThread( void * pUser, int iThread )
+{
+    Saig_Bmc3Par_t * p = (Saig_Bmc3Par_t *)pUser;
+    int iGroup;
+    while ( !Util_AtomicRead(&p->fStop) && (iGroup = Util_AtomicAdd(&p->iNext, 1)) < Vec_PtrSize(p->vGroups) )
+        Saig_ManBmcGroupSolve( p, (Saig_Bmc3Grp_t *)Vec_PtrEntry(p->vGroups, iGroup) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Bounded model checking engine solving groups of outputs on several threads.]
+
+  Description [Returns the same values and fills in the same fields of 
+  the parameter structure and the AIG as Saig_ManBmcScalable().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Saig_ManBmcScalablePar( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
+{
+    Saig_Bmc3Par_t Par, * p = &Par;
+    Saig_Bmc3Grp_t * pGrp;
+    Util_Pool_t * pPool;
+    Aig_Obj_t * pObj;
+    Vec_Int_t * vOuts;
+    int nProcs = Abc_MinInt( pPars->nProcs, UTIL_PROC_MAX );
+    int nGroups = Abc_MinInt( Saig_ManPoNum(pAig), 4 * nProcs );
+    int i, g, f, nNodes = 0;
+    double nVars, nClas, nConfs, nUnis, nMem;
+    abctime clk, clkTotal = Util_WallClock();
+    abctime nTimeCnf = 0, nTimeUnsat = 0, nTimeSat = 0, nTimeUndec = 0;
+    // prepare the manager
+    memset( p, 0, sizeof(Saig_Bmc3Par_t) );
+    p->pAig         = pAig;
+    p->pPars        = pPars;
+    p->ParsGrp      = *pPars;
+    p->ParsGrp.fVerbose = 0;
+    p->nOutDigits   = Abc_Base10Log( Saig_ManPoNum(pAig) );
+    p->RetValue     = -1;
+    p->iOutBest     = -1;
+    p->nTimeToStop  = pPars->nTimeOut ? pPars->nTimeOut * CLOCKS_PER_SEC + Util_WallClock() : 0;
+    p->pLock        = Util_LockStart();
+    if ( pPars->fSolveAll )
+        p->vCexes = Vec_PtrStart( Saig_ManPoNum(pAig) );
+    // create groups of consecutive outputs
+    clk = Abc_Clock();
+    p->vGroups = Vec_PtrAlloc( nGroups );
+    for ( g = 0; g < nGroups; g++ )
+    {
+        vOuts = Vec_IntAlloc( Saig_ManPoNum(pAig) / nGroups + 1 );
+        for ( i = g * Saig_ManPoNum(pAig) / nGroups; i < (g + 1) * Saig_ManPoNum(pAig) / nGroups; i++ )
+            Vec_IntPush( vOuts, i );
+        pGrp = ABC_CALLOC( Saig_Bmc3Grp_t, 1 );
+        pGrp->vOuts = vOuts;
+        pGrp->pMan  = Saig_Bmc3ManStart( Saig_ManBmcDupOutputs(pAig, vOuts), 0 );
+        pGrp->pMan->pPars = &p->ParsGrp;
+        pGrp->pMan->pSat->nLearntStart = pPars->nLearnedStart;
+        pGrp->pMan->pSat->nLearntDelta = pPars->nLearnedDelta;
+        pGrp->pMan->pSat->nLearntRatio = pPars->nLearnedPerce;
+        pGrp->pMan->pSat->nLearntMax   = pGrp->pMan->pSat->nLearntStart;
+        pGrp->pMan->pSat->pStop        = &pGrp->fStop;
+        sat_solver_set_runtime_limit_wall( pGrp->pMan->pSat, p->nTimeToStop );
+        sat_solver_set_lbd_mode( pGrp->pMan->pSat, pPars->fLbdMode );
+        nNodes += Aig_ManNodeNum( pGrp->pMan->pAig );
+        Vec_PtrPush( p->vGroups, pGrp );
+    }
+    nTimeCnf += Abc_Clock() - clk;
+    if ( pPars->fVerbose )
+    {
+        Abc_Print( 1, "Running \"bmc3\". PI/PO/Reg = %d/%d/%d. And =%7d. Lev =%6d.\n", 
+            Saig_ManPiNum(pAig), Saig_ManPoNum(pAig), Saig_ManRegNum(pAig), Aig_ManNodeNum(pAig), Aig_ManLevelNum(pAig) );
+        Abc_Print( 1, "Params: FramesMax = %d. Start = %d. ConfLimit = %d. TimeOut = %d. SolveAll = %d.\n", 
+            pPars->nFramesMax, pPars->nStart, pPars->nConfLimit, pPars->nTimeOut, pPars->fSolveAll );
+        Abc_Print( 1, "Solving %d groups of outputs using %d threads. The cones of the groups have %d nodes.\n", 
+            nGroups, nProcs, nNodes );
+    } 
+    pPars->nFramesMax = pPars->nFramesMax ? pPars->nFramesMax : ABC_INFINITY;
+    pPars->timeLastSolved = Abc_Clock();
+    pPool = Util_PoolStart( nProcs );
+    for ( f = 0; f < pPars->nFramesMax; f++ )
+    {
+        // stop BMC after exploring all reachable states
+        if ( Aig_ManRegNum(pAig) < 30 && f == (1 << Aig_ManRegNum(pAig)) )
+        {
+            Abc_Print( 1, "Stopping BMC because all 2^%d reachable states are visited.\n", Aig_ManRegNum(pAig) );
+            if ( pPars->fUseBridge )
+                Saig_ManForEachPo( pAig, pObj, i )
+                    if ( !(p->vCexes && Vec_PtrEntry(p->vCexes, i)) )
+                        Gia_ManToBridgeResult( stdout, 1, NULL, i );
+            p->RetValue = pPars->nFailOuts ? 0 : 1;
+            break;
+        }
+        // stop BMC if all targets are solved
+        if ( pPars->fSolveAll && pPars->nFailOuts >= Saig_ManPoNum(pAig) )
+        {
+            Abc_Print( 1, "Stopping BMC because all targets are disproved or timed out.\n" );
+            p->RetValue = pPars->nFailOuts ? 0 : 1;
+            break;
+        }
+        // consider the next timeframe
+        if ( (p->RetValue == -1 || pPars->fSolveAll) && pPars->nStart == 0 )
+            pPars->iFrame = f-1;
+        // solve the groups
+        p->iFrame = f;
+        p->iNext  = 0;
+        Util_PoolRun( pPool, Saig_ManBmcGroupThread, p );
+        if ( p->fStop || p->iOutBest >= 0 )
+            break;
+        if ( pPars->fVerbose ) 
+        {
+            nVars = nClas = nConfs = nUnis = nMem = 0;
+            Vec_PtrForEachEntry( Saig_Bmc3Grp_t *, p->vGroups, pGrp, g )
+            {
+                nVars  += pGrp->pMan->nSatVars;
+                nClas  += pGrp->pMan->pSat->stats.clauses;
+                nConfs += pGrp->pMan->pSat->stats.conflicts;
+                nUnis  += sat_solver_count_assigned(pGrp->pMan->pSat);
+                nMem   += sat_solver_memory(pGrp->pMan->pSat);
+            }
+            Abc_Print( 1, "%4d %s : ", f, "+" );
+            Abc_Print( 1, "Var =%8.0f. ", nVars );
+            Abc_Print( 1, "Cla =%9.0f. ", nClas );
+            Abc_Print( 1, "Conf =%7.0f. ",nConfs );
+            Abc_Print( 1, "Uni =%7.0f. ", nUnis );
+            if ( pPars->fSolveAll )
+                Abc_Print( 1, "CEX =%5d. ", pPars->nFailOuts );
+            Abc_Print( 1, "%4.0f MB",     1.0*nMem/(1<<20) );
+            Abc_Print( 1, "%9.2f sec ",  1.0*(Util_WallClock() - clkTotal)/CLOCKS_PER_SEC );
+            Abc_Print( 1, "\n" );
+            fflush( stdout );
+        }
+    }
+    Util_PoolStop( pPool );
+    // consider the next timeframe
+    if ( !p->fStop && p->RetValue == -1 && pPars->nStart == 0 && f == pPars->nFramesMax )
+        pPars->iFrame = f-1;
+    if ( p->fTimeout && !pPars->fSilent )
+        Abc_Print( 1, "Reached timeout (%d seconds).\n",  pPars->nTimeOut );
+    if ( p->fCallback )
+        Abc_Print( 1, "Quitting due to callback on fail.\n" );
+    // collect statistics and clean up
+    Vec_PtrForEachEntry( Saig_Bmc3Grp_t *, p->vGroups, pGrp, g )
+    {
+        Aig_Man_t * pTemp = pGrp->pMan->pAig;
+        nTimeCnf   += pGrp->timeCnf;
+        nTimeUnsat += pGrp->timeUnsat;
+        nTimeSat   += pGrp->timeSat;
+        nTimeUndec += pGrp->timeUndec;
+        Saig_Bmc3ManStop( pGrp->pMan );
+        Aig_ManStop( pTemp );
+        Vec_IntFree( pGrp->vOuts );
+        ABC_FREE( pGrp );
+    }
+    Vec_PtrFree( p->vGroups );
+    Util_LockStop( p->pLock );
+    if ( pPars->fVerbose )
+    {
+        Abc_Print( 1, "Runtime summed over threads:  " );
+        Abc_Print( 1, "CNF = %.1f sec  ",   1.0*nTimeCnf/CLOCKS_PER_SEC );
+        Abc_Print( 1, "UNSAT = %.1f sec  ", 1.0*nTimeUnsat/CLOCKS_PER_SEC );
+        Abc_Print( 1, "SAT = %.1f sec  ",   1.0*nTimeSat/CLOCKS_PER_SEC );
+        Abc_Print( 1, "UNDEC = %.1f sec",   1.0*nTimeUndec/CLOCKS_PER_SEC );
+        Abc_Print( 1, "\n" );
+    }
+    if ( p->vCexes )
+    {
+        assert( pAig->vSeqModelVec == NULL );
+        pAig->vSeqModelVec = p->vCexes;
+    }
+    fflush( stdout );
+    return p->RetValue;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                    PIPELINED SOLVING                             ///
+////////////////////////////////////////////////////////////////////////
+
+// One thread unrolls the frames: it runs the ternary simulation and 
+// derives the CNF of all outputs of the frame, using the code above, 
+// except that the new clauses are collected instead of being added to 
+// the solver. The other thread loads the clauses and solves the outputs. 
+// The frames pass through a bounded queue with one producer and one 
+// consumer, so the unroller may be up to SAIG_PIPE_SIZE frames ahead. 
+// The consumer owns only the SAT solver of the BMC manager.
+
+#define SAIG_PIPE_SIZE 4
+
+typedef struct Saig_Bmc3Frame_t_ Saig_Bmc3Frame_t;
+struct Saig_Bmc3Frame_t_
+{
+    int               iFrame;      // the time frame
+    int               nSatVars;    // the number of SAT variables after this frame
+    Vec_Int_t *       vClauses;    // the new clauses (the number of literals followed by the literals)
+    Vec_Int_t *       vPiLits;     // pairs (unrolled PI, literal) for the new PIs
+    Vec_Int_t *       vOuts;       // the output literals (empty before the starting frame)
+    abctime           clkUnroll;   // the time to unroll this frame
+};
+
+typedef struct Saig_Bmc3Pipe_t_ Saig_Bmc3Pipe_t;
+struct Saig_Bmc3Pipe_t_
+{
+    Aig_Man_t *       pAig;        // user AIG
+    Saig_ParBmc_t *   pPars;       // user parameters
+    Gia_ManBmc_t *    pMan;        // BMC manager
+    Vec_Int_t *       vPiLits;     // the literals of the unrolled PIs (owned by the consumer)
+    int               fParallel;   // the producer runs on its own thread
+    int               RetValue;    // the result of the consumer
+    abctime           clkStart;    // the starting wall-clock time
+    abctime           nTimeToStop; // the wall-clock time to stop
+    abctime           clkUnroll;   // the time spent by the producer
+    abctime           clkWait;     // the time the consumer waited for frames
+    // the queue
+    Saig_Bmc3Frame_t *pQueue[SAIG_PIPE_SIZE];
+    volatile int      iHead;       // the number of frames taken by the consumer
+    volatile int      iTail;       // the number of frames added by the producer
+    volatile int      fDone;       // the producer has no more frames
+    volatile int      fStop;       // the consumer needs no more frames
+};
+
+/**Function*************************************************************
+
+  Synopsis    [Deletes one frame.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Saig_Bmc3FrameFree( Saig_Bmc3Frame_t * pFrame )
+{
+    Vec_IntFree( pFrame->vClauses );
+    Vec_IntFree( pFrame->vPiLits );
+    Vec_IntFree( pFrame->vOuts );
+    ABC_FREE( pFrame );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Unrolls one frame and derives CNF for its outputs.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Saig_Bmc3Frame_t * Saig_ManBmcPipeProduce( Saig_Bmc3Pipe_t * p, int f )
+{
+    Gia_ManBmc_t * pMan = p->pMan;
+    Saig_Bmc3Frame_t * pFrame;
+    Aig_Obj_t * pObj;
+    int i;
+    abctime clk = Abc_Clock();
+    pFrame = ABC_CALLOC( Saig_Bmc3Frame_t, 1 );
+    pFrame->iFrame   = f;
+    pFrame->vClauses = pMan->vClauses = Vec_IntAlloc( 1000 );
+    pFrame->vPiLits  = pMan->vPiLits  = Vec_IntAlloc( 100 );
+    pFrame->vOuts    = Vec_IntAlloc( Saig_ManPoNum(p->pAig) );
+    Saig_ManBmcStartFrame( pMan, f );
+    if ( f >= p->pPars->nStart )
+        Saig_ManForEachPo( p->pAig, pObj, i )
+            Vec_IntPush( pFrame->vOuts, Saig_ManBmcCreateCnf(pMan, pObj, f) );
+    pFrame->nSatVars  = pMan->nSatVars;
+    pFrame->clkUnroll = Abc_Clock() - clk;
+    p->clkUnroll     += pFrame->clkUnroll;
+    return pFrame;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Queue operations.]
+
+  Description [Only the producer writes iTail and only the consumer 
+  writes iHead, as in Gia_ManBmcPerformPipe().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Saig_ManBmcPipeProducer( Saig_Bmc3Pipe_t * p )
+{
+    int f;
+    for ( f = 0; f < p->pPars->nFramesMax; f++ )
+    {
+        Saig_Bmc3Frame_t * pFrame = Saig_ManBmcPipeProduce( p, f );
+        while ( p->iTail - Util_AtomicRead(&p->iHead) == SAIG_PIPE_SIZE && !Util_AtomicRead(&p->fStop) )
+            Util_ThreadSleep( 100 );
+        if ( Util_AtomicRead(&p->fStop) )
+        {
+            Saig_Bmc3FrameFree( pFrame );
+            break;
+        }
+        p->pQueue[p->iTail % SAIG_PIPE_SIZE] = pFrame;
+        Util_AtomicWrite( &p->iTail, p->iTail + 1 );
+    }
+    Util_AtomicWrite( &p->fDone, 1 );
+}
+Saig_Bmc3Frame_t * Saig_ManBmcPipeConsume( Saig_Bmc3Pipe_t * p )
+{
+    Saig_Bmc3Frame_t * pFrame;
+    abctime clk = Util_WallClock();
+    if ( p->nTimeToStop && clk > p->nTimeToStop )
+        return NULL;
+    if ( !p->fParallel ) // the same thread produces and consumes
+        return p->iHead < p->pPars->nFramesMax ? Saig_ManBmcPipeProduce( p, p->iHead++ ) : NULL;
+    while ( Util_AtomicRead(&p->iTail) == p->iHead )
+    {
+        if ( Util_AtomicRead(&p->fDone) && Util_AtomicRead(&p->iTail) == p->iHead )
+            return NULL;
+        if ( p->nTimeToStop && Util_WallClock() > p->nTimeToStop )
+            return NULL;
+        Util_ThreadSleep( 100 );
+    }
+    pFrame = p->pQueue[p->iHead % SAIG_PIPE_SIZE];
+    Util_AtomicWrite( &p->iHead, p->iHead + 1 );
+    p->clkWait += Util_WallClock() - clk;
+    return pFrame;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Generates the counter-example from the consumer's PI literals.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Cex_t * Saig_ManBmcPipeCex( Saig_Bmc3Pipe_t * p, int f, int iPo )
+{
+    Abc_Cex_t * pCex = Abc_CexMakeTriv( Aig_ManRegNum(p->pAig), Saig_ManPiNum(p->pAig), Saig_ManPoNum(p->pAig), f*Saig_ManPoNum(p->pAig)+iPo );
+    int i, iLit;
+    Vec_IntForEachEntryStop( p->vPiLits, iLit, i, Abc_MinInt(Vec_IntSize(p->vPiLits), (f+1)*Saig_ManPiNum(p->pAig)) )
+        if ( iLit > 0 && sat_solver_var_value(p->pMan->pSat, lit_var(iLit)) )
+            Abc_InfoSetBit( pCex->pData, Saig_ManRegNum(p->pAig) + i );
+    return pCex;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the frames coming from the unroller.]
+
+  Description [Follows the frame loop of Saig_ManBmcScalable().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Saig_ManBmcPipeConsumer( Saig_Bmc3Pipe_t * p )
+{
+    Saig_ParBmc_t * pPars = p->pPars;
+    Gia_ManBmc_t * pMan = p->pMan;
+    Aig_Man_t * pAig = p->pAig;
+    Saig_Bmc3Frame_t * pFrame;
+    Abc_Cex_t * pCexNew, * pCexNew0;
+    Aig_Obj_t * pObj;
+    int nOutDigits = Abc_Base10Log( Saig_ManPoNum(pAig) );
+    int i, k, f, Lit, status, RetValue = -1, fStop = 0;
+    while ( !fStop && (pFrame = Saig_ManBmcPipeConsume(p)) )
+    {
+        f = pFrame->iFrame;
+        // stop BMC after exploring all reachable states
+        if ( Aig_ManRegNum(pAig) < 30 && f == (1 << Aig_ManRegNum(pAig)) )
+        {
+            if ( !pPars->fSilent )
+            Abc_Print( 1, "Stopping BMC because all 2^%d reachable states are visited.\n", Aig_ManRegNum(pAig) );
+            if ( pPars->fUseBridge )
+                Saig_ManForEachPo( pAig, pObj, i )
+                    if ( !(pMan->vCexes && Vec_PtrEntry(pMan->vCexes, i)) )
+                        Gia_ManToBridgeResult( stdout, 1, NULL, i );
+            RetValue = pPars->nFailOuts ? 0 : 1;
+            Saig_Bmc3FrameFree( pFrame );
+            break;
+        }
+        // stop BMC if all targets are solved
+        if ( pPars->fSolveAll && pPars->nFailOuts >= Saig_ManPoNum(pAig) )
+        {
+            Abc_Print( 1, "Stopping BMC because all targets are disproved or timed out.\n" );
+            RetValue = pPars->nFailOuts ? 0 : 1;
+            Saig_Bmc3FrameFree( pFrame );
+            break;
+        }
+        // consider the next timeframe
+        if ( (RetValue == -1 || pPars->fSolveAll) && pPars->nStart == 0 )
+            pPars->iFrame = f-1;
+        // load the clauses and remember the PI literals
+        if ( pFrame->nSatVars > sat_solver_nvars(pMan->pSat) )
+            sat_solver_setnvars( pMan->pSat, pFrame->nSatVars );
+        for ( i = 0; i < Vec_IntSize(pFrame->vClauses); i += Vec_IntEntry(pFrame->vClauses, i) + 1 )
+            if ( !sat_solver_addclause( pMan->pSat, Vec_IntEntryP(pFrame->vClauses, i+1), Vec_IntEntryP(pFrame->vClauses, i+1) + Vec_IntEntry(pFrame->vClauses, i) ) )
+                assert( 0 );
+        for ( i = 0; i + 1 < Vec_IntSize(pFrame->vPiLits); i += 2 )
+            Vec_IntSetEntry( p->vPiLits, Vec_IntEntry(pFrame->vPiLits, i), Vec_IntEntry(pFrame->vPiLits, i+1) );
+        // solve the outputs
+        Vec_IntForEachEntry( pFrame->vOuts, Lit, i )
+        {
+            // check for timeout
+            if ( p->nTimeToStop && Util_WallClock() > p->nTimeToStop )
+            {
+                if ( !pPars->fSilent )
+                    Abc_Print( 1, "Reached timeout (%d seconds).\n",  pPars->nTimeOut );
+                fStop = 1;
+                break;
+            }
+            if ( pPars->pFuncStop && pPars->pFuncStop(pPars->RunId) )
+            {
+                if ( !pPars->fSilent )
+                    Abc_Print( 1, "Bmc3 was interrupted by the callback.\n" );
+                fStop = 1;
+                break;
+            }
+            // skip solved outputs
+            if ( pMan->vCexes && Vec_PtrEntry(pMan->vCexes, i) )
+                continue;
+            // solve this output
+            sat_solver_compress( pMan->pSat );
+            status = Saig_ManCallSolver( pMan, Lit );
+            if ( status == l_False )
+            {
+                Saig_ManBmcAddUnsatOutput( pMan, Lit );
+                if ( pPars->fUseBridge )
+                    Gia_ManReportProgress( stdout, i, f );
+                if ( pPars->pFuncOnFrameDone )
+                    pPars->pFuncOnFrameDone( f, i, 1 );
+            }
+            else if ( status == l_True )
+            {
+                RetValue = 0;
+                if ( !pPars->fSolveAll )
+                {
+                    ABC_FREE( pAig->pSeqModel );
+                    pAig->pSeqModel = Saig_ManBmcPipeCex( p, f, i );
+                    fStop = 1;
+                    break;
+                }
+                pPars->nFailOuts++;
+                if ( !pPars->fNotVerbose )
+                    Abc_Print( 1, "Output %*d was asserted in frame %2d (solved %*d out of %*d outputs).\n",  
+                        nOutDigits, i, f, nOutDigits, pPars->nFailOuts, nOutDigits, Saig_ManPoNum(pAig) );
+                pCexNew = (pPars->fUseBridge || pPars->fStoreCex) ? Saig_ManBmcPipeCex( p, f, i ) : (Abc_Cex_t *)(ABC_PTRINT_T)1;
+                pCexNew0 = NULL;
+                if ( pPars->fUseBridge )
+                {
+                    Gia_ManToBridgeResult( stdout, 0, pCexNew, pCexNew->iPo );
+                    pCexNew0 = pCexNew; 
+                    pCexNew = (Abc_Cex_t *)(ABC_PTRINT_T)1;
+                }
+                Vec_PtrWriteEntry( pMan->vCexes, i, Abc_CexDup(pCexNew, Saig_ManRegNum(pAig)) ); 
+                if ( pPars->pFuncOnFail && pPars->pFuncOnFail(i, pPars->fStoreCex ? (Abc_Cex_t *)Vec_PtrEntry(pMan->vCexes, i) : NULL) )
+                {
+                    Abc_CexFreeP( &pCexNew0 );
+                    Abc_Print( 1, "Quitting due to callback on fail.\n" );
+                    fStop = 1;
+                    break;
+                }
+                pPars->timeLastSolved = Abc_Clock();
+                // check if other outputs failed under the same counter-example
+                Vec_IntForEachEntry( pFrame->vOuts, Lit, k )
+                {
+                    // skip solved outputs
+                    if ( Vec_PtrEntry(pMan->vCexes, k) )
+                        continue;
+                    // check if this output is solved
+                    if ( Lit == 0 || (Lit > 1 && sat_solver_var_value(pMan->pSat, lit_var(Lit)) == Abc_LitIsCompl(Lit)) )
+                        continue;
+                    // write entry
+                    pPars->nFailOuts++;
+                    if ( !pPars->fNotVerbose )
+                        Abc_Print( 1, "Output %*d was asserted in frame %2d (solved %*d out of %*d outputs).\n",  
+                            nOutDigits, k, f, nOutDigits, pPars->nFailOuts, nOutDigits, Saig_ManPoNum(pAig) );
+                    // report to the bridge
+                    if ( pPars->fUseBridge )
+                    {
+                        pCexNew0->iPo = k;
+                        Gia_ManToBridgeResult( stdout, 0, pCexNew0, pCexNew0->iPo );
+                    }
+                    // remember solved output
+                    Vec_PtrWriteEntry( pMan->vCexes, k, Abc_CexDup(pCexNew, Saig_ManRegNum(pAig)) );
+                }
+                Abc_CexFreeP( &pCexNew0 );
+                Abc_CexFree( pCexNew );
+            }
+            else 
+            {
+                assert( status == l_Undef );
+                fStop = 1;
+                break;
+            }
+        }
+        if ( pPars->fVerbose && (!fStop || (RetValue == 0 && !pPars->fSolveAll)) )
+        {
+            Abc_Print( 1, "%4d + : ", f );
+            Abc_Print( 1, "Var =%8.0f. ", (double)pFrame->nSatVars );
+            Abc_Print( 1, "Cla =%9.0f. ", (double)pMan->pSat->stats.clauses );
+            Abc_Print( 1, "Conf =%7.0f. ",(double)pMan->pSat->stats.conflicts );
+            Abc_Print( 1, "Uni =%7.0f. ",(double)sat_solver_count_assigned(pMan->pSat) );
+            if ( pPars->fSolveAll )
+                Abc_Print( 1, "CEX =%5d. ", pPars->nFailOuts );
+            Abc_Print( 1, "%4.0f MB",     4.0*(f+1)*pMan->nObjNums /(1<<20) );
+            Abc_Print( 1, "%4.0f MB",     1.0*sat_solver_memory(pMan->pSat)/(1<<20) );
+            Abc_Print( 1, "  Unr =%6.2f sec ", 1.0*pFrame->clkUnroll/CLOCKS_PER_SEC );
+            Abc_Print( 1, "%9.2f sec ",  1.0*(Util_WallClock() - p->clkStart)/CLOCKS_PER_SEC );
+            Abc_Print( 1, "\n" );
+            fflush( stdout );
+        }
+        if ( !fStop && pPars->nStart == 0 )
+            pPars->iFrame = f;
+        Saig_Bmc3FrameFree( pFrame );
+    }
+    if ( !fStop && RetValue == -1 && p->nTimeToStop && Util_WallClock() > p->nTimeToStop && !pPars->fSilent )
+        Abc_Print( 1, "Reached timeout (%d seconds).\n",  pPars->nTimeOut );
+    Util_AtomicWrite( &p->fStop, 1 );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Bounded model checking with unrolling and solving on two threads.]
+
+  Description [The producer and the consumer share the BMC manager: 
+  the producer uses its unrolling and the consumer uses its solver.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Saig_ManBmcPipeThread( void * pUser, int iThread )
+{
+    Saig_Bmc3Pipe_t * p = (Saig_Bmc3Pipe_t *)pUser;
+    if ( iThread == 0 )
+        p->RetValue = Saig_ManBmcPipeConsumer( p );
+    else
+        Saig_ManBmcPipeProducer( p );
+}
+int Saig_ManBmcScalablePipe( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
+{
+    Saig_Bmc3Pipe_t Pipe, * p = &Pipe;
+    Util_Pool_t * pPool;
+    memset( p, 0, sizeof(Saig_Bmc3Pipe_t) );
+    p->pAig        = pAig;
+    p->pPars       = pPars;
+    p->pMan        = Saig_Bmc3ManStart( pAig, 0 );
+    p->pMan->pPars = pPars;
+    p->pMan->pSat->nLearntStart = pPars->nLearnedStart;
+    p->pMan->pSat->nLearntDelta = pPars->nLearnedDelta;
+    p->pMan->pSat->nLearntRatio = pPars->nLearnedPerce;
+    p->pMan->pSat->nLearntMax   = p->pMan->pSat->nLearntStart;
+    p->pMan->pSat->pStop        = pPars->pStop;
+    sat_solver_set_lbd_mode( p->pMan->pSat, pPars->fLbdMode );
+    if ( pPars->fSolveAll )
+        p->pMan->vCexes = Vec_PtrStart( Saig_ManPoNum(pAig) );
+    p->vPiLits     = Vec_IntAlloc( 1000 );
+    p->fParallel   = Util_PoolIsParallel();
+    p->clkStart    = Util_WallClock();
+    p->nTimeToStop = pPars->nTimeOut ? pPars->nTimeOut * CLOCKS_PER_SEC + p->clkStart : 0;
+    if ( pPars->fVerbose )
+    {
+        Abc_Print( 1, "Running \"bmc3\". PI/PO/Reg = %d/%d/%d. And =%7d. Lev =%6d. ObjNums =%6d.\n", 
+            Saig_ManPiNum(pAig), Saig_ManPoNum(pAig), Saig_ManRegNum(pAig),
+            Aig_ManNodeNum(pAig), Aig_ManLevelNum(pAig), p->pMan->nObjNums );
+        Abc_Print( 1, "Params: FramesMax = %d. Start = %d. ConfLimit = %d. TimeOut = %d. SolveAll = %d. Unrolling %s.\n", 
+            pPars->nFramesMax, pPars->nStart, pPars->nConfLimit, pPars->nTimeOut, pPars->fSolveAll, 
+            p->fParallel ? "on its own thread" : "on the solver thread" );
+    } 
+    pPars->nFramesMax = pPars->nFramesMax ? pPars->nFramesMax : ABC_INFINITY;
+    if ( p->nTimeToStop )
+        sat_solver_set_runtime_limit_wall( p->pMan->pSat, p->nTimeToStop );
+    Aig_ManRandom( 1 );
+    pPars->timeLastSolved = Abc_Clock();
+    if ( p->fParallel )
+    {
+        pPool = Util_PoolStart( 2 );
+        Util_PoolRun( pPool, Saig_ManBmcPipeThread, p );
+        Util_PoolStop( pPool );
+    }
+    else
+        p->RetValue = Saig_ManBmcPipeConsumer( p );
+    if ( pPars->fVerbose )
+    {
+        Abc_Print( 1, "Unrolling and CNF generation = %.2f sec.  Solver waiting for frames = %.2f sec.  ", 
+            1.0*p->clkUnroll/CLOCKS_PER_SEC, 1.0*p->clkWait/CLOCKS_PER_SEC );
+        Abc_PrintTime( 1, "Total time", Util_WallClock() - p->clkStart );
+    }
+    // free the frames left in the queue
+    while ( p->iHead < p->iTail )
+        Saig_Bmc3FrameFree( p->pQueue[p->iHead++ % SAIG_PIPE_SIZE] );
+    // the clause buffers belonged to the frames
+    p->pMan->vClauses = NULL;
+    p->pMan->vPiLits  = NULL;
+    Saig_Bmc3ManStop( p->pMan );
+    Vec_IntFree( p->vPiLits );
+    fflush( stdout );
+    return p->RetValue;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
@@ -22,6 +22,7 @@
 #include "aig/gia/giaAig.h"
 #include "sat/bsat/satStore.h"
 #include "sat/cnf/cnf.h"
+#include "misc/util/utilPth.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -45,6 +46,50 @@ struct Bmc_Mna_t_
     abctime             clkStart; // starting time
 };
 
+#define BMC_PIPE_SIZE 4  // the number of frames the unroller can be ahead
+
+// the CNF of one time frame passed from the unroller to the solver
+typedef struct Bmc_MnaFrame_t_ Bmc_MnaFrame_t; 
+struct Bmc_MnaFrame_t_
+{
+    int                 iFrame;   // the time frame
+    int                 nSatVars; // the number of SAT variables after this frame
+    int                 nAigAnds; // the number of AND nodes in the unrolling
+    int                 nIns;     // the number of inputs of the new cone
+    int                 nNodes;   // the number of internal nodes of the new cone
+    Cnf_Dat_t *         pCnf;     // clauses of the new cone in terms of SAT variables
+    Vec_Int_t *         vOuts;    // SAT literals of the frame's outputs (-1 for constant 0)
+    Vec_Int_t *         vPis;     // pairs (unrolled PI, SAT variable) for the new PIs
+    abctime             clkUnroll;// time to build this frame
+};
+
+// pipelined BMC: one thread unrolls the frames and derives their CNF,
+// while the other thread solves the frames received through a lock-free
+// single-producer single-consumer queue
+typedef struct Bmc_MnaPipe_t_ Bmc_MnaPipe_t; 
+struct Bmc_MnaPipe_t_
+{
+    Gia_Man_t *         pGia;     // user AIG
+    Bmc_AndPar_t *      pPars;    // parameters
+    Bmc_Mna_t *         pMna;     // the solver (owned by the consumer) and the CNF data (owned by the producer)
+    Unr_Man_t *         pUnroll;  // unrolling manager (owned by the producer)
+    Vec_Int_t *         vPiVars;  // SAT variables of the unrolled PIs (owned by the consumer)
+    int                 nFramesMax; // the max number of frames
+    int                 fParallel;  // the producer runs on its own thread
+    abctime             nTimeToStop;// wall-clock time to stop
+    int                 RetValue;   // the result returned by the consumer
+    abctime             clkStart;   // wall-clock starting time
+    abctime             clkUnroll;  // time spent by the producer
+    abctime             clkWait;    // time the consumer waited for the producer
+    // the queue
+    Bmc_MnaFrame_t *    pQueue[BMC_PIPE_SIZE];
+    volatile int        iHead;    // the number of frames taken by the consumer
+    volatile int        iTail;    // the number of frames added by the producer
+    volatile int        fDone;    // the producer has no more frames
+    volatile int        fStop;    // the consumer does not need more frames
+};
+
+
 static inline int Gia_ManTerSimInfoGet( unsigned * pInfo, int i )
 {
     return 3 & (pInfo[i >> 4] >> ((i & 15) << 1));
@@ -480,9 +525,6 @@ int Gia_ManBmcAssignVarIds( Bmc_Mna_t * p, Vec_Int_t * vIns, Vec_Int_t * vUsed,
         assert( Vec_IntEntry( p->vId2Var, iObj ) == 0 );
         Vec_IntWriteEntry( p->vId2Var, iObj, p->nSatVars++ );
     }
-    // extend the SAT solver
-    if ( p->nSatVars > sat_solver_nvars(p->pSat) )
-        sat_solver_setnvars( p->pSat, p->nSatVars );
     return VarC0;
 }
 
@@ -490,14 +532,16 @@ int Gia_ManBmcAssignVarIds( Bmc_Mna_t * p, Vec_Int_t * vIns, Vec_Int_t * vUsed,
 
   Synopsis    [Derives CNF for the given cone.]
 
-  Description []
+  Description [Assigns SAT variables to the new objects of the cone and 
+  returns the clauses expressed in terms of SAT variables. Does not use 
+  the SAT solver, so it can be called while the solver is busy.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void Gia_ManBmcAddCnf( Bmc_Mna_t * p, Gia_Man_t * pGia, Vec_Int_t * vIns, Vec_Int_t * vNodes, Vec_Int_t * vOuts )
+Cnf_Dat_t * Gia_ManBmcDeriveCnf( Bmc_Mna_t * p, Gia_Man_t * pGia, Vec_Int_t * vIns, Vec_Int_t * vNodes, Vec_Int_t * vOuts )
 {
     Gia_Man_t * pNew = Gia_ManBmcDupCone( pGia, vIns, vNodes, vOuts );
     Aig_Man_t * pAig = Gia_ManToAigSimple( pNew );
@@ -540,6 +584,28 @@ void Gia_ManBmcAddCnf( Bmc_Mna_t * p, Gia_Man_t * pGia, Vec_Int_t * vIns, Vec_In
         pCnf->pClauses[0][i] = Abc_Lit2LitV( Vec_IntArray(vMap), pCnf->pClauses[0][i] );
     }
     Vec_IntFree( vMap );
+    Aig_ManStop( pAig );
+    Gia_ManStop( pNew );
+    return pCnf;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Loads the clauses into the SAT solver.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManBmcLoadCnf( sat_solver * pSat, Cnf_Dat_t * pCnf, int nSatVars )
+{
+    int i;
+    // extend the SAT solver
+    if ( nSatVars > sat_solver_nvars(pSat) )
+        sat_solver_setnvars( pSat, nSatVars );
     // add clauses
     for ( i = 0; i < pCnf->nClauses; i++ )
     {
@@ -549,14 +615,29 @@ void Gia_ManBmcAddCnf( Bmc_Mna_t * p, Gia_Man_t * pGia, Vec_Int_t * vIns, Vec_In
             printf( "%d ", pCnf->pClauses[i][v] );
         printf( "\n" );
 */
-        if ( !sat_solver_addclause( p->pSat, pCnf->pClauses[i], pCnf->pClauses[i+1] ) )
+        if ( !sat_solver_addclause( pSat, pCnf->pClauses[i], pCnf->pClauses[i+1] ) )
             break;
     }
     if ( i < pCnf->nClauses )
         printf( "SAT solver became UNSAT after adding clauses.\n" );
-    Aig_ManStop( pAig );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives CNF for the given cone and adds it to the solver.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManBmcAddCnf( Bmc_Mna_t * p, Gia_Man_t * pGia, Vec_Int_t * vIns, Vec_Int_t * vNodes, Vec_Int_t * vOuts )
+{
+    Cnf_Dat_t * pCnf = Gia_ManBmcDeriveCnf( p, pGia, vIns, vNodes, vOuts );
+    Gia_ManBmcLoadCnf( p->pSat, pCnf, p->nSatVars );
     Cnf_DataFree( pCnf );
-    Gia_ManStop( pNew );
 }
 
 /**Function*************************************************************
@@ -1052,6 +1133,285 @@ int Gia_ManBmcPerformInt( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
     return RetValue;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Pipelined unrolling and solving.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Bmc_MnaFrameFree( Bmc_MnaFrame_t * pFrame )
+{
+    if ( pFrame->pCnf )
+        Cnf_DataFree( pFrame->pCnf );
+    Vec_IntFree( pFrame->vOuts );
+    Vec_IntFree( pFrame->vPis );
+    ABC_FREE( pFrame );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Unrolls one frame and derives CNF for its new logic.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Bmc_MnaFrame_t * Gia_ManBmcPipeProduce( Bmc_MnaPipe_t * p, int f )
+{
+    Bmc_Mna_t * pMna = p->pMna;
+    Bmc_MnaFrame_t * pFrame;
+    Gia_Obj_t * pObj;
+    int i, nPos = Gia_ManPoNum(p->pGia), nSatVarsOld = pMna->nSatVars;
+    abctime clk = Abc_Clock();
+    pFrame = ABC_CALLOC( Bmc_MnaFrame_t, 1 );
+    pFrame->iFrame = f;
+    pFrame->vOuts  = Vec_IntAlloc( nPos );
+    pFrame->vPis   = Vec_IntAlloc( 2 * Gia_ManPiNum(p->pGia) );
+    pMna->pFrames  = Unr_ManUnrollFrame( p->pUnroll, f );
+    if ( !Gia_ManBmcCheckOutputs( pMna->pFrames, f * nPos, (f+1) * nPos ) )
+    {
+        // create another slice
+        Gia_ManBmcAddCone( pMna, f * nPos, (f+1) * nPos );
+        pFrame->pCnf = Gia_ManBmcDeriveCnf( pMna, pMna->pFrames, pMna->vInputs, pMna->vNodes, pMna->vOutputs );
+        // remember the PIs that received SAT variables
+        Gia_ManForEachObjVec( pMna->vInputs, pMna->pFrames, pObj, i )
+            if ( Gia_ObjIsPi(pMna->pFrames, pObj) && Vec_IntEntry(pMna->vId2Var, Gia_ObjId(pMna->pFrames, pObj)) >= nSatVarsOld )
+                Vec_IntPushTwo( pFrame->vPis, Gia_ObjCioId(pObj), Vec_IntEntry(pMna->vId2Var, Gia_ObjId(pMna->pFrames, pObj)) );
+    }
+    for ( i = f * nPos; i < (f+1) * nPos; i++ )
+    {
+        pObj = Gia_ManPo( pMna->pFrames, i );
+        if ( Gia_ObjChild0(pObj) == Gia_ManConst0(pMna->pFrames) )
+            Vec_IntPush( pFrame->vOuts, -1 );
+        else
+            Vec_IntPush( pFrame->vOuts, Abc_Var2Lit(Vec_IntEntry(pMna->vId2Var, Gia_ObjId(pMna->pFrames, pObj)), 0) );
+    }
+    pFrame->nSatVars  = pMna->nSatVars;
+    pFrame->nAigAnds  = Gia_ManAndNum( pMna->pFrames );
+    pFrame->nIns      = pFrame->pCnf ? Vec_IntSize( pMna->vInputs ) : 0;
+    pFrame->nNodes    = pFrame->pCnf ? Vec_IntSize( pMna->vNodes ) : 0;
+    pFrame->clkUnroll = Abc_Clock() - clk;
+    p->clkUnroll     += pFrame->clkUnroll;
+    return pFrame;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Queue operations.]
+
+  Description [Only the producer writes iTail and only the consumer 
+  writes iHead. Each side makes its slot update visible before moving 
+  its index, so no locks are needed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManBmcPipeProducer( Bmc_MnaPipe_t * p )
+{
+    int f;
+    for ( f = 0; f < p->nFramesMax; f++ )
+    {
+        Bmc_MnaFrame_t * pFrame = Gia_ManBmcPipeProduce( p, f );
+        while ( p->iTail - Util_AtomicRead(&p->iHead) == BMC_PIPE_SIZE && !Util_AtomicRead(&p->fStop) )
+            Util_ThreadSleep( 100 );
+        if ( Util_AtomicRead(&p->fStop) )
+        {
+            Bmc_MnaFrameFree( pFrame );
+            break;
+        }
+        p->pQueue[p->iTail % BMC_PIPE_SIZE] = pFrame;
+        Util_AtomicWrite( &p->iTail, p->iTail + 1 );
+    }
+    Util_AtomicWrite( &p->fDone, 1 );
+}
+Bmc_MnaFrame_t * Gia_ManBmcPipeConsume( Bmc_MnaPipe_t * p )
+{
+    Bmc_MnaFrame_t * pFrame;
+    abctime clk = Util_WallClock();
+    if ( p->nTimeToStop && clk > p->nTimeToStop )
+        return NULL;
+    if ( !p->fParallel ) // the same thread produces and consumes
+        return p->iHead < p->nFramesMax ? Gia_ManBmcPipeProduce( p, p->iHead++ ) : NULL;
+    while ( Util_AtomicRead(&p->iTail) == p->iHead )
+    {
+        if ( Util_AtomicRead(&p->fDone) && Util_AtomicRead(&p->iTail) == p->iHead )
+            return NULL;
+        if ( p->nTimeToStop && Util_WallClock() > p->nTimeToStop )
+            return NULL;
+        Util_ThreadSleep( 100 );
+    }
+    pFrame = p->pQueue[p->iHead % BMC_PIPE_SIZE];
+    Util_AtomicWrite( &p->iHead, p->iHead + 1 );
+    p->clkWait += Util_WallClock() - clk;
+    return pFrame;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Generate counter-example.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Cex_t * Gia_ManBmcPipeCexGen( Bmc_MnaPipe_t * p, int f, int iPo )
+{
+    Abc_Cex_t * pCex;
+    int i, iSatVar;
+    pCex = Abc_CexAlloc( Gia_ManRegNum(p->pGia), Gia_ManPiNum(p->pGia), f + 1 );
+    pCex->iFrame = f;
+    pCex->iPo    = iPo;
+    Vec_IntForEachEntry( p->vPiVars, iSatVar, i )
+        if ( iSatVar > 0 && i < (f + 1) * Gia_ManPiNum(p->pGia) && sat_solver_var_value(p->pMna->pSat, iSatVar) )
+            Abc_InfoSetBit( pCex->pData, Gia_ManRegNum(p->pGia) + i );
+    return pCex;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the frames coming from the unroller.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManBmcPipeConsumer( Bmc_MnaPipe_t * p )
+{
+    Bmc_AndPar_t * pPars = p->pPars;
+    Bmc_MnaFrame_t * pFrame;
+    int i, Lit, status, RetValue = -2;
+    while ( RetValue == -2 && (pFrame = Gia_ManBmcPipeConsume(p)) )
+    {
+        // load the clauses and remember the PI variables
+        if ( pFrame->pCnf )
+            Gia_ManBmcLoadCnf( p->pMna->pSat, pFrame->pCnf, pFrame->nSatVars );
+        for ( i = 0; i + 1 < Vec_IntSize(pFrame->vPis); i += 2 )
+            Vec_IntSetEntry( p->vPiVars, Vec_IntEntry(pFrame->vPis, i), Vec_IntEntry(pFrame->vPis, i+1) );
+        // try solving the outputs
+        Vec_IntForEachEntry( pFrame->vOuts, Lit, i )
+        {
+            if ( Lit == -1 )
+                continue;
+            status = sat_solver_solve( p->pMna->pSat, &Lit, &Lit + 1, (ABC_INT64_T)pPars->nConfLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
+            if ( status == l_False ) // unsat
+                continue;
+            if ( status == l_True )  // sat
+                RetValue = 0;
+            if ( status == l_Undef ) // undecided
+                RetValue = -1;
+            break;
+        }
+        // report statistics
+        if ( pPars->fVerbose )
+        {
+            printf( "%4d :  AIG =%9d.  Var =%8d.  In =%6d.  And =%9d.  Cla =%9d.  Conf =%9d.  Unr =%6.2f sec  ", 
+                pFrame->iFrame, pFrame->nAigAnds, pFrame->nSatVars-1, pFrame->nIns, pFrame->nNodes,
+                sat_solver_nclauses(p->pMna->pSat), sat_solver_nconflicts(p->pMna->pSat), 1.0*pFrame->clkUnroll/CLOCKS_PER_SEC );
+            Abc_PrintTime( 1, "Time", Util_WallClock() - p->clkStart );
+        }
+        if ( RetValue == -1 )
+            printf( "SAT solver reached conflict/runtime limit in frame %d.\n", pFrame->iFrame );
+        else if ( RetValue == 0 )
+        {
+            ABC_FREE( p->pGia->pCexSeq );
+            p->pGia->pCexSeq = Gia_ManBmcPipeCexGen( p, pFrame->iFrame, i );
+            printf( "Output %d of miter \"%s\" was asserted in frame %d.  ", i, Gia_ManName(p->pGia), pFrame->iFrame );
+            Abc_PrintTime( 1, "Time", Util_WallClock() - p->clkStart );
+        }
+        else
+            pPars->iFrame = pFrame->iFrame;
+        Bmc_MnaFrameFree( pFrame );
+    }
+    if ( RetValue == -2 && p->nTimeToStop && Util_WallClock() > p->nTimeToStop )
+        printf( "Reached timeout (%d seconds).\n", pPars->nTimeOut );
+    Util_AtomicWrite( &p->fStop, 1 );
+    return RetValue == -2 ? -1 : RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs BMC with unrolling and solving on two threads.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManBmcPipeThread( void * pUser, int iThread )
+{
+    Bmc_MnaPipe_t * p = (Bmc_MnaPipe_t *)pUser;
+    if ( iThread == 0 )
+        p->RetValue = Gia_ManBmcPipeConsumer( p );
+    else
+        Gia_ManBmcPipeProducer( p );
+}
+int Gia_ManBmcPerformPipe( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
+{
+    Bmc_MnaPipe_t Pipe, * p = &Pipe;
+    Util_Pool_t * pPool;
+    abctime clkStart = Util_WallClock();
+    memset( p, 0, sizeof(Bmc_MnaPipe_t) );
+    p->pGia        = pGia;
+    p->pPars       = pPars;
+    p->pMna        = Bmc_MnaAlloc();
+    p->pUnroll     = Unr_ManUnrollStart( pGia, pPars->fVeryVerbose );
+    p->vPiVars     = Vec_IntAlloc( 1000 );
+    p->clkStart    = clkStart;
+    p->nFramesMax  = pPars->nFramesMax ? pPars->nFramesMax : ABC_INFINITY;
+    p->fParallel   = Util_PoolIsParallel();
+    p->nTimeToStop = pPars->nTimeOut ? pPars->nTimeOut * CLOCKS_PER_SEC + clkStart : 0;
+    // the solver runs on the calling thread, whose CPU time is measured by Abc_Clock()
+    sat_solver_set_runtime_limit( p->pMna->pSat, pPars->nTimeOut ? pPars->nTimeOut * CLOCKS_PER_SEC + Abc_Clock() : 0 );
+    if ( p->fParallel )
+    {
+        pPool = Util_PoolStart( 2 );
+        Util_PoolRun( pPool, Gia_ManBmcPipeThread, p );
+        Util_PoolStop( pPool );
+    }
+    else
+        p->RetValue = Gia_ManBmcPipeConsumer( p );
+    if ( pPars->fVerbose )
+    {
+        printf( "Unrolling and CNF generation = %.2f sec.  Solver waiting for frames = %.2f sec.  ", 
+            1.0*p->clkUnroll/CLOCKS_PER_SEC, 1.0*p->clkWait/CLOCKS_PER_SEC );
+        Abc_PrintTime( 1, "Total time", Util_WallClock() - clkStart );
+    }
+    // free the frames left in the queue
+    while ( p->iHead < p->iTail )
+        Bmc_MnaFrameFree( p->pQueue[p->iHead++ % BMC_PIPE_SIZE] );
+    // dump unfolded frames
+    if ( pPars->fDumpFrames )
+    {
+        Gia_Man_t * pFrames = Gia_ManCleanup( p->pMna->pFrames );
+        Gia_AigerWrite( pFrames, "frames.aig", 0, 0 );
+        printf( "Dumped unfolded frames into file \"frames.aig\".\n" );
+        Gia_ManStop( pFrames );
+    }
+    p->pMna->pFrames = NULL;
+    Unr_ManFree( p->pUnroll );
+    Vec_IntFree( p->vPiVars );
+    Bmc_MnaFree( p->pMna );
+    return p->RetValue;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -1066,6 +1426,8 @@ int Gia_ManBmcPerformInt( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
 int Gia_ManBmcPerform( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
 {
     abctime TimeToStop = pPars->nTimeOut ? pPars->nTimeOut * CLOCKS_PER_SEC + Abc_Clock() : 0;
+    if ( pPars->fPipeline )
+        return Gia_ManBmcPerformPipe( pGia, pPars );
     if ( pPars->nFramesAdd == 0 )
         return Gia_ManBmcPerformInt( pGia, pPars );
     // iterate over the engine until we read the global timeout
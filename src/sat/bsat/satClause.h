@@ -37,6 +37,11 @@ ABC_NAMESPACE_HEADER_START
 #define LEARNT_MAX_START_DEFAULT  10000
 #define LEARNT_MAX_INCRE_DEFAULT   1000
 #define LEARNT_MAX_RATIO_DEFAULT     50
+
+// LBD-based clause management (sat_solver_set_lbd_mode)
+#define LBD_GLUE_DEFAULT              2
+#define LBD_TIER2_DEFAULT             6
+#define LBD_QUEUE_SIZE               50
 
 ////////////////////////////////////////////////////////////////////////
 ///                    STRUCTURE DEFINITIONS                         ///
@@ -51,7 +56,8 @@ struct clause_t
     unsigned   lrn   :   1;
     unsigned   mark  :   1;
     unsigned   partA :   1;
-    unsigned   lbd   :   8;
+    unsigned   lbd   :   7;
+    unsigned   used  :   1;
     unsigned   size  :  21;
     lit        lits[0];
 };
@@ -27,6 +27,7 @@
 #include "misc/vec/vecSet.h"
 #include "aig/aig/aig.h"
 #include "satTruth.h"
+#include "satSolver2.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -926,6 +927,255 @@ void * Proof_DeriveCore( Vec_Set_t * vProof, int hRoot )
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Streaming proof logger.]
+
+  Description [Keeps the proof records in a file on disk instead of memory.
+  Each record is <nEnts><ant1><ant2>...<antN><nEnts>, where antecedents are
+  encoded as in the in-memory proof, but proof nodes are referred to by their
+  1-based record numbers. Only the tail of the proof is buffered in memory.
+  The trailing size allows for reading the records backward when the UNSAT 
+  core is derived, so that the proof never has to be loaded as a whole.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+struct Prf_Log_t_
+{
+    char *        pFileName;       // the file name (NULL for a temporary file)
+    FILE *        pFile;           // the file storing the proof records
+    Vec_Int_t *   vBuffer;         // the records not yet written into the file
+    int           nBufferMax;      // the max number of words in the buffer
+    int           nRecords;        // the number of records
+    iword         nFileWords;      // the number of words in the file
+    // bookmark for rollback
+    int           nRecordsPivot;   // the number of records
+    iword         nWordsPivot;     // the number of words
+    // statistics
+    iword         nWordsTotal;     // the total number of words written
+    int           nFlushes;        // the number of buffer flushes
+};
+
+static inline int Prf_LogSeek( FILE * pFile, iword nWords )
+{
+#ifdef _WIN32
+    return _fseeki64( pFile, (__int64)nWords * sizeof(int), SEEK_SET );
+#else
+    return fseeko( pFile, (off_t)nWords * sizeof(int), SEEK_SET );
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the streaming proof logger.]
+
+  Description [If the file name is not given, the proof is written into 
+  a temporary file, which is removed when the logger is stopped. The file 
+  given by the user is kept.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Prf_Log_t * Prf_LogStart( char * pFileName, int nBufferMax )
+{
+    Prf_Log_t * p;
+    FILE * pFile = pFileName ? fopen( pFileName, "w+b" ) : tmpfile();
+    if ( pFile == NULL )
+    {
+        printf( "Cannot open file \"%s\" for streaming the proof.\n", pFileName ? pFileName : "temporary" );
+        return NULL;
+    }
+    p = ABC_CALLOC( Prf_Log_t, 1 );
+    p->pFileName  = pFileName ? Abc_UtilStrsav( pFileName ) : NULL;
+    p->pFile      = pFile;
+    p->nBufferMax = Abc_MaxInt( nBufferMax, 1000 );
+    p->vBuffer    = Vec_IntAlloc( p->nBufferMax + 1000 );
+    return p;
+}
+void Prf_LogStop( Prf_Log_t * p )
+{
+    if ( p == NULL )
+        return;
+    fclose( p->pFile );
+    Vec_IntFree( p->vBuffer );
+    ABC_FREE( p->pFileName );
+    ABC_FREE( p );
+}
+double Prf_LogMemory( Prf_Log_t * p )
+{
+    return p ? sizeof(Prf_Log_t) + Vec_IntCap(p->vBuffer) * sizeof(int) : 0;
+}
+double Prf_LogFileSize( Prf_Log_t * p )
+{
+    return p ? 1.0 * p->nFileWords * sizeof(int) : 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the buffered records into the file.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Prf_LogFlush( Prf_Log_t * p )
+{
+    int RetValue;
+    if ( Vec_IntSize(p->vBuffer) == 0 )
+        return;
+    Prf_LogSeek( p->pFile, p->nFileWords );
+    RetValue = fwrite( Vec_IntArray(p->vBuffer), sizeof(int), Vec_IntSize(p->vBuffer), p->pFile );
+    if ( RetValue != Vec_IntSize(p->vBuffer) )
+        printf( "Prf_LogFlush(): Writing the proof into the file has failed.\n" );
+    p->nFileWords += Vec_IntSize(p->vBuffer);
+    Vec_IntClear( p->vBuffer );
+    p->nFlushes++;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds one resolution record.]
+
+  Description [Returns the record number to be used as its proof ID.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Prf_LogAppend( Prf_Log_t * p, int * pEnts, int nEnts )
+{
+    int i;
+    assert( nEnts > 0 );
+    assert( p->nRecords < (1 << 29) - 1 );
+    Vec_IntPush( p->vBuffer, nEnts );
+    for ( i = 0; i < nEnts; i++ )
+    {
+        assert( (pEnts[i] & 1) || (pEnts[i] >> 2) <= p->nRecords );
+        Vec_IntPush( p->vBuffer, pEnts[i] );
+    }
+    Vec_IntPush( p->vBuffer, nEnts );
+    p->nWordsTotal += nEnts + 2;
+    if ( Vec_IntSize(p->vBuffer) >= p->nBufferMax )
+        Prf_LogFlush( p );
+    return ++p->nRecords;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Remembers the current state of the proof.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Prf_LogBookmark( Prf_Log_t * p )
+{
+    p->nRecordsPivot = p->nRecords;
+    p->nWordsPivot   = p->nFileWords + Vec_IntSize(p->vBuffer);
+}
+void Prf_LogRollback( Prf_Log_t * p )
+{
+    assert( p->nRecordsPivot <= p->nRecords );
+    if ( p->nWordsPivot >= p->nFileWords )
+        Vec_IntShrink( p->vBuffer, (int)(p->nWordsPivot - p->nFileWords) );
+    else
+    {
+        // the records after the pivot are overwritten by the next flush
+        p->nFileWords = p->nWordsPivot;
+        Vec_IntClear( p->vBuffer );
+    }
+    p->nRecords = p->nRecordsPivot;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes UNSAT core by reading the proof backward.]
+
+  Description [The result is the sorted array of root clause indexes.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Prf_LogDeriveCore( Prf_Log_t * p, int hRoot )
+{
+    Vec_Int_t * vCore, * vChunk;
+    Vec_Bit_t * vMarks;
+    iword iPos = 0;
+    int * pChunk, nChunk, nRead, nEnts, nPending, iRec, k, i;
+    if ( hRoot == -1 )
+        return NULL;
+    assert( hRoot >= 1 && hRoot <= p->nRecords );
+    Prf_LogFlush( p );
+    vCore  = Vec_IntAlloc( 1000 );
+    vMarks = Vec_BitStart( p->nRecords + 1 );
+    vChunk = Vec_IntAlloc( p->nBufferMax );
+    Vec_BitWriteEntry( vMarks, hRoot, 1 );
+    nPending = 1;
+    // read the chunks from the end of the file while there are marked records
+    iRec = p->nRecords;
+    iPos = p->nFileWords;
+    nChunk = p->nBufferMax;
+    while ( nPending > 0 )
+    {
+        assert( iPos > 0 && iRec > 0 );
+        nRead = iPos < nChunk ? (int)iPos : nChunk;
+        Vec_IntGrow( vChunk, nRead );
+        pChunk = Vec_IntArray( vChunk );
+        Prf_LogSeek( p->pFile, iPos - nRead );
+        if ( (int)fread( pChunk, sizeof(int), nRead, p->pFile ) != nRead )
+        {
+            printf( "Prf_LogDeriveCore(): Reading the proof from the file has failed.\n" );
+            Vec_IntFreeP( &vCore );
+            break;
+        }
+        // parse the records completely contained in the chunk
+        for ( k = nRead; k > 0 && nPending > 0; k -= nEnts + 2, iRec-- )
+        {
+            nEnts = pChunk[k-1];
+            assert( nEnts > 0 );
+            if ( nEnts + 2 > k )
+                break;
+            assert( pChunk[k-nEnts-2] == nEnts );
+            if ( !Vec_BitEntry(vMarks, iRec) )
+                continue;
+            nPending--;
+            for ( i = k - nEnts - 1; i < k - 1; i++ )
+                if ( pChunk[i] & 1 ) // root clause
+                    Vec_IntPush( vCore, pChunk[i] >> 2 );
+                else if ( !Vec_BitEntry(vMarks, pChunk[i] >> 2) ) // proof node
+                {
+                    assert( (pChunk[i] >> 2) < iRec );
+                    Vec_BitWriteEntry( vMarks, pChunk[i] >> 2, 1 );
+                    nPending++;
+                }
+        }
+        // read a larger chunk if the record did not fit
+        if ( k == nRead )
+            nChunk *= 2;
+        iPos -= nRead - k;
+    }
+    Vec_BitFree( vMarks );
+    Vec_IntFree( vChunk );
+    if ( vCore )
+        Vec_IntUniqify( vCore );
+    return vCore;
+}
+
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
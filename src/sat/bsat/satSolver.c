@@ -26,6 +26,7 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
 
 #include "satSolver.h"
 #include "satStore.h"
+#include "misc/util/utilPth.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -45,6 +46,12 @@ ABC_NAMESPACE_IMPL_START
 // Just like 'assert()' but expression will be evaluated in the release version as well.
 static inline void check(int expr) { assert(expr); }
 
+// returns 1 if the CPU-time or the wall-clock limit is reached
+static inline int sat_solver_runtime_out(sat_solver* s)
+{
+    return (s->nRuntimeLimit && Abc_Clock() > s->nRuntimeLimit) || (s->nRuntimeLimitWall && Util_WallClock() > s->nRuntimeLimitWall);
+}
+
 static void printlits(lit* begin, lit* end)
 {
     int i;
@@ -132,6 +139,18 @@ int sat_solver_get_var_value(sat_solver* s, int v)
 static inline int      sat_solver_dl(sat_solver* s)                { return veci_size(&s->trail_lim); }
 static inline veci*    sat_solver_read_wlist(sat_solver* s, lit l) { return &s->wlists[l];            }
 
+// watcher lists hold two kinds of entries: a two-literal clause is one odd word
+// (clause_from_lit of the other literal), while a longer clause is two words,
+// its (even) handle followed by a blocker literal; when the blocker is true,
+// the clause is satisfied and does not have to be read from memory
+static inline void     sat_solver_push_watch(sat_solver* s, lit l, cla h, lit blocker)
+{
+    veci* ws = sat_solver_read_wlist(s, l);
+    assert( !clause_is_lit(h) );
+    veci_push(ws, h);
+    veci_push(ws, blocker);
+}
+
 //=================================================================================================
 // Variable order functions:
 
@@ -380,12 +399,12 @@ static void sortrnd(void** array, int size, int(*comp)(const void *, const void
 //=================================================================================================
 // Clause functions:
 
-static inline int sat_clause_compute_lbd( sat_solver* s, clause* c )
+static inline int sat_lits_compute_lbd( sat_solver* s, lit* lits, int size )
 {
     int i, lev, minl = 0, lbd = 0;
-    for (i = 0; i < (int)c->size; i++)
+    for (i = 0; i < size; i++)
     {
-        lev = var_level(s, lit_var(c->lits[i]));
+        lev = var_level(s, lit_var(lits[i]));
         if ( !(minl & (1 << (lev & 31))) )
         {
             minl |= 1 << (lev & 31);
@@ -396,10 +415,43 @@ static inline int sat_clause_compute_lbd( sat_solver* s, clause* c )
 //    printf( " -> %d\n", lbd );
     return lbd;
 }
+static inline int sat_clause_compute_lbd( sat_solver* s, clause* c )
+{
+    return sat_lits_compute_lbd( s, c->lits, c->size );
+}
+
+// records the LBD of a new learned clause and returns 1 if it is time to restart
+static inline int sat_solver_lbd_record( sat_solver* s, int lbd, int Trail )
+{
+    s->lbd_sum_all += lbd;
+    s->lbd_count   += 1;
+    s->trail_avg   += (Trail - s->trail_avg) / 5000;
+    // block the restart if the trail is much larger than usual (close to a model)
+    if ( s->lbd_count > 10000 && s->lbd_size == LBD_QUEUE_SIZE && Trail > 1.4 * s->trail_avg )
+    {
+        s->lbd_size = s->lbd_sum = s->lbd_head = 0;
+        s->nLbdBlocked++;
+    }
+    // add the LBD to the queue
+    if ( s->lbd_size == LBD_QUEUE_SIZE )
+        s->lbd_sum -= s->lbd_queue[s->lbd_head];
+    else
+        s->lbd_size++;
+    s->lbd_sum += lbd;
+    s->lbd_queue[s->lbd_head] = lbd;
+    s->lbd_head = (s->lbd_head + 1) % LBD_QUEUE_SIZE;
+    // restart if the recent clauses are worse than the average
+    if ( s->lbd_size < LBD_QUEUE_SIZE || 0.8 * s->lbd_sum / LBD_QUEUE_SIZE <= s->lbd_sum_all / s->lbd_count )
+        return 0;
+    s->lbd_size = s->lbd_sum = s->lbd_head = 0;
+    s->nLbdRestarts++;
+    return 1;
+}
 
 /* pre: size > 1 && no variable occurs twice
+   the LBD of a learned clause is computed unless it is given (lbd >= 0)
  */
-int sat_solver_clause_new(sat_solver* s, lit* begin, lit* end, int learnt)
+static int sat_solver_clause_new_int(sat_solver* s, lit* begin, lit* end, int learnt, int lbd)
 {
     int fUseBinaryClauses = 1;
     int size;
@@ -429,7 +481,7 @@ int sat_solver_clause_new(sat_solver* s, lit* begin, lit* end, int learnt)
     if (learnt)
     {
         c = clause_read( s, h );
-        c->lbd = sat_clause_compute_lbd( s, c );
+        c->lbd = lbd >= 0 ? lbd : sat_clause_compute_lbd( s, c );
         assert( clause_id(c) == veci_size(&s->act_clas) );
 //        veci_push(&s->learned, h);
 //        act_clause_bump(s,clause_read(s, h));
@@ -453,11 +505,23 @@ int sat_solver_clause_new(sat_solver* s, lit* begin, lit* end, int learnt)
 
     //veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),c);
     //veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),c);
-    veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),(size > 2 ? h : clause_from_lit(begin[1])));
-    veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),(size > 2 ? h : clause_from_lit(begin[0])));
+    if ( size > 2 )
+    {
+        sat_solver_push_watch(s, lit_neg(begin[0]), h, begin[1]);
+        sat_solver_push_watch(s, lit_neg(begin[1]), h, begin[0]);
+    }
+    else
+    {
+        veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),clause_from_lit(begin[1]));
+        veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),clause_from_lit(begin[0]));
+    }
 
     return h;
 }
+int sat_solver_clause_new(sat_solver* s, lit* begin, lit* end, int learnt)
+{
+    return sat_solver_clause_new_int(s, begin, end, learnt, -1);
+}
 
 
 //=================================================================================================
@@ -578,15 +642,18 @@ static void sat_solver_canceluntil_rollback(sat_solver* s, int NewBound) {
     s->qhead = s->qtail = NewBound;
 }
 
-static void sat_solver_record(sat_solver* s, veci* cls)
+static void sat_solver_record(sat_solver* s, veci* cls, int lbd)
 {
     lit*    begin = veci_begin(cls);
     lit*    end   = begin + veci_size(cls);
-    int     h     = (veci_size(cls) > 1) ? sat_solver_clause_new(s,begin,end,1) : 0;
+    int     h     = (veci_size(cls) > 1) ? sat_solver_clause_new_int(s,begin,end,1,lbd) : 0;
     sat_solver_enqueue(s,*begin,h);
     assert(veci_size(cls) > 0);
     if ( h == 0 )
         veci_push( &s->unit_lits, *begin );
+    // give short learned clauses to other solvers of the portfolio
+    if ( s->pFuncExport && veci_size(cls) <= s->nShareSize )
+        s->pFuncExport( s->pShare, begin, end, lbd );
 
     ///////////////////////////////////
     // add clause to internal storage
@@ -796,7 +863,16 @@ static void sat_solver_analyze(sat_solver* s, int h, veci* learnt)
         }else{
             clause* c = clause_read(s, h);
             if (clause_learnt(c))
+            {
                 act_clause_bump(s,c);
+                if ( s->fLbdMode )
+                {
+                    int lbd = sat_clause_compute_lbd(s, c);
+                    if ( lbd < (int)c->lbd )
+                        c->lbd = lbd;
+                    c->used = 1;
+                }
+            }
             lits = clause_begin(c);
             //printlits(lits,lits+clause_size(c)); printf("\n");
             for (j = (p == lit_Undef ? 0 : 1); j < clause_size(c); j++){
@@ -932,18 +1008,28 @@ int sat_solver_propagate(sat_solver* s)
                     continue;
                 }
 
-                *j++ = *i;
-                if (!sat_solver_enqueue(s,clause_read_lit(*i),clause_from_lit(p))){
+                *j++ = *i++;
+                if (!sat_solver_enqueue(s,Lit,clause_from_lit(p))){
                     hConfl = s->hBinary;
                     (clause_begin(s->binary))[1] = lit_neg(p);
-                    (clause_begin(s->binary))[0] = clause_read_lit(*i++);
+                    (clause_begin(s->binary))[0] = Lit;
                     // Copy the remaining watches:
                     while (i < end)
                         *j++ = *i++;
                 }
+                continue;
             }else{
 
-                clause* c = clause_read(s,*i);
+                clause* c;
+                // If the blocker is true, then clause is already satisfied.
+                lit blocker = i[1];
+                if (var_value(s, lit_var(blocker)) == lit_sign(blocker)){
+                    *j++ = *i++;
+                    *j++ = *i++;
+                    continue;
+                }
+
+                c = clause_read(s,*i);
                 lits = clause_begin(c);
 
                 // Make sure the false literal is data[1]:
@@ -955,8 +1041,10 @@ int sat_solver_propagate(sat_solver* s)
                 assert(lits[1] == false_lit);
 
                 // If 0th watch is true, then clause is already satisfied.
-                if (var_value(s, lit_var(lits[0])) == lit_sign(lits[0]))
+                if (var_value(s, lit_var(lits[0])) == lit_sign(lits[0])){
                     *j++ = *i;
+                    *j++ = lits[0];
+                }
                 else{
                     // Look for new watch:
                     lit* stop = lits + clause_size(c);
@@ -965,24 +1053,27 @@ int sat_solver_propagate(sat_solver* s)
                         if (var_value(s, lit_var(*k)) != !lit_sign(*k)){
                             lits[1] = *k;
                             *k = false_lit;
-                            veci_push(sat_solver_read_wlist(s,lit_neg(lits[1])),*i);
+                            sat_solver_push_watch(s, lit_neg(lits[1]), *i, lits[0]);
                             goto next; }
                     }
 
                     *j++ = *i;
+                    *j++ = lits[0];
                     // Clause is unit under assignment:
                     if ( c->lrn )
                         c->lbd = sat_clause_compute_lbd(s, c);
                     if (!sat_solver_enqueue(s,lits[0], *i)){
-                        hConfl = *i++;
+                        hConfl = *i;
+                        i += 2;
                         // Copy the remaining watches:
                         while (i < end)
                             *j++ = *i++;
+                        continue;
                     }
                 }
             }
         next:
-            i++;
+            i += 2;
         }
 
         s->stats.inspects += j - veci_begin(ws);
@@ -1012,6 +1103,8 @@ sat_solver* sat_solver_new(void)
     s->nLearntDelta = LEARNT_MAX_INCRE_DEFAULT;  // delta of learned clause limit
     s->nLearntRatio = LEARNT_MAX_RATIO_DEFAULT;  // ratio of learned clause limit
     s->nLearntMax   = s->nLearntStart;
+    s->nLbdGlue     = LBD_GLUE_DEFAULT;          // learned clauses never deleted
+    s->nLbdTier2    = LBD_TIER2_DEFAULT;         // learned clauses kept while used
 
     // initialize vectors
     veci_new(&s->order);
@@ -1198,6 +1291,8 @@ void sat_solver_restart( sat_solver* s )
         s->wlists[i].size = 0;
 
     s->nDBreduces = 0;
+    s->lbd_size = s->lbd_sum = s->lbd_head = 0;
+    s->lbd_sum_all = s->lbd_count = s->trail_avg = 0;
 
     // initialize other vars
     s->size                   = 0;
@@ -1289,7 +1384,7 @@ void sat_solver_reducedb(sat_solver* s)
     int nLearnedOld = veci_size(&s->act_clas);
     int * act_clas = veci_begin(&s->act_clas);
     int * pPerm, * pArray, * pSortValues, nCutoffValue;
-    int i, k, j, Id, Counter, CounterStart, nSelected;
+    int i, k, j, Id, Counter, CounterStart, nSelected, nLocal = 0;
     clause * c;
 
     assert( s->nLearntMax > 0 );
@@ -1307,7 +1402,17 @@ void sat_solver_reducedb(sat_solver* s)
     Sat_MemForEachLearned( pMem, c, i, k )
     {
         Id = clause_id(c);
-        pSortValues[Id] = (((7 - Abc_MinInt(c->lbd, 7)) << 28) | (act_clas[Id] >> 4));
+        if ( s->fLbdMode )
+        {
+            // glue clauses and recently used tier-2 clauses are kept, 
+            // the remaining (local) clauses are compared by activity
+            if ( c->lbd <= s->nLbdGlue || (c->lbd <= s->nLbdTier2 && c->used) )
+                pSortValues[Id] = ABC_INFINITY;
+            else
+                pSortValues[Id] = (act_clas[Id] >> 1), nLocal++;
+        }
+        else
+            pSortValues[Id] = (((7 - Abc_MinInt(c->lbd, 7)) << 28) | (act_clas[Id] >> 4));
 //        pSortValues[Id] = act[Id];
         assert( pSortValues[Id] >= 0 );
     }
@@ -1321,7 +1426,14 @@ void sat_solver_reducedb(sat_solver* s)
     // find non-decreasing permutation
     pPerm = Abc_MergeSortCost( pSortValues, nLearnedOld );
     assert( pSortValues[pPerm[0]] <= pSortValues[pPerm[nLearnedOld-1]] );
-    nCutoffValue = pSortValues[pPerm[nLearnedOld-nSelected]];
+    if ( s->fLbdMode )
+    {
+        // delete the less active local clauses, which come first in the order
+        nSelected = nLocal - nLocal*s->nLearntRatio/100;
+        nCutoffValue = nSelected ? pSortValues[pPerm[nSelected-1]] : -1;
+    }
+    else
+        nCutoffValue = pSortValues[pPerm[nLearnedOld-nSelected]];
     ABC_FREE( pPerm );
 //    ActCutOff = ABC_INFINITY;
 
@@ -1331,7 +1443,10 @@ void sat_solver_reducedb(sat_solver* s)
     {
         assert( c->mark == 0 );
         if ( Counter++ > CounterStart || clause_size(c) < 3 || pSortValues[clause_id(c)] > nCutoffValue || s->reasons[lit_var(c->lits[0])] == Sat_MemHand(pMem, i, k) )
+        {
             act_clas[j++] = act_clas[clause_id(c)];
+            c->used = 0;
+        }
         else // delete
         {
             c->mark = 1;
@@ -1371,12 +1486,18 @@ void sat_solver_reducedb(sat_solver* s)
             if ( clause_is_lit(pArray[k]) ) // 2-lit clause
                 pArray[j++] = pArray[k];
             else if ( !clause_learnt_h(pMem, pArray[k]) ) // problem clause
+            {
                 pArray[j++] = pArray[k];
+                pArray[j++] = pArray[++k]; // blocker
+            }
             else 
             {
-                c = clause_read(s, pArray[k]);
+                c = clause_read(s, pArray[k++]);
                 if ( !c->mark ) // useful learned clause
+                {
                    pArray[j++] = clause_id(c); // updating handle here!!!
+                   pArray[j++] = pArray[k]; // blocker
+                }
             }
         }
         veci_resize(&s->wlists[i],j);
@@ -1386,6 +1507,10 @@ void sat_solver_reducedb(sat_solver* s)
     Counter = Sat_MemCompactLearned( pMem, 1 );
     assert( Counter == (int)s->stats.learnts );
 
+    // glue clauses are never deleted, so the limit should leave room for new ones
+    if ( s->fLbdMode && s->nLearntMax < (int)s->stats.learnts + s->nLearntDelta )
+        s->nLearntMax = s->stats.learnts + s->nLearntDelta;
+
     // report the results
     TimeTotal += Abc_Clock() - clk;
     if ( s->fVerbose )
@@ -1431,8 +1556,20 @@ void sat_solver_rollback( sat_solver* s )
     {
         cla* pArray = veci_begin(&s->wlists[i]);
         for ( j = k = 0; k < veci_size(&s->wlists[i]); k++ )
-            if ( Sat_MemClauseUsed(pMem, pArray[k]) )
-                pArray[j++] = pArray[k];
+        {
+            if ( clause_is_lit(pArray[k]) ) // 2-lit clause
+            {
+                if ( Sat_MemClauseUsed(pMem, pArray[k]) )
+                    pArray[j++] = pArray[k];
+            }
+            else if ( Sat_MemClauseUsed(pMem, pArray[k]) )
+            {
+                pArray[j++] = pArray[k++];
+                pArray[j++] = pArray[k]; // blocker
+            }
+            else
+                k++; // skip blocker
+        }
         veci_resize(&s->wlists[i],j);
     }
     // reset watcher lists
@@ -1552,6 +1689,43 @@ int sat_solver_addclause(sat_solver* s, lit* begin, lit* end)
     return true;
 }
 
+/* adds a clause implied by the problem as a learned clause, which can be removed by reducedb;
+   lbd is the LBD of the clause in the solver that derived it (0 if unknown, then the size is used);
+   the LBD computed here would be 1 (all literals are unassigned at level zero), so it is not used,
+   and the clause is never treated as glue, so it is kept only while it is used (tier 2) or active
+   pre: decision level is zero && no variable occurs twice
+ */
+int sat_solver_addlearnt(sat_solver* s, lit* begin, lit* end, int lbd)
+{
+    lit *i;
+    int maxvar = 0;
+    assert( sat_solver_dl(s) == 0 );
+    veci_resize( &s->temp_clause, 0 );
+    for ( i = begin; i < end; i++ )
+    {
+        maxvar = lit_var(*i) > maxvar ? lit_var(*i) : maxvar;
+        if ( lit_var(*i) >= s->size )
+            veci_push( &s->temp_clause, *i );
+        else if ( var_value(s, lit_var(*i)) == lit_sign(*i) )
+            return true;   // satisfied at the top level
+        else if ( var_value(s, lit_var(*i)) == varX )
+            veci_push( &s->temp_clause, *i );
+    }
+    sat_solver_setnvars(s,maxvar+1);
+    begin = veci_begin( &s->temp_clause );
+    end = begin + veci_size( &s->temp_clause );
+    if ( begin == end )      // empty clause
+        return false;
+    if ( end - begin == 1 )  // unit clause
+        return sat_solver_enqueue(s,*begin,0);
+    if ( lbd <= 0 || lbd > end - begin )
+        lbd = end - begin;
+    lbd = Abc_MinInt( Abc_MaxInt(lbd, s->nLbdGlue + 1), 127 );
+    assert( lbd > s->nLbdGlue ); // reducedb can delete it
+    sat_solver_clause_new_int(s,begin,end,1,lbd);
+    return true;
+}
+
 double luby(double y, int x)
 {
     int size, seq;
@@ -1580,10 +1754,14 @@ static lbool sat_solver_search(sat_solver* s, ABC_INT64_T nof_conflicts)
 
     ABC_INT64_T  conflictC       = 0;
     veci    learnt_clause;
-    int     i;
+    int     i, fRestart = 0;
 
     assert(s->root_level == sat_solver_dl(s));
 
+    // add clauses learned by other solvers of the portfolio
+    if ( s->pFuncImport && s->root_level == 0 && !s->pFuncImport( s->pShare, s ) )
+        return l_False;
+
     s->nRestarts++;
     s->stats.starts++;
 //    s->var_decay = (float)(1 / var_decay   );  // move this to sat_solver_new()
@@ -1606,7 +1784,7 @@ static lbool sat_solver_search(sat_solver* s, ABC_INT64_T nof_conflicts)
         int hConfl = sat_solver_propagate(s);
         if (hConfl != 0){
             // CONFLICT
-            int blevel;
+            int blevel, lbd, nTrail = s->qtail;
 
 #ifdef VERBOSEDEBUG
             printf(L_IND"**CONFLICT**\n", L_ind);
@@ -1622,10 +1800,14 @@ static lbool sat_solver_search(sat_solver* s, ABC_INT64_T nof_conflicts)
 
             veci_resize(&learnt_clause,0);
             sat_solver_analyze(s, hConfl, &learnt_clause);
+            // the levels of the literals are valid only before backtracking
+            lbd = sat_lits_compute_lbd(s, veci_begin(&learnt_clause), veci_size(&learnt_clause));
             blevel = veci_size(&learnt_clause) > 1 ? var_level(s, lit_var(veci_begin(&learnt_clause)[1])) : s->root_level;
             blevel = s->root_level > blevel ? s->root_level : blevel;
             sat_solver_canceluntil(s,blevel);
-            sat_solver_record(s,&learnt_clause);
+            sat_solver_record(s,&learnt_clause,lbd);
+            if ( s->fLbdMode )
+                fRestart |= sat_solver_lbd_record(s, lbd, nTrail);
 #ifdef SAT_USE_ANALYZE_FINAL
 //            if (learnt_clause.size() == 1) level[var(learnt_clause[0])] = 0;    // (this is ugly (but needed for 'analyzeFinal()') -- in future versions, we will backtrack past the 'root_level' and redo the assumptions)
             if ( learnt_clause.size == 1 ) 
@@ -1639,7 +1821,7 @@ static lbool sat_solver_search(sat_solver* s, ABC_INT64_T nof_conflicts)
             int next;
  
             // Reached bound on number of conflicts:
-            if ((nof_conflicts >= 0 && conflictC >= nof_conflicts) || (s->nRuntimeLimit && (s->stats.conflicts & 63) == 0 && Abc_Clock() > s->nRuntimeLimit)){
+            if (fRestart || (nof_conflicts >= 0 && conflictC >= nof_conflicts) || ((s->stats.conflicts & 63) == 0 && sat_solver_runtime_out(s)) || (s->pStop && *s->pStop)){
                 s->progress_estimate = sat_solver_progress(s);
                 sat_solver_canceluntil(s,s->root_level);
                 veci_delete(&learnt_clause);
@@ -1849,7 +2031,7 @@ int sat_solver_solve(sat_solver* s, lit* begin, lit* end, ABC_INT64_T nConfLimit
     while (status == l_Undef){
         double Ratio = (s->stats.learnts == 0)? 0.0 :
             s->stats.learnts_literals / (double)s->stats.learnts;
-        if ( s->nRuntimeLimit && Abc_Clock() > s->nRuntimeLimit )
+        if ( sat_solver_runtime_out(s) )
             break;
         if (s->verbosity >= 1)
         {
@@ -1865,7 +2047,8 @@ int sat_solver_solve(sat_solver* s, lit* begin, lit* end, ABC_INT64_T nConfLimit
                 s->progress_estimate*100);
             fflush(stdout);
         }
-        nof_conflicts = (ABC_INT64_T)( 100 * luby(2, restart_iter++) );
+        // in the LBD mode, the restarts are decided by the recent LBDs
+        nof_conflicts = s->fLbdMode ? -1 : (ABC_INT64_T)( 100 * luby(2, restart_iter++) );
         status = sat_solver_search(s, nof_conflicts);
 //        nof_learnts    = nof_learnts * 11 / 10; //*= 1.1;
         // quit the loop if reached an external limit
@@ -1873,7 +2056,9 @@ int sat_solver_solve(sat_solver* s, lit* begin, lit* end, ABC_INT64_T nConfLimit
             break;
         if ( s->nInsLimit  && s->stats.propagations > s->nInsLimit )
             break;
-        if ( s->nRuntimeLimit && Abc_Clock() > s->nRuntimeLimit )
+        if ( sat_solver_runtime_out(s) )
+            break;
+        if ( s->pStop && *s->pStop )
             break;
     }
     if (s->verbosity >= 1)
@@ -46,6 +46,7 @@ extern void        sat_solver_delete(sat_solver* s);
 
 extern int         sat_solver_addclause(sat_solver* s, lit* begin, lit* end);
 extern int         sat_solver_clause_new(sat_solver* s, lit* begin, lit* end, int learnt);
+extern int         sat_solver_addlearnt(sat_solver* s, lit* begin, lit* end, int lbd);
 extern int         sat_solver_simplify(sat_solver* s);
 extern int         sat_solver_solve(sat_solver* s, lit* begin, lit* end, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, ABC_INT64_T nConfLimitGlobal, ABC_INT64_T nInsLimitGlobal);
 extern void        sat_solver_restart( sat_solver* s );
@@ -163,6 +164,14 @@ struct sat_solver_t
     ABC_INT64_T nConfLimit;    // external limit on the number of conflicts
     ABC_INT64_T nInsLimit;     // external limit on the number of implications
     abctime     nRuntimeLimit; // external limit on runtime
+    abctime     nRuntimeLimitWall; // external limit on wall-clock time (see Util_WallClock)
+
+    // portfolio solving
+    volatile int * pStop;      // external stop flag raised by another thread
+    void *      pShare;        // clause exchange data
+    int         nShareSize;    // the max size of exported learned clauses
+    void     (* pFuncExport)( void * pShare, lit * begin, lit * end, int lbd ); // called for short learned clauses
+    int      (* pFuncImport)( void * pShare, sat_solver * s );         // called at restarts, returns 0 if UNSAT
 
     veci        act_vars;      // variables whose activity has changed
     double*     factors;       // the activity factors
@@ -175,6 +184,20 @@ struct sat_solver_t
     int         fSkipSimplify; // set to one to skip simplification of the clause database
     int         fNotUseRandom; // do not allow random decisions with a fixed probability
 
+    // LBD-based clause management and restarts
+    int         fLbdMode;      // keep learned clauses by LBD and restart when recent LBDs grow
+    int         nLbdGlue;      // learned clauses with LBD up to this are never deleted
+    int         nLbdTier2;     // learned clauses with LBD up to this are kept while used
+    int         lbd_queue[LBD_QUEUE_SIZE]; // LBDs of the most recent learned clauses
+    int         lbd_head;      // the next position in the LBD queue
+    int         lbd_size;      // the number of entries in the LBD queue
+    int         lbd_sum;       // the sum of LBDs in the queue
+    double      lbd_sum_all;   // the sum of LBDs of all learned clauses
+    double      lbd_count;     // the number of learned clauses
+    double      trail_avg;     // moving average of the trail size at conflicts
+    int         nLbdRestarts;  // the number of restarts triggered by LBD
+    int         nLbdBlocked;   // the number of restarts blocked because of a large trail
+
     int *       pGlobalVars;   // for experiments with global vars during interpolation
     // clause store
     void *      pStore;
@@ -237,6 +260,13 @@ static abctime sat_solver_set_runtime_limit(sat_solver* s, abctime Limit)
     return nRuntimeLimit;
 }
 
+static abctime sat_solver_set_runtime_limit_wall(sat_solver* s, abctime Limit)
+{
+    abctime nRuntimeLimitWall = s->nRuntimeLimitWall;
+    s->nRuntimeLimitWall = Limit;
+    return nRuntimeLimitWall;
+}
+
 static int sat_solver_set_random(sat_solver* s, int fNotUseRandom)
 {
     int fNotUseRandomOld = s->fNotUseRandom;
@@ -244,6 +274,13 @@ static int sat_solver_set_random(sat_solver* s, int fNotUseRandom)
     return fNotUseRandomOld;
 }
 
+static int sat_solver_set_lbd_mode(sat_solver* s, int fLbdMode)
+{
+    int fLbdModeOld = s->fLbdMode;
+    s->fLbdMode = fLbdMode;
+    return fLbdModeOld;
+}
+
 static inline void sat_solver_bookmark(sat_solver* s)
 {
     assert( s->qhead == s->qtail );
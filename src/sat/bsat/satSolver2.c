@@ -173,7 +173,7 @@ static inline void proof_chain_start( sat_solver2* s, clause* c )
         s->tempInter = Int2_ManChainStart( s->pInt2, c );
     if ( s->pPrf2 )
         Prf_ManChainStart( s->pPrf2, c );
-    if ( s->pPrf1 )
+    if ( s->pPrf1 || s->pPrf3 )
     {
         int ProofId = clause2_proofid(s, c, 0);
         assert( (ProofId >> 2) > 0 );
@@ -198,7 +198,7 @@ static inline void proof_chain_resolve( sat_solver2* s, clause* cls, int Var )
         clause* c = cls ? cls : var_unit_clause( s, Var );
         Prf_ManChainResolve( s->pPrf2, c );
     }
-    if ( s->pPrf1 )
+    if ( s->pPrf1 || s->pPrf3 )
     {
         clause* c = cls ? cls : var_unit_clause( s, Var );
         int ProofId = clause2_proofid(s, c, var_is_partA(s,Var));
@@ -226,6 +226,8 @@ static inline int proof_chain_stop( sat_solver2* s )
         Proof_ClauseSetEnts( s->pPrf1, h, veci_size(&s->temp_proof) - 2 );
         return h;
     }
+    if ( s->pPrf3 )
+        return Prf_LogAppend( s->pPrf3, veci_begin(&s->temp_proof) + 2, veci_size(&s->temp_proof) - 2 );
     return 0;
 }
 
@@ -419,11 +421,11 @@ static int clause2_create_new(sat_solver2* s, lit* begin, lit* end, int learnt,
     c = clause2_read( s, h );
     if (learnt)
     {
-        if ( s->pPrf1 )
+        if ( s->pPrf1 || s->pPrf3 )
             assert( proof_id );
         c->lbd = sat_clause_compute_lbd( s, c );
         assert( clause_id(c) == veci_size(&s->act_clas) );
-        if ( s->pPrf1 || s->pInt2 )
+        if ( s->pPrf1 || s->pPrf3 || s->pInt2 )
             veci_push(&s->claProofs, proof_id);
 //        veci_push(&s->act_clas, (1<<10));
         veci_push(&s->act_clas, 0);
@@ -1026,7 +1028,7 @@ static lbool solver2_search(sat_solver2* s, ABC_INT64_T nof_conflicts)
             s->stats.conflicts++; conflictC++;
             if (solver2_dlevel(s) <= s->root_level){
                 proof_id = solver2_analyze_final(s, confl, 0);
-                if ( s->pPrf1 )
+                if ( s->pPrf1 || s->pPrf3 )
                     assert( proof_id > 0 );
                 s->hProofLast = proof_id;
                 veci_delete(&learnt_clause);
@@ -1050,7 +1052,7 @@ static lbool solver2_search(sat_solver2* s, ABC_INT64_T nof_conflicts)
             // NO CONFLICT
             int next;
 
-            if ((nof_conflicts >= 0 && conflictC >= nof_conflicts) || (s->nRuntimeLimit && (s->stats.conflicts & 63) == 0 && Abc_Clock() > s->nRuntimeLimit)){
+            if ((nof_conflicts >= 0 && conflictC >= nof_conflicts) || (s->nRuntimeLimit && (s->stats.conflicts & 63) == 0 && Abc_Clock() > s->nRuntimeLimit) || (s->pStop && *s->pStop)){
                 // Reached bound on number of conflicts:
                 s->progress_estimate = solver2_progress(s);
                 solver2_canceluntil(s,s->root_level);
@@ -1258,6 +1260,7 @@ void sat_solver2_delete(sat_solver2* s)
 //    veci_delete(&s->proofs);
     Vec_SetFree( s->pPrf1 );
     Prf_ManStop( s->pPrf2 );
+    Prf_LogStop( s->pPrf3 );
     Int2_ManStop( s->pInt2 );
 
     // delete arrays
@@ -1641,6 +1644,11 @@ void sat_solver2_rollback( sat_solver2* s )
         // temporarily, perform more general proof reduction
 //        Sat_ProofReduce( s->pPrf1, &s->claProofs, s->hProofPivot );
     }
+    if ( s->pPrf3 ) 
+    {
+        veci_resize(&s->claProofs, s->stats.learnts);
+        Prf_LogRollback( s->pPrf3 );
+    }
     assert( s->pPrf2 == NULL );
 //    if ( s->pPrf2 )
 //        Prf_ManShrink( s->pPrf2, s->stats.learnts );
@@ -1735,6 +1743,8 @@ double sat_solver2_memory_proof( sat_solver2* s )
     double Mem = s->dPrfMemory;
     if ( s->pPrf1 )
         Mem += Vec_ReportMemory( s->pPrf1 );
+    if ( s->pPrf3 )
+        Mem += Prf_LogMemory( s->pPrf3 );
     return Mem;
 }
 
@@ -1971,6 +1981,8 @@ int sat_solver2_solve(sat_solver2* s, lit* begin, lit* end, ABC_INT64_T nConfLim
             break;
         if ( s->nInsLimit  && s->stats.propagations > s->nInsLimit )
             break;
+        if ( s->pStop && *s->pStop )
+            break;
     }
     if (s->verbosity >= 1)
         Abc_Print(1,"==============================================================================\n");
@@ -1987,6 +1999,8 @@ void * Sat_ProofCore( sat_solver2 * s )
     extern void * Proof_DeriveCore( Vec_Set_t * vProof, int hRoot );
     if ( s->pPrf1 )
         return Proof_DeriveCore( s->pPrf1, s->hProofLast );
+    if ( s->pPrf3 )
+        return Prf_LogDeriveCore( s->pPrf3, s->hProofLast );
     if ( s->pPrf2 )
     {
         s->dPrfMemory = Abc_MaxDouble( s->dPrfMemory, Prf_ManMemory(s->pPrf2) );
@@ -43,6 +43,7 @@ ABC_NAMESPACE_HEADER_START
 struct sat_solver2_t;
 typedef struct sat_solver2_t sat_solver2;
 typedef struct Int2_Man_t_ Int2_Man_t;
+typedef struct Prf_Log_t_ Prf_Log_t;
 
 extern sat_solver2* sat_solver2_new(void);
 extern void         sat_solver2_delete(sat_solver2* s);
@@ -73,6 +74,16 @@ extern void *       Sat_ProofInterpolant( sat_solver2 * s, void * pGloVars );
 extern word *       Sat_ProofInterpolantTruth( sat_solver2 * s, void * pGloVars );
 extern void         Sat_ProofCheck( sat_solver2 * s );
 
+// streaming proof APIs
+extern Prf_Log_t *  Prf_LogStart( char * pFileName, int nBufferMax );
+extern void         Prf_LogStop( Prf_Log_t * p );
+extern double       Prf_LogMemory( Prf_Log_t * p );
+extern double       Prf_LogFileSize( Prf_Log_t * p );
+extern int          Prf_LogAppend( Prf_Log_t * p, int * pEnts, int nEnts );
+extern void         Prf_LogBookmark( Prf_Log_t * p );
+extern void         Prf_LogRollback( Prf_Log_t * p );
+extern void *       Prf_LogDeriveCore( Prf_Log_t * p, int hRoot );
+
 // interpolation APIs
 extern Int2_Man_t * Int2_ManStart( sat_solver2 * pSat, int * pGloVars, int nGloVars );
 extern void         Int2_ManStop( Int2_Man_t * p );
@@ -164,6 +175,7 @@ struct sat_solver2_t
     int             hLearntLast;    // in proof-logging mode, the ID of the final conflict clause (conf_final)
     int             hProofLast;     // in proof-logging mode, the ID of the final conflict clause (conf_final)
     Prf_Man_t *     pPrf2;          // another proof manager
+    Prf_Log_t *     pPrf3;          // proof records streamed to disk
     double          dPrfMemory;     // memory used by the proof-logger
     Int2_Man_t *    pInt2;          // interpolation manager
     int             tempInter;      // temporary storage for the interpolant
@@ -173,6 +185,7 @@ struct sat_solver2_t
     ABC_INT64_T     nConfLimit;     // external limit on the number of conflicts
     ABC_INT64_T     nInsLimit;      // external limit on the number of implications
     abctime         nRuntimeLimit;  // external limit on runtime
+    volatile int *  pStop;          // external stop flag raised by another thread
 };
 
 static inline clause * clause2_read( sat_solver2 * s, cla h )                  { return Sat_MemClauseHand( &s->Mem, h ); }
@@ -252,6 +265,8 @@ static inline void sat_solver2_bookmark(sat_solver2* s)
     s->iTrailPivot  = s->qhead;
     if ( s->pPrf1 )
         s->hProofPivot  = Vec_SetHandCurrent(s->pPrf1);
+    if ( s->pPrf3 )
+        Prf_LogBookmark( s->pPrf3 );
     Sat_MemBookMark( &s->Mem );
     if ( s->activity2 )
     {